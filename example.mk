@@ -32,19 +32,34 @@ $(CD_OBJECTS): .FORCE lbas.h
 	$(LD) $(LDFLAGS) $(OBJECTS) $(LIBS) -o $@ -Map $*.map
 %.bin: %.elf
 	$(OBJCOPY) -O binary $< $@
-cd: $(TARGETS)
+cd: $(TARGETS) $(ADD_FILES)
 	bincat out.bin lbas.h $(BIN_TARGET) $(ADD_FILES)
 	make cdclean -C .
 	make all -C .
 	bincat out.bin lbas.h $(BIN_TARGET) $(ADD_FILES)
 	pcfx-cdlink cdlink.txt $(CDOUT)
 
-	
-lbas.h:
+
+# the ADPCM sound bank, its index (and the samples for FXUPLOADER) are kept in the tree
+# so the executable builds without it
+mkbank: tools/mkbank.c
+	$(HOSTCC) -O2 -o $@ $<
+
+sndbank.bin $(SRCDIR)/sndbank_index.h $(SRCDIR)/sndbank_data.h: mkbank $(SOUNDS)
+	./mkbank sndbank.bin $(SRCDIR)/sndbank_index.h $(SRCDIR)/sndbank_data.h $(SOUNDS)
+
+# the level pack, same thing
+mklevels: tools/mklevels.c $(SRCDIR)/levels.h $(SRCDIR)/lz.c
+	$(HOSTCC) -O2 -o $@ $<
+
+levels.bin $(SRCDIR)/levelpack_index.h: mklevels
+	./mklevels levels.bin $(SRCDIR)/levelpack_index.h
+
+lbas.h: $(ADD_FILES)
 	bincat out.bin lbas.h $(BIN_TARGET) $(ADD_FILES)
 
 clean:
-	rm -rf $(OBJECTS) $(TARGETS) lbas.h out.bin $(CDOUT).cue $(CDOUT).bin *.source *.map
+	rm -rf $(OBJECTS) $(TARGETS) lbas.h out.bin mkbank sndbank.bin mklevels levels.bin $(CDOUT).cue $(CDOUT).bin *.source *.map
 
 cdclean:
 	rm -rf $(OBJECTS) $(TARGETS) $(CDOUT).cue $(CDOUT).bin
@@ -3,6 +3,8 @@
 
 typedef enum {
 	BINARY_LBA_MYTEST_BIN = 2,
+	BINARY_LBA_SNDBANK_BIN = 94,
+	BINARY_LBA_LEVELS_BIN = 115,
 } bincat_lbas;
 #endif
 
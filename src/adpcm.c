@@ -0,0 +1,64 @@
+/*
+ * Gameblabla small PCFX lib Copyright 2024
+ * Licensed under MIT license
+ * See LICENSE file for more
+*/
+
+#include "adpcm.h"
+
+static const short step_table[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+	11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767
+};
+
+static const signed char index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+/*
+ * Encodes count (even) samples to count / 2 bytes, high nibble first, the same way
+ * tools/mkbank.c does for the sound bank.
+*/
+void ADPCM_Encode(adpcm_state_t* state, const short pcm[], int count, unsigned char out[])
+{
+	int i;
+	int prev = state->prev, index = state->index;
+	
+	for (i = 0; i < count; i++)
+	{
+		int step = step_table[index];
+		int delta = pcm[i] - prev;
+		int nibble, diff;
+		
+		if (delta < 0)
+		{
+			nibble = (-delta * 4) / step;
+			if (nibble > 7) nibble = 7;
+			diff = -((step * (2 * nibble + 1)) >> 3);
+			nibble |= 8;
+		}
+		else
+		{
+			nibble = (delta * 4) / step;
+			if (nibble > 7) nibble = 7;
+			diff = (step * (2 * nibble + 1)) >> 3;
+		}
+		
+		prev += diff;
+		if (prev > 32767) prev = 32767;
+		else if (prev < -32768) prev = -32768;
+		
+		index += index_table[nibble & 7];
+		if (index < 0) index = 0;
+		else if (index > 88) index = 88;
+		
+		if (i & 1) out[i >> 1] |= nibble;
+		else out[i >> 1] = nibble << 4;
+	}
+	
+	state->prev = prev;
+	state->index = index;
+}
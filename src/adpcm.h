@@ -0,0 +1,19 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+
+/*
+ * 4 bit ADPCM encoder (IMA steps, high nibble first) of the samples made at run time,
+ * e.g. the music of adpcmstream. Plain C, so the host tools can use it too.
+*/
+
+typedef struct
+{
+	short prev;      // last decoded sample
+	uint8_t index;   // in the step table
+} adpcm_state_t;
+
+extern void ADPCM_Encode(adpcm_state_t* state, const short pcm[], int count, unsigned char out[]);
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ * Gameblabla small PCFX lib Copyright 2024
+ * Licensed under MIT license
+ * See LICENSE file for more
+*/
+
+#include "fastking.h"
+#include "adpcmstream.h"
+
+/*
+ * The ring is played in KING's ring buffer mode and split in two halves : the channel's
+ * intermediate address is the middle of the ring and its end address the end, so the
+ * intermediate interrupt means the first half was played and the end interrupt that the
+ * second one was. Both only set their bit in the ADPCM status register (the KING IRQ stays
+ * masked), which the timer IRQ polls with stream_poll, so the main code knows which half
+ * it can write again.
+*/
+static int stream_channel = -1;
+static u32 stream_start, stream_half; // KRAM address and size of a half, in words
+static int stream_playing = 0;
+
+static int write_half = 0;
+static u32 write_pos = 0;             // in bytes, in write_half
+static volatile int half_free[2];
+
+stream_stats_t stream_stats;
+
+void Stream_Init(int channel, u32 kram_start, u32 words)
+{
+	stream_channel = channel;
+	stream_start = kram_start;
+	stream_half = words >> 1;
+	stream_playing = 0;
+	
+	write_half = 0;
+	write_pos = 0;
+	half_free[0] = 1;
+	half_free[1] = 1;
+}
+
+/* Bytes that can be written right now, always a multiple of STREAM_MIN_WRITE. */
+u32 Stream_Free()
+{
+	if (stream_channel < 0 || !half_free[write_half]) return 0;
+	
+	return (stream_half << 1) - write_pos;
+}
+
+/* size has to be a multiple of STREAM_MIN_WRITE and at most Stream_Free(). */
+void Stream_Write(const unsigned char adpcm[], u32 size)
+{
+	Present_Lock();
+	eris_king_set_kram_write(stream_start + write_half * stream_half + (write_pos >> 1), 1);
+	king_kram_write_buffer((void*)adpcm, size);
+	Present_Unlock();
+	
+	stream_stats.written += size;
+	write_pos += size;
+	
+	if (write_pos >= (stream_half << 1))
+	{
+		half_free[write_half] = 0;
+		write_half ^= 1;
+		write_pos = 0;
+	}
+}
+
+/* The first half is written, the channel can start. */
+int Stream_Ready()
+{
+	return stream_channel >= 0 && !stream_playing && !half_free[0];
+}
+
+/*
+ * Starts the channel on the ring. playing is the mask of the other channels that are
+ * still playing (see Play_ADPCM_Voices), they are left alone.
+*/
+void Stream_Play(u32 playing)
+{
+	int ch = stream_channel;
+	
+	Present_Lock();
+	
+	eris_king_set_kram_read(stream_start, 1);
+	
+	// ring buffer, end and intermediate interrupts (see Initialize_ADPCM)
+	out16(0x600, ch ? 0x52 : 0x51);
+	out16(0x604, 7);
+	out16(0x600, ch ? 0x5C : 0x58);
+	out16(0x604, stream_start / 256);
+	out16(0x600, ch ? 0x5D : 0x59);
+	out32(0x604, stream_start + (stream_half << 1) - 1);
+	// the intermediate address is divided by 64
+	out16(0x600, ch ? 0x5E : 0x5A);
+	out16(0x604, (stream_start + stream_half) / 64);
+	
+	// clear the status left from before
+	out16(0x600, 0x53);
+	in16(0x604);
+	
+	stream_playing = 1;
+	
+	out16(0x600, 0x50);
+	out16(0x604, (playing & 3) | (1 << ch));
+	
+	Present_Unlock();
+}
+
+void Stream_Stop(u32 playing)
+{
+	int ch = stream_channel;
+	
+	if (ch < 0) return;
+	
+	Present_Lock();
+	
+	stream_playing = 0;
+	
+	out16(0x600, ch ? 0x52 : 0x51);
+	out16(0x604, 0);
+	out16(0x600, 0x50);
+	out16(0x604, playing & 3 & ~(1 << ch));
+	
+	Present_Unlock();
+	
+	Stream_Init(ch, stream_start, stream_half << 1);
+}
+
+/* The channel bit to keep in the play command, 0 if the stream isn't playing. */
+u32 Stream_Channel_Mask()
+{
+	return stream_playing ? (1 << stream_channel) : 0;
+}
+
+/* Called by the timer IRQ when it can use the KING registers. */
+__attribute__ ((noinline)) void stream_poll (void)
+{
+	u16 status;
+	
+	if (!stream_playing) return;
+	
+	// two bits per channel : end, intermediate
+	out16(0x600, 0x53);
+	status = in16(0x604) >> (stream_channel * 2);
+	
+	if (status & 2)
+	{
+		// now playing the second half
+		if (half_free[1]) stream_stats.underruns++;
+		half_free[0] = 1;
+	}
+	
+	if (status & 1)
+	{
+		// wrapped, playing the first half again
+		if (half_free[0] && !(status & 2)) stream_stats.underruns++;
+		half_free[1] = 1;
+	}
+}
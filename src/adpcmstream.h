@@ -0,0 +1,38 @@
+#ifndef ADPCMSTREAM_H
+#define ADPCMSTREAM_H
+
+#include "pcfx.h"
+#include "adpcm.h"
+
+/*
+ * ADPCM stream : keeps one ADPCM channel looping over a KRAM ring buffer that the main
+ * code refills with freshly encoded samples, e.g. generated music.
+*/
+
+#define STREAM_MIN_WRITE 16 // king_kram_write_buffer writes 16 bytes at a time
+
+typedef struct
+{
+	u32 written;     // bytes written to the ring
+	u32 underruns;   // halves that started playing before they were refilled
+} stream_stats_t;
+
+extern stream_stats_t stream_stats;
+
+extern void Stream_Init(int channel, u32 kram_start, u32 words);
+
+extern u32 Stream_Free();
+
+extern void Stream_Write(const unsigned char adpcm[], u32 size);
+
+extern int Stream_Ready();
+
+extern void Stream_Play(u32 playing);
+
+extern void Stream_Stop(u32 playing);
+
+extern u32 Stream_Channel_Mask();
+
+extern void stream_poll(void);
+
+#endif
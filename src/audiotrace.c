@@ -0,0 +1,28 @@
+/*
+ * Gameblabla small PCFX lib Copyright 2024
+ * Licensed under MIT license
+ * See LICENSE file for more
+*/
+
+#include "pcfx.h"
+#include "audiotrace.h"
+
+/*
+ * Kept as one block so it can be dumped from the memory of an emulator (the address of
+ * audio_trace is in the .map file) and fed to tools/audiotrace.c.
+*/
+audio_trace_t audio_trace = { AUDIO_TRACE_MAGIC, 0 };
+
+void Audio_Trace(uint8_t type, uint8_t sound, uint8_t voice, uint8_t volume, uint32_t frame)
+{
+	audio_event_t* e = &audio_trace.events[audio_trace.count & (AUDIO_TRACE_SIZE - 1)];
+	
+	e->ticks = getTicks();
+	e->frame = frame;
+	e->type = type;
+	e->sound = sound;
+	e->voice = voice;
+	e->volume = volume;
+	
+	audio_trace.count++;
+}
@@ -0,0 +1,47 @@
+#ifndef AUDIOTRACE_H
+#define AUDIOTRACE_H
+
+#include <stdint.h>
+
+/*
+ * Audio trace : a ring of the sound events (see AUDIO_EVENT_*) with the frame and the
+ * timer ticks they happened at. tools/audiotrace.c reads a dump of it.
+*/
+
+#define AUDIO_TRACE_SIZE 512 // a power of 2
+#define AUDIO_TRACE_MAGIC 0x43525441 // "ATRC"
+
+enum
+{
+	AUDIO_EVENT_REQUEST,      // the game asked for the sound
+	AUDIO_EVENT_DROP_FRAME,   // the game dropped it, it was already played this frame
+	AUDIO_EVENT_DROP_MISSING, // its sample isn't resident for this level
+	AUDIO_EVENT_DROP_BUSY,    // every channel plays something more important
+	AUDIO_EVENT_MERGED,       // the same sound was already started this frame
+	AUDIO_EVENT_REPLACED,     // a sound waiting to start lost its channel to this one
+	AUDIO_EVENT_ACCEPT,       // got a channel, starts at the end of the frame
+	AUDIO_EVENT_START         // its channel was started
+};
+
+typedef struct
+{
+	uint32_t ticks;
+	uint32_t frame;
+	uint8_t type;
+	uint8_t sound;
+	uint8_t voice;            // 255 if none
+	uint8_t volume;
+} audio_event_t;
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t count;           // events recorded so far, the last AUDIO_TRACE_SIZE are kept
+	audio_event_t events[AUDIO_TRACE_SIZE];
+} audio_trace_t;
+
+extern audio_trace_t audio_trace;
+
+extern void Audio_Trace(uint8_t type, uint8_t sound, uint8_t voice, uint8_t volume, uint32_t frame);
+
+#endif
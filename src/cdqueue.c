@@ -0,0 +1,253 @@
+/*
+ * Gameblabla small PCFX lib Copyright 2024
+ * Licensed under MIT license
+ * See LICENSE file for more
+*/
+
+#include <string.h>
+#include "cdqueue.h"
+
+/*
+ * A request goes through these steps, each poll does the ones the drive is ready for :
+ * the command is sent, a read then waits for the data phase and takes up to
+ * CD_QUEUE_BUDGET sectors per poll, and the request is done once the drive is in the
+ * status phase and the status was read. The old code instead spun through a NOP loop
+ * after the command and then blocked on the status.
+*/
+enum
+{
+	STEP_SEND,
+	STEP_DATA,
+	STEP_STATUS
+};
+
+// SCSI bus phases, as eris_low_scsi_get_phase returns them
+#define PHASE_DATA_IN 1
+#define PHASE_STATUS 3
+
+typedef struct
+{
+	u8 type;
+	u8 cmd[10];
+	unsigned char* buf;
+	u32 left;               // bytes still to read
+	cd_queue_done_t done;
+	void* arg;
+	u32 tag;
+} cd_request_t;
+
+static cd_request_t queue[CD_QUEUE_SIZE];
+static int queue_head = 0, queue_count = 0;
+static int step = STEP_SEND;
+static int trace_pos = 0;
+
+cd_queue_stats_t cd_queue_stats;
+cd_queue_trace_t cd_queue_trace[CD_QUEUE_TRACE];
+
+#ifdef CDQ_HOST
+/*
+ * Host stand-in : there's no drive, a command keeps the bus busy for the time a 2x drive
+ * would take (a seek and then the sectors), so the timing of a trace can be replayed
+ * on a PC (tools/cdreplay.c). Reads give zeroes.
+*/
+#define HOST_SEEK_MS 120
+#define HOST_SECTORS_PER_S 300
+
+static u32 host_data_at, host_status_at, host_left;
+
+static void scsi_command(const u8 cmd[10])
+{
+	u32 sectors = (cmd[0] == 0x28) ? ((cmd[7] << 8) | cmd[8]) : 0;
+	
+	host_left = sectors * CD_QUEUE_SECTOR;
+	host_data_at = getTicks() + HOST_SEEK_MS;
+	host_status_at = host_data_at + (sectors * 1000) / HOST_SECTORS_PER_S;
+}
+
+static int scsi_phase()
+{
+	u32 now = getTicks();
+	
+	if (now < host_data_at) return -1;
+	if (host_left) return PHASE_DATA_IN;
+	if (now >= host_status_at) return PHASE_STATUS;
+	return -1;
+}
+
+static void scsi_data_in(unsigned char* buf, u32 size)
+{
+	memset(buf, 0, size);
+	host_left -= size;
+}
+
+static void scsi_status() { }
+
+#define scsi_lock()
+#define scsi_unlock()
+#else
+// the SCSI registers are in KING too
+#define scsi_lock() Present_Lock()
+#define scsi_unlock() Present_Unlock()
+#define scsi_command(cmd) eris_low_scsi_command((u8*)(cmd), 10)
+#define scsi_phase() eris_low_scsi_get_phase()
+#define scsi_data_in(buf, size) eris_low_scsi_data_in((buf), (size))
+#define scsi_status() eris_low_scsi_status()
+#endif
+
+static cd_request_t* Queue_Push(u8 type, const u8 cmd[10])
+{
+	cd_request_t* r;
+	
+	if (queue_count == CD_QUEUE_SIZE)
+	{
+		cd_queue_stats.full++;
+		return 0;
+	}
+	
+	r = &queue[(queue_head + queue_count) % CD_QUEUE_SIZE];
+	queue_count++;
+	cd_queue_stats.queued++;
+	
+	r->type = type;
+	memcpy(r->cmd, cmd, 10);
+	r->buf = 0;
+	r->left = 0;
+	r->done = 0;
+	
+	return r;
+}
+
+/* Queues a 10 byte CD-DA command (0xD8, 0xD9...). Returns -1 if the queue is full. */
+int CD_Queue_Audio(const u8 cmd[10])
+{
+	return Queue_Push(CD_QUEUE_AUDIO, cmd) ? 0 : -1;
+}
+
+/*
+ * Queues a read of size bytes from lba into buf, which has to hold whole sectors.
+ * done (if not 0) is called with arg and tag from CD_Queue_Poll once the data is there.
+*/
+int CD_Queue_Read(u32 lba, void* buf, u32 size, cd_queue_done_t done, void* arg, u32 tag)
+{
+	cd_request_t* r;
+	u8 cmd[10];
+	u32 sectors = (size + CD_QUEUE_SECTOR - 1) / CD_QUEUE_SECTOR;
+	
+	memset(cmd, 0, sizeof(cmd));
+	cmd[0] = 0x28; // READ(10)
+	cmd[2] = lba >> 24;
+	cmd[3] = lba >> 16;
+	cmd[4] = lba >> 8;
+	cmd[5] = lba;
+	cmd[7] = sectors >> 8;
+	cmd[8] = sectors;
+	
+	r = Queue_Push(CD_QUEUE_READ, cmd);
+	if (!r) return -1;
+	
+	r->buf = buf;
+	r->left = sectors * CD_QUEUE_SECTOR;
+	r->done = done;
+	r->arg = arg;
+	r->tag = tag;
+	
+	return 0;
+}
+
+static void Queue_Trace(cd_request_t* r, int completed)
+{
+	cd_queue_trace_t* t = &cd_queue_trace[trace_pos];
+	
+	if (completed)
+	{
+		t->completed = getTicks();
+		trace_pos = (trace_pos + 1) % CD_QUEUE_TRACE;
+		return;
+	}
+	
+	t->type = r->type;
+	memcpy(t->cmd, r->cmd, 10);
+	t->lba = (r->cmd[2] << 24) | (r->cmd[3] << 16) | (r->cmd[4] << 8) | r->cmd[5];
+	t->issued = getTicks();
+	t->completed = 0;
+}
+
+void CD_Queue_Poll()
+{
+	while (queue_count)
+	{
+		cd_request_t* r = &queue[queue_head];
+		int phase;
+		
+		scsi_lock();
+		
+		if (step == STEP_SEND)
+		{
+			Queue_Trace(r, 0);
+			scsi_command(r->cmd);
+			step = (r->type == CD_QUEUE_READ) ? STEP_DATA : STEP_STATUS;
+			scsi_unlock();
+			return; // the drive won't be ready before the next poll
+		}
+		
+		phase = scsi_phase();
+		
+		if (step == STEP_DATA)
+		{
+			u32 size;
+			
+			if (phase != PHASE_DATA_IN)
+			{
+				scsi_unlock();
+				cd_queue_stats.busy_polls++;
+				return;
+			}
+			
+			size = r->left > CD_QUEUE_BUDGET * CD_QUEUE_SECTOR ? CD_QUEUE_BUDGET * CD_QUEUE_SECTOR : r->left;
+			scsi_data_in(r->buf, size);
+			r->buf += size;
+			r->left -= size;
+			
+			if (r->left)
+			{
+				scsi_unlock();
+				return;
+			}
+			
+			step = STEP_STATUS;
+			phase = scsi_phase();
+		}
+		
+		if (phase != PHASE_STATUS)
+		{
+			scsi_unlock();
+			cd_queue_stats.busy_polls++;
+			return;
+		}
+		
+		scsi_status();
+		scsi_unlock();
+		
+		Queue_Trace(r, 1);
+		cd_queue_stats.completed++;
+		
+		queue_head = (queue_head + 1) % CD_QUEUE_SIZE;
+		queue_count--;
+		step = STEP_SEND;
+		
+		if (r->done)
+			r->done(r->arg, r->tag);
+	}
+}
+
+int CD_Queue_Pending()
+{
+	return queue_count;
+}
+
+/* Polls until everything queued is done, for loading at boot. */
+void CD_Queue_Flush()
+{
+	while (queue_count)
+		CD_Queue_Poll();
+}
@@ -0,0 +1,62 @@
+#ifndef CDQUEUE_H
+#define CDQUEUE_H
+
+#ifdef CDQ_HOST
+#include <stdint.h>
+typedef uint8_t u8;
+typedef uint32_t u32;
+extern int getTicks();
+#else
+#include "pcfx.h"
+#endif
+
+/*
+ * CD command queue : SCSI commands are queued and sent one after the other, CD_Queue_Poll
+ * moves them along without waiting for the drive, so it can be called once a frame.
+*/
+
+#define CD_QUEUE_SIZE 8
+#define CD_QUEUE_SECTOR 2048
+#define CD_QUEUE_BUDGET 4   // sectors read per CD_Queue_Poll
+#define CD_QUEUE_TRACE 32
+
+enum
+{
+	CD_QUEUE_AUDIO,         // CD-DA command, nothing to read back
+	CD_QUEUE_READ           // data read into RAM
+};
+
+// called by CD_Queue_Poll once a read is done
+typedef void (*cd_queue_done_t)(void* arg, u32 tag);
+
+typedef struct
+{
+	u8 type;
+	u8 cmd[10];
+	u32 lba;
+	u32 issued;             // ticks
+	u32 completed;
+} cd_queue_trace_t;
+
+typedef struct
+{
+	u32 queued;
+	u32 completed;
+	u32 full;               // commands dropped because the queue was full
+	u32 busy_polls;         // polls that found the drive still busy
+} cd_queue_stats_t;
+
+extern cd_queue_stats_t cd_queue_stats;
+extern cd_queue_trace_t cd_queue_trace[CD_QUEUE_TRACE];
+
+extern int CD_Queue_Audio(const u8 cmd[10]);
+
+extern int CD_Queue_Read(u32 lba, void* buf, u32 size, cd_queue_done_t done, void* arg, u32 tag);
+
+extern void CD_Queue_Poll();
+
+extern int CD_Queue_Pending();
+
+extern void CD_Queue_Flush();
+
+#endif
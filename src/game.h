@@ -74,6 +74,26 @@
   #define SFG_CPU_LOAD(percent) {} ///< Can be redefined to check CPU load in %.
 #endif
 
+#ifndef SFG_AI_STATS
+  #define SFG_AI_STATS(updated,lag) {} /**< Can be redefined to see how many
+                                   monsters SFG_AI_SCHEDULER updated this frame
+                                   and how many frames late the most delayed
+                                   one is. */
+#endif
+
+#ifndef SFG_SNAPSHOT_STATS
+  #define SFG_SNAPSHOT_STATS(bytes,count) {} /**< Can be redefined to see the
+                                   size of the delta SFG_SNAPSHOTS stored for
+                                   this step and how many steps can be rewound
+                                   now. */
+#endif
+
+#ifndef SFG_SOUND_TRACE
+  #define SFG_SOUND_TRACE(soundIndex,volume,dropped) {} /**< Can be redefined to
+                                   see every sound the game asks for, dropped is
+                                   1 if it was already played this frame. */
+#endif
+
 #ifndef SFG_GAME_STEP_COMMAND
   #define SFG_GAME_STEP_COMMAND {} /**< Will be called each simlation step (good
                                    for creating deterministic behavior such as
@@ -150,6 +170,7 @@ void SFG_setMusic(uint8_t value);
 #define SFG_EVENT_EXPLOSION 7
 #define SFG_EVENT_PLAYER_TELEPORTS 8
 #define SFG_EVENT_PLAYER_CHANGES_WEAPON 9
+#define SFG_EVENT_HUD_CHANGED 10 ///< only with SFG_HUD_LAYER, HUD was redrawn
 
 /**
   This is an optional function that informs the frontend about special events
@@ -158,6 +179,37 @@ void SFG_setMusic(uint8_t value);
 */
 void SFG_processEvent(uint8_t event, uint8_t data);
 
+#define SFG_WEAPON_OVERLAY_HIDE 255
+#define SFG_WEAPON_OVERLAY_NO_FLASH -32768
+
+/**
+  Only has to be implemented with SFG_HARDWARE_WEAPON, otherwise it's never
+  called. Tells the frontend where to show the weapon (index to
+  SFG_weaponImages, SFG_WEAPON_OVERLAY_HIDE = don't show it) in game pixels, and
+  the y position of the fire flash (image 0 of SFG_effectSprites) which shares
+  the weapon's x position (SFG_WEAPON_OVERLAY_NO_FLASH = no flash). The weapon
+  images are scaled by SFG_WEAPON_IMAGE_SCALE. It is called each frame that
+  draws the 3D view, and once with SFG_WEAPON_OVERLAY_HIDE when the 3D view stops
+  being shown.
+*/
+void SFG_setWeaponOverlay(uint8_t weapon, int16_t x, int16_t y,
+  int16_t flashY);
+
+#define SFG_PALETTE_EFFECT_NONE 0
+#define SFG_PALETTE_EFFECT_HURT 1
+#define SFG_PALETTE_EFFECT_ITEM 2
+#define SFG_PALETTE_EFFECT_DEATH 3
+
+/**
+  Only has to be implemented with SFG_PALETTE_EFFECTS, otherwise it's never
+  called. Tells the frontend to show given palette effect (see
+  SFG_PALETTE_EFFECT_*) with given strength (0 to 255), e.g. by tinting the
+  palette. It is called each frame that draws the 3D view and with
+  SFG_PALETTE_EFFECT_NONE when the 3D view stops being shown, so the same value
+  will usually come many times in a row.
+*/
+void SFG_setPaletteEffect(uint8_t effect, uint8_t strength);
+
 #define SFG_SAVE_SIZE 12 ///< size of the save in bytes
 
 /**
@@ -198,6 +250,25 @@ uint8_t SFG_mainLoopBody();
 */
 void SFG_init();
 
+/**
+  State of the current run as seen from outside, e.g. by a headless frontend
+  (SFG_HEADLESS) checking how a scripted run is going.
+*/
+typedef struct
+{
+  uint8_t levelNumber;
+  uint8_t health;        ///< player health, 0 means dead
+  uint8_t kills;         ///< monsters killed in the current level
+  uint8_t monsters;      ///< all monsters in the current level
+  uint8_t levelWon;      ///< 1 once the level has been completed
+  uint32_t steps;        ///< simulation steps since SFG_init()
+} SFG_RunState;
+
+/**
+  Fills in the state of the current run.
+*/
+void SFG_getRunState(SFG_RunState *state);
+
 #include "settings.h"
 
 #if SFG_AVR
@@ -215,11 +286,38 @@ void SFG_init();
 #include "texts.h"
 #include "palette.h"
 
+#if SFG_LEVEL_PACK
+/**
+  Only has to be implemented with SFG_LEVEL_PACK, otherwise it's never called.
+  Returns given level (0 to SFG_NUMBER_OF_LEVELS - 1), loaded by the frontend
+  into memory it owns, or 0 if it isn't loaded yet, in which case the function
+  will be called again later. The level only has to stay valid until the next
+  call, or with SFG_LEVEL_PREFETCH until the call after it (the next level is
+  loaded while the current one is still being played).
+*/
+const SFG_Level *SFG_loadLevel(uint8_t levelNumber);
+#endif
+
+#if SFG_RENDER_THREADS > 1
+/**
+  Only has to be implemented with SFG_RENDER_THREADS > 1. Has to call
+  drawPart(0) to drawPart(SFG_RENDER_THREADS - 1), each exactly once, in any
+  order and possibly at the same time from different threads, and return when
+  all of them have finished.
+*/
+void SFG_drawInParallel(void (*drawPart)(uint8_t part));
+
+  #if SFG_BACKGROUND_BLUR != 0
+    #error "SFG_BACKGROUND_BLUR can't be used with SFG_RENDER_THREADS"
+  #endif
+#endif
+
 #if SFG_TEXTURE_DISTANCE == 0
   #define RCL_COMPUTE_WALL_TEXCOORDS 0
 #endif
 
 #define RCL_PIXEL_FUNCTION SFG_pixelFunc
+#define RCL_THREAD_LOCAL SFG_THREAD_LOCAL
 #define RCL_TEXTURE_VERTICAL_STRETCH 0
 
 #define RCL_CAMERA_COLL_HEIGHT_BELOW 800
@@ -349,7 +447,7 @@ typedef struct
   Groups global variables related to the game as such in a single struct. There
   are still other global structs for player, level etc.
 */
-struct
+SFG_THREAD_LOCAL struct
 {
   uint8_t state;                 ///< Current game state.
   uint32_t stateTime;            ///< Time in ms from last state change.
@@ -408,6 +506,15 @@ struct
          6  32b little endian total play time, in 10ths of sec
          10 16b little endian total enemies killed from start */
   uint8_t continues;  ///< Whether the game continues or was exited.
+#if SFG_HUD_LAYER
+  uint32_t hudKey;    ///< What the HUD currently shows, see SFG_hudKey().
+  uint8_t hudShown;   /**< Whether the last drawn frame showed the 3D view with
+                           the HUD. If 0, the HUD will be redrawn in the next
+                           frame that shows it. */
+#endif
+#if SFG_HARDWARE_WEAPON
+  uint8_t weaponShown; ///< Whether the weapon overlay is currently shown.
+#endif
 } SFG_game;
 
 #define SFG_SAVE_TOTAL_TIME (SFG_game.save[6] + SFG_game.save[7] * 256 + \
@@ -416,7 +523,7 @@ struct
 /**
   Stores player state.
 */
-struct
+SFG_THREAD_LOCAL struct
 {
   RCL_Camera camera;
   int8_t squarePosition[2];
@@ -443,7 +550,7 @@ struct
 /**
   Stores the current level and helper precomputed values for better performance.
 */
-struct
+typedef struct
 {
   const SFG_Level *levelPointer;
   uint8_t levelNumber;
@@ -477,7 +584,42 @@ struct
   uint8_t itemCollisionMap[(SFG_MAP_SIZE * SFG_MAP_SIZE) / 8];
                           /**< Bit array, for each map square says whether there
                                is a colliding item or not. */
-} SFG_currentLevel;
+} SFG_LevelState;
+
+#if SFG_LEVEL_PREFETCH
+/**
+  Two level states, the one being played and the one the next level is
+  prefetched into while the win animation or the intro is shown. Starting the
+  prefetched level just swaps them (see SFG_setAndInitLevel).
+*/
+SFG_THREAD_LOCAL SFG_LevelState SFG_levelStates[2];
+SFG_THREAD_LOCAL SFG_LevelState *SFG_currentLevelState; ///< set by SFG_init
+
+#define SFG_currentLevel (*SFG_currentLevelState)
+#define SFG_prefetchedLevel \
+  SFG_levelStates[SFG_currentLevelState == SFG_levelStates]
+#else
+SFG_THREAD_LOCAL SFG_LevelState SFG_currentLevel;
+#endif
+
+#define SFG_LEVEL_PREPARATION_LOAD 0
+#define SFG_LEVEL_PREPARATION_DOORS 1
+#define SFG_LEVEL_PREPARATION_ELEMENTS 2
+#define SFG_LEVEL_PREPARATION_DONE 3
+
+/**
+  Level being prepared by SFG_prepareLevel, which can be spread over several
+  frames (see SFG_LEVEL_PREFETCH).
+*/
+SFG_THREAD_LOCAL struct
+{
+  SFG_LevelState *level;  ///< where the level is being prepared, 0 = nowhere
+  uint8_t levelNumber;
+  uint8_t step;           ///< SFG_LEVEL_PREPARATION_*
+  uint8_t index;          ///< map row or level element the step is at
+  uint8_t startAsked;     /**< with SFG_LEVEL_PREFETCH, 1 if the intro was
+                               skipped before the level was ready */
+} SFG_levelPreparation;
 
 #if SFG_AVR
 /**
@@ -520,6 +662,350 @@ uint8_t SFG_getItemCollisionMapBit(uint8_t x, uint8_t y)
   return (SFG_currentLevel.itemCollisionMap[byte] >> bit) & 0x01;
 }
 
+#define SFG_GRID_CELL_SQUARES 4
+#define SFG_GRID_SIZE (SFG_MAP_SIZE / SFG_GRID_CELL_SQUARES)
+#define SFG_GRID_NONE 255
+#define SFG_GRID_NO_CELL 0xffff
+
+/**
+  Coarse grid over the map telling which monsters and items are in which cell,
+  so that collision queries (SFG_gridMonstersNear, SFG_gridItemsNear) only look
+  at the nearby ones. Each cell has a linked list of monster indices and one of
+  level element indices (items never move).
+*/
+SFG_THREAD_LOCAL struct
+{
+  uint8_t monsterHeads[SFG_GRID_SIZE * SFG_GRID_SIZE];
+  uint8_t monsterNext[SFG_MAX_MONSTERS];
+  uint16_t monsterCells[SFG_MAX_MONSTERS]; ///< SFG_GRID_NO_CELL = not in grid
+  uint8_t itemHeads[SFG_GRID_SIZE * SFG_GRID_SIZE];
+  uint8_t itemNext[SFG_MAX_LEVEL_ELEMENTS];
+  uint8_t itemRecordIndices[SFG_MAX_LEVEL_ELEMENTS]; /**< for each level
+                          element its index in itemRecords, SFG_GRID_NONE if
+                          it's not an item or has been removed */
+} SFG_grid;
+
+static inline uint16_t SFG_gridMonsterCell(const SFG_MonsterRecord *monster)
+{
+  // monster coords are in 1/4 squares
+  return (monster->coords[1] / (4 * SFG_GRID_CELL_SQUARES)) * SFG_GRID_SIZE +
+    monster->coords[0] / (4 * SFG_GRID_CELL_SQUARES);
+}
+
+void SFG_gridRemoveMonster(uint8_t index)
+{
+  uint16_t cell = SFG_grid.monsterCells[index];
+
+  if (cell == SFG_GRID_NO_CELL)
+    return;
+
+  uint8_t *link = &(SFG_grid.monsterHeads[cell]);
+
+  while (*link != index)
+    link = &(SFG_grid.monsterNext[*link]);
+
+  *link = SFG_grid.monsterNext[index];
+  SFG_grid.monsterCells[index] = SFG_GRID_NO_CELL;
+}
+
+/**
+  Puts the monster into the cell it's currently in, to be called whenever it
+  moves.
+*/
+void SFG_gridUpdateMonster(uint8_t index)
+{
+  uint16_t cell =
+    SFG_gridMonsterCell(&(SFG_currentLevel.monsterRecords[index]));
+
+  if (cell == SFG_grid.monsterCells[index])
+    return;
+
+  SFG_gridRemoveMonster(index);
+
+  SFG_grid.monsterNext[index] = SFG_grid.monsterHeads[cell];
+  SFG_grid.monsterHeads[cell] = index;
+  SFG_grid.monsterCells[index] = cell;
+}
+
+/**
+  Builds the grid for the current level, to be called when it's set.
+*/
+void SFG_gridInit()
+{
+  for (uint16_t i = 0; i < SFG_GRID_SIZE * SFG_GRID_SIZE; ++i)
+  {
+    SFG_grid.monsterHeads[i] = SFG_GRID_NONE;
+    SFG_grid.itemHeads[i] = SFG_GRID_NONE;
+  }
+
+  for (uint8_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+  {
+    SFG_grid.monsterCells[i] = SFG_GRID_NO_CELL;
+
+    if (SFG_MR_STATE(SFG_currentLevel.monsterRecords[i]) !=
+      SFG_MONSTER_STATE_DEAD)
+      SFG_gridUpdateMonster(i);
+  }
+
+  for (uint8_t i = 0; i < SFG_MAX_LEVEL_ELEMENTS; ++i)
+    SFG_grid.itemRecordIndices[i] = SFG_GRID_NONE;
+
+  for (uint8_t i = 0; i < SFG_currentLevel.itemRecordCount; ++i)
+  {
+    uint8_t element =
+      SFG_currentLevel.itemRecords[i] & ~SFG_ITEM_RECORD_ACTIVE_MASK;
+
+    const SFG_LevelElement *e =
+      &(SFG_currentLevel.levelPointer->elements[element]);
+
+    uint16_t cell = (e->coords[1] / SFG_GRID_CELL_SQUARES) * SFG_GRID_SIZE +
+      e->coords[0] / SFG_GRID_CELL_SQUARES;
+
+    SFG_grid.itemNext[element] = SFG_grid.itemHeads[cell];
+    SFG_grid.itemHeads[cell] = element;
+    SFG_grid.itemRecordIndices[element] = i;
+  }
+}
+
+/**
+  Helper, gets the range of grid cells (inclusive) that the square of given
+  half size around given point (in RCL_Units) touches.
+*/
+void SFG_gridCellRange(RCL_Unit x, RCL_Unit y, RCL_Unit radius, uint8_t *from,
+  uint8_t *to)
+{
+  RCL_Unit cellSize = SFG_GRID_CELL_SQUARES * RCL_UNITS_PER_SQUARE;
+
+  from[0] = RCL_clamp((x - radius) / cellSize,0,SFG_GRID_SIZE - 1);
+  from[1] = RCL_clamp((y - radius) / cellSize,0,SFG_GRID_SIZE - 1);
+  to[0] = RCL_clamp((x + radius) / cellSize,0,SFG_GRID_SIZE - 1);
+  to[1] = RCL_clamp((y + radius) / cellSize,0,SFG_GRID_SIZE - 1);
+}
+
+/**
+  Helper, sorts the indices gathered from the grid so that queries visit things
+  in the same order as a loop over all records would.
+*/
+void SFG_gridSortResult(uint8_t *result, uint8_t count)
+{
+  for (uint8_t i = 1; i < count; ++i)
+  {
+    uint8_t v = result[i];
+    uint8_t j = i;
+
+    while (j > 0 && result[j - 1] > v)
+    {
+      result[j] = result[j - 1];
+      j--;
+    }
+
+    result[j] = v;
+  }
+}
+
+/**
+  Writes indices (ascending) of the monsters that can be within given taxicab
+  distance from given point into result (which has to hold SFG_MAX_MONSTERS
+  items) and returns their count. The monsters' states aren't checked. 
+*/
+uint8_t SFG_gridMonstersNear(RCL_Unit x, RCL_Unit y, RCL_Unit radius,
+  uint8_t *result)
+{
+  uint8_t from[2], to[2], count = 0;
+
+  SFG_gridCellRange(x,y,radius,from,to);
+
+  for (uint8_t j = from[1]; j <= to[1]; ++j)
+    for (uint8_t i = from[0]; i <= to[0]; ++i)
+    {
+      uint8_t index = SFG_grid.monsterHeads[j * SFG_GRID_SIZE + i];
+
+      while (index != SFG_GRID_NONE)
+      {
+        result[count] = index;
+        count++;
+        index = SFG_grid.monsterNext[index];
+      }
+    }
+
+  SFG_gridSortResult(result,count);
+
+  return count;
+}
+
+/**
+  Same as SFG_gridMonstersNear but for items, gives level element indices (get
+  the item record index with SFG_grid.itemRecordIndices). Result has to hold
+  SFG_MAX_LEVEL_ELEMENTS items.
+*/
+uint8_t SFG_gridItemsNear(RCL_Unit x, RCL_Unit y, RCL_Unit radius,
+  uint8_t *result)
+{
+  uint8_t from[2], to[2], count = 0;
+
+  SFG_gridCellRange(x,y,radius,from,to);
+
+  for (uint8_t j = from[1]; j <= to[1]; ++j)
+    for (uint8_t i = from[0]; i <= to[0]; ++i)
+    {
+      uint8_t element = SFG_grid.itemHeads[j * SFG_GRID_SIZE + i];
+
+      while (element != SFG_GRID_NONE)
+      {
+        if (SFG_grid.itemRecordIndices[element] != SFG_GRID_NONE)
+        {
+          result[count] = element;
+          count++;
+        }
+
+        element = SFG_grid.itemNext[element];
+      }
+    }
+
+  SFG_gridSortResult(result,count);
+
+  return count;
+}
+
+/**
+  Indices (ascending) of the monsters that aren't inactive and level element
+  indices (ascending) of the active items, i.e. those near the player, kept
+  up to date at the points where they get (de)activated so that per frame loops
+  don't have to go through all the records.
+*/
+SFG_THREAD_LOCAL struct
+{
+  uint8_t monsters[SFG_MAX_MONSTERS];
+  uint8_t monsterCount;
+  uint8_t items[SFG_MAX_ITEMS];
+  uint8_t itemCount;
+} SFG_active;
+
+#if SFG_AI_SCHEDULER
+/**
+  State of spreading the monster AI updates over frames, see SFG_scheduleAI.
+*/
+SFG_THREAD_LOCAL struct
+{
+  uint8_t lastUpdate[SFG_MAX_MONSTERS]; ///< frame (low 8 bits) of last update
+  uint8_t next;      ///< position in SFG_active.monsters to continue from
+} SFG_aiScheduler;
+#endif
+
+/**
+  Inserts value into given sorted list if it's not there.
+*/
+void SFG_activeListAdd(uint8_t *list, uint8_t *count, uint8_t value)
+{
+  uint8_t i = 0;
+
+  while (i < *count && list[i] < value)
+    i++;
+
+  if (i < *count && list[i] == value)
+    return; // already there
+
+  for (uint8_t j = *count; j > i; --j)
+    list[j] = list[j - 1];
+
+  list[i] = value;
+  (*count)++;
+}
+
+void SFG_activeListRemove(uint8_t *list, uint8_t *count, uint8_t value)
+{
+  for (uint8_t i = 0; i < *count; ++i)
+    if (list[i] == value)
+    {
+      (*count)--;
+
+      for (; i < *count; ++i)
+        list[i] = list[i + 1];
+
+      break;
+    }
+}
+
+/**
+  Builds the active lists from the current level's records.
+*/
+void SFG_activeInit()
+{
+  SFG_active.monsterCount = 0;
+  SFG_active.itemCount = 0;
+
+  for (uint8_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+    if (SFG_MR_STATE(SFG_currentLevel.monsterRecords[i]) !=
+      SFG_MONSTER_STATE_INACTIVE)
+    {
+      SFG_active.monsters[SFG_active.monsterCount] = i;
+      SFG_active.monsterCount++;
+    }
+
+  for (uint8_t i = 0; i < SFG_currentLevel.itemRecordCount; ++i)
+    if (SFG_currentLevel.itemRecords[i] & SFG_ITEM_RECORD_ACTIVE_MASK)
+    {
+      SFG_active.items[SFG_active.itemCount] =
+        SFG_currentLevel.itemRecords[i] & ~SFG_ITEM_RECORD_ACTIVE_MASK;
+      SFG_active.itemCount++;
+    }
+}
+
+#if SFG_MONSTER_FLOW_FIELD
+#define SFG_FLOW_FIELD_UNKNOWN 255
+
+/**
+  Distances (in squares, walking) of map squares to the player's square, for
+  the monsters that walk towards the player. A new field is computed by BFS
+  whenever the player moves to another square, SFG_FLOW_FIELD_BUDGET squares
+  per frame, while the monsters keep using the last complete one.
+*/
+SFG_THREAD_LOCAL struct
+{
+  uint8_t distances[2][SFG_MAP_SIZE * SFG_MAP_SIZE];
+  uint8_t ready;          ///< which distances are complete, 255 = none yet
+  uint8_t target[2];      ///< square the field being computed leads to
+  uint16_t queue[SFG_MAP_SIZE * SFG_MAP_SIZE];
+  uint16_t queueStart;
+  uint16_t queueEnd;
+} SFG_flowField;
+
+void SFG_flowFieldInit()
+{
+  SFG_flowField.ready = 255;
+  SFG_flowField.target[0] = 255; // forces a new computation
+  SFG_flowField.queueStart = 0;
+  SFG_flowField.queueEnd = 0;
+}
+#endif
+
+#if SFG_INTERPOLATION
+/**
+  State from before the last simulation step, for drawing frames in between
+  steps (SFG_drawInterpolated).
+*/
+SFG_THREAD_LOCAL struct
+{
+  RCL_Vector2D cameraPosition;
+  RCL_Unit cameraHeight;
+  RCL_Unit cameraDirection;
+  uint8_t monsterCoords[SFG_MAX_MONSTERS][2]; ///< before the last move
+  uint8_t monsterMoveFrames[SFG_MAX_MONSTERS]; /**< frame (low 8 bits) of the
+                                                    last move */
+  uint8_t monsterMoveGaps[SFG_MAX_MONSTERS]; /**< frames between the last two
+                                                  moves, what the last move is
+                                                  drawn over */
+  RCL_Unit alpha;   /**< where between the last two steps the frame being
+                         drawn is, 0 to RCL_UNITS_PER_SQUARE */
+} SFG_interpolation;
+
+static inline RCL_Unit SFG_interpolate(RCL_Unit from, RCL_Unit to,
+  RCL_Unit alpha)
+{
+  return from + ((to - from) * alpha) / RCL_UNITS_PER_SQUARE;
+}
+#endif
+
 #if SFG_DITHERED_SHADOW
 static const uint8_t SFG_ditheringPatterns[] =
 {
@@ -579,9 +1065,12 @@ void SFG_playGameSound(uint8_t soundIndex, uint8_t volume)
 
   if (!(SFG_game.soundsPlayedThisFrame & mask))
   {
+    SFG_SOUND_TRACE(soundIndex,volume,0);
     SFG_playSound(soundIndex,volume);
     SFG_game.soundsPlayedThisFrame |= mask;
   }
+  else
+    SFG_SOUND_TRACE(soundIndex,volume,1);
 }
 
 /**
@@ -857,7 +1346,7 @@ void SFG_recomputePLayerDirection()
 }
 
 #if SFG_BACKGROUND_BLUR != 0
-uint8_t SFG_backgroundBlurIndex = 0;
+SFG_THREAD_LOCAL uint8_t SFG_backgroundBlurIndex = 0;
 
 static const int8_t SFG_backgroundBlurOffsets[8] =
   {
@@ -1126,13 +1615,20 @@ void SFG_blitImage(
   }
 }
 
-void SFG_drawScaledSprite(
+/**
+  Draws a scaled sprite only into the screen columns from fromX up to (not
+  including) toX, with given buffer of SFG_MAX_SPRITE_SIZE sampling points.
+*/
+static inline void SFG_drawScaledSpriteColumns(
   const uint8_t *image,
   int16_t centerX,
   int16_t centerY,
   int16_t size,
   uint8_t minusValue,
-  RCL_Unit distance)
+  RCL_Unit distance,
+  int16_t fromX,
+  int16_t toX,
+  uint8_t *samplingPoints)
 {
   if (size == 0)
     return;
@@ -1147,10 +1643,10 @@ void SFG_drawScaledSprite(
 
   int16_t x0, u0;
 
-  if (topLeftX < 0)
+  if (topLeftX < fromX)
   {
-    u0 = -1 * topLeftX;
-    x0 = 0;
+    u0 = fromX - topLeftX;
+    x0 = fromX;
   }
   else
   {
@@ -1160,8 +1656,8 @@ void SFG_drawScaledSprite(
 
   int16_t x1 = topLeftX + size - 1;
 
-  if (x1 >= SFG_GAME_RESOLUTION_X)
-    x1 = SFG_GAME_RESOLUTION_X - 1;
+  if (x1 >= toX)
+    x1 = toX - 1;
 
   int16_t y0, v0;
 
@@ -1207,7 +1703,7 @@ void SFG_drawScaledSprite(
 
   for (int16_t i = precompFrom; i <= precompTo; ++i)
   {
-    SFG_game.spriteSamplingPoints[i] = precompPosScaled / PRECOMP_SCALE;
+    samplingPoints[i] = precompPosScaled / PRECOMP_SCALE;
     precompPosScaled += precompStepScaled;
   }
 
@@ -1224,8 +1720,7 @@ void SFG_drawScaledSprite(
       for (int16_t y = y0, v = v0; y <= y1; ++y, ++v)
       {
         uint8_t color =
-          SFG_getTexel(image,SFG_game.spriteSamplingPoints[u],
-            SFG_game.spriteSamplingPoints[v]);
+          SFG_getTexel(image,samplingPoints[u],samplingPoints[v]);
 
         if (color != SFG_TRANSPARENT_COLOR)
         {
@@ -1244,6 +1739,18 @@ void SFG_drawScaledSprite(
   }
 }
 
+void SFG_drawScaledSprite(
+  const uint8_t *image,
+  int16_t centerX,
+  int16_t centerY,
+  int16_t size,
+  uint8_t minusValue,
+  RCL_Unit distance)
+{
+  SFG_drawScaledSpriteColumns(image,centerX,centerY,size,minusValue,distance,
+    0,SFG_GAME_RESOLUTION_X,SFG_game.spriteSamplingPoints);
+}
+
 RCL_Unit SFG_texturesAt(int16_t x, int16_t y)
 {
   uint8_t p;
@@ -1510,52 +2017,80 @@ void SFG_setGameState(uint8_t state)
   SFG_game.stateTime = 0;
 }
 
-void SFG_setAndInitLevel(uint8_t levelNumber)
+void SFG_startLevelPreparation(uint8_t levelNumber, SFG_LevelState *level)
 {
-  SFG_LOG("setting and initializing level");
+  SFG_levelPreparation.level = level;
+  SFG_levelPreparation.levelNumber = levelNumber;
+  SFG_levelPreparation.step = SFG_LEVEL_PREPARATION_LOAD;
+  SFG_levelPreparation.index = 0;
+}
 
+/**
+  Does at most budget units of work (a unit is one map row or 8 level elements)
+  of preparing the level started with SFG_startLevelPreparation. Returns 1 once
+  the level is ready.
+*/
+uint8_t SFG_prepareLevel(uint8_t budget)
+{
+  SFG_LevelState *l = SFG_levelPreparation.level;
   const SFG_Level *level;
 
-#if SFG_AVR
-  memcpy_P(&SFG_ramLevel,SFG_levels[levelNumber],sizeof(SFG_Level));
-  level = &SFG_ramLevel;
+  if (SFG_levelPreparation.step == SFG_LEVEL_PREPARATION_LOAD)
+  {
+#if SFG_LEVEL_PACK
+    level = SFG_loadLevel(SFG_levelPreparation.levelNumber);
+
+    if (level == 0)
+      return 0; // not loaded yet
+#elif SFG_AVR
+    memcpy_P(&SFG_ramLevel,SFG_levels[SFG_levelPreparation.levelNumber],
+      sizeof(SFG_Level));
+    level = &SFG_ramLevel;
 #else
-  level = SFG_levels[levelNumber];
+    level = SFG_levels[SFG_levelPreparation.levelNumber];
 #endif
 
-  SFG_game.currentRandom = 0;
+    l->levelNumber = SFG_levelPreparation.levelNumber;
+    l->monstersDead = 0;
+    l->backgroundImage = level->backgroundImage;
+    l->levelPointer = level;
+    l->bossCount = 0;
+    l->floorColor = level->floorColor;
+    l->ceilingColor = level->ceilingColor;
+    l->completionTime10sOfS = 0;
+
+    for (uint8_t i = 0; i < 7; ++i)
+      l->textures[i] =
+        SFG_wallTextures + level->textureIndices[i] * SFG_TEXTURE_STORE_SIZE;
+
+    SFG_LOG("initializing doors");
+
+    l->checkedDoorIndex = 0;
+    l->doorRecordCount = 0;
+    l->projectileRecordCount = 0;
+    l->teleporterCount = 0;
+    l->mapRevealMask = 
+#if SFG_REVEAL_MAP
+      0xffff;
+#else
+      0;
+#endif
 
-  if (SFG_game.saved != SFG_CANT_SAVE)
-    SFG_game.saved = 0;
+    SFG_levelPreparation.step = SFG_LEVEL_PREPARATION_DOORS;
+    SFG_levelPreparation.index = 0;
+  }
 
-  SFG_currentLevel.levelNumber = levelNumber;
-  SFG_currentLevel.monstersDead = 0;
-  SFG_currentLevel.backgroundImage = level->backgroundImage;
-  SFG_currentLevel.levelPointer = level;
-  SFG_currentLevel.bossCount = 0;
-  SFG_currentLevel.floorColor = level->floorColor;
-  SFG_currentLevel.ceilingColor = level->ceilingColor;
-  SFG_currentLevel.completionTime10sOfS = 0;
+  level = l->levelPointer;
 
-  for (uint8_t i = 0; i < 7; ++i)
-    SFG_currentLevel.textures[i] =
-      SFG_wallTextures + level->textureIndices[i] * SFG_TEXTURE_STORE_SIZE;
+  while (SFG_levelPreparation.step == SFG_LEVEL_PREPARATION_DOORS)
+  {
+    if (budget == 0)
+      return 0;
 
-  SFG_LOG("initializing doors");
+    budget--;
 
-  SFG_currentLevel.checkedDoorIndex = 0;
-  SFG_currentLevel.doorRecordCount = 0;
-  SFG_currentLevel.projectileRecordCount = 0;
-  SFG_currentLevel.teleporterCount = 0;
-  SFG_currentLevel.mapRevealMask = 
-#if SFG_REVEAL_MAP
-    0xffff;
-#else
-    0;
-#endif
+    uint8_t j = SFG_levelPreparation.index;
 
-  for (uint8_t j = 0; j < SFG_MAP_SIZE; ++j)
-  {
     for (uint8_t i = 0; i < SFG_MAP_SIZE; ++i)
     {
       uint8_t properties;
@@ -1564,50 +2099,63 @@ void SFG_setAndInitLevel(uint8_t levelNumber)
 
       if ((properties & SFG_TILE_PROPERTY_MASK) == SFG_TILE_PROPERTY_DOOR)
       {
-        SFG_DoorRecord *d =
-          &(SFG_currentLevel.doorRecords[SFG_currentLevel.doorRecordCount]);
+        SFG_DoorRecord *d = &(l->doorRecords[l->doorRecordCount]);
 
         d->coords[0] = i;
         d->coords[1] = j;
         d->state = 0x00;
 
-        SFG_currentLevel.doorRecordCount++;
+        l->doorRecordCount++;
       }
 
-      if (SFG_currentLevel.doorRecordCount >= SFG_MAX_DOORS)
+      if (l->doorRecordCount >= SFG_MAX_DOORS)
       {
         SFG_LOG("warning: too many doors!");
         break;
       }
     }
 
-    if (SFG_currentLevel.doorRecordCount >= SFG_MAX_DOORS)
-      break;
-  }
+    SFG_levelPreparation.index++;
 
-  SFG_LOG("initializing level elements");
+    if (l->doorRecordCount >= SFG_MAX_DOORS ||
+      SFG_levelPreparation.index >= SFG_MAP_SIZE)
+    {
+      SFG_LOG("initializing level elements");
 
-  SFG_currentLevel.itemRecordCount = 0;
-  SFG_currentLevel.checkedItemIndex = 0;
+      l->itemRecordCount = 0;
+      l->checkedItemIndex = 0;
 
-  SFG_currentLevel.monsterRecordCount = 0;
-  SFG_currentLevel.checkedMonsterIndex = 0;
+      l->monsterRecordCount = 0;
+      l->checkedMonsterIndex = 0;
 
-  SFG_MonsterRecord *monster;
+      for (uint16_t i = 0; i < ((SFG_MAP_SIZE * SFG_MAP_SIZE) / 8); ++i)
+        l->itemCollisionMap[i] = 0;
 
-  for (uint16_t i = 0; i < ((SFG_MAP_SIZE * SFG_MAP_SIZE) / 8); ++i)
-    SFG_currentLevel.itemCollisionMap[i] = 0;
+      SFG_levelPreparation.step = SFG_LEVEL_PREPARATION_ELEMENTS;
+      SFG_levelPreparation.index = 0;
+    }
+  }
 
-  for (uint8_t i = 0; i < SFG_MAX_LEVEL_ELEMENTS; ++i)
+  while (SFG_levelPreparation.step == SFG_LEVEL_PREPARATION_ELEMENTS)
   {
-    const SFG_LevelElement *e = &(SFG_currentLevel.levelPointer->elements[i]);
+    if (budget == 0)
+      return 0;
 
-    if (e->type != SFG_LEVEL_ELEMENT_NONE)
+    budget--;
+
+    uint8_t end = SFG_levelPreparation.index + 8;
+
+    for (uint8_t i = SFG_levelPreparation.index; i < end; ++i)
     {
+      const SFG_LevelElement *e = &(level->elements[i]);
+
+      if (e->type == SFG_LEVEL_ELEMENT_NONE)
+        continue;
+
       if (SFG_LEVEL_ELEMENT_TYPE_IS_MOSTER(e->type))
       {
-        monster =
-        &(SFG_currentLevel.monsterRecords[SFG_currentLevel.monsterRecordCount]);
+        SFG_MonsterRecord *monster =
+          &(l->monsterRecords[l->monsterRecordCount]);
 
         monster->stateType = (SFG_MONSTER_TYPE_TO_INDEX(e->type) << 4)
           | SFG_MONSTER_STATE_INACTIVE;
@@ -1618,22 +2166,28 @@ void SFG_setAndInitLevel(uint8_t levelNumber)
         monster->coords[0] = e->coords[0] * 4 + 2;
         monster->coords[1] = e->coords[1] * 4 + 2;
 
-        SFG_currentLevel.monsterRecordCount++;
+        l->monsterRecordCount++;
 
         if (e->type == SFG_LEVEL_ELEMENT_MONSTER_ENDER)
-          SFG_currentLevel.bossCount++;
+          l->bossCount++;
       }
       else if ((e->type < SFG_LEVEL_ELEMENT_LOCK0) ||
         (e->type > SFG_LEVEL_ELEMENT_LOCK2))
       {
-        SFG_currentLevel.itemRecords[SFG_currentLevel.itemRecordCount] = i;
-        SFG_currentLevel.itemRecordCount++;
+        l->itemRecords[l->itemRecordCount] = i;
+        l->itemRecordCount++;
 
         if (e->type == SFG_LEVEL_ELEMENT_TELEPORTER)
-          SFG_currentLevel.teleporterCount++;
+          l->teleporterCount++;
 
         if (SFG_itemCollides(e->type))
-          SFG_setItemCollisionMapBit(e->coords[0],e->coords[1],1);
+        {
+          uint16_t byte;
+          uint8_t bit;
+
+          SFG_getItemCollisionMapIndex(e->coords[0],e->coords[1],&byte,&bit);
+          l->itemCollisionMap[byte] |= 0x01 << bit;
+        }
       }
       else
       {
@@ -1644,9 +2198,9 @@ void SFG_setAndInitLevel(uint8_t levelNumber)
         if ((properties & SFG_TILE_PROPERTY_MASK) == SFG_TILE_PROPERTY_DOOR)
         {
           // find the door record and lock the door:
-          for (uint16_t j = 0; j < SFG_currentLevel.doorRecordCount; ++j)
+          for (uint16_t j = 0; j < l->doorRecordCount; ++j)
           {
-            SFG_DoorRecord *d = &(SFG_currentLevel.doorRecords[j]);
+            SFG_DoorRecord *d = &(l->doorRecords[j]);
 
             if (d->coords[0] == e->coords[0] && d->coords[1] == e->coords[1])
             {
@@ -1661,17 +2215,365 @@ void SFG_setAndInitLevel(uint8_t levelNumber)
         }
       }
     }
-  } 
 
-  SFG_currentLevel.timeStart = SFG_game.frameTime; 
-  SFG_currentLevel.frameStart = SFG_game.frame;
+    SFG_levelPreparation.index = end;
 
-  SFG_game.spriteAnimationFrame = 0;
+    if (end >= SFG_MAX_LEVEL_ELEMENTS)
+      SFG_levelPreparation.step = SFG_LEVEL_PREPARATION_DONE;
+  }
 
-  SFG_initPlayer();
-  SFG_setGameState(SFG_GAME_STATE_LEVEL_START);
-  SFG_setMusic(SFG_MUSIC_NEXT);
+  return 1;
+}
+
+#if SFG_LEVEL_PREFETCH
+/**
+  Advances preparing given level into SFG_prefetchedLevel by
+  SFG_LEVEL_PREFETCH_BUDGET, to be called each frame while the game waits.
+  Returns 1 once the level is ready, starting it then doesn't wait at all.
+*/
+uint8_t SFG_prefetchLevel(uint8_t levelNumber)
+{
+  if (SFG_levelPreparation.level != &SFG_prefetchedLevel ||
+    SFG_levelPreparation.levelNumber != levelNumber)
+    SFG_startLevelPreparation(levelNumber,&SFG_prefetchedLevel);
+
+  return SFG_prepareLevel(SFG_LEVEL_PREFETCH_BUDGET);
+}
+#endif
+
+#if SFG_INPUT_RECORDS
+#define SFG_INPUT_RECORD_VERSION 1 ///< Raise when the record format changes.
+
+#define SFG_INPUT_RECORD_OFF 0
+#define SFG_INPUT_RECORD_ARMED 1     ///< recording from the next level start
+#define SFG_INPUT_RECORD_RECORDING 2
+#define SFG_INPUT_RECORD_PLAYING 3
+
+/**
+  Size of the input record header: version, level number, settings, cheat
+  state, frame of the level start (4 bytes), frames since then, state time (4
+  bytes), player health, ammo (3 bytes), weapon and key states, as they are at
+  the first recorded step, i.e. whatever besides the keys decides how the level
+  goes on. Multi-byte values are little endian.
+*/
+#define SFG_INPUT_RECORD_HEADER_SIZE (21 + SFG_KEY_COUNT)
+
+/**
+  Input record with SFG_INPUT_RECORDS: the keys pressed in each game step since
+  a level start (SFG_stepKeys). After the header come runs of 3 bytes: number
+  of steps (1 to 255) and the keys held in them (2 bytes, bit n = key n), a run
+  of 0 steps ends the record. Levels started later (next level, restart after
+  death) are just played on, they're deterministic. The mouse isn't recorded
+  and is ignored during playback.
+*/
+SFG_THREAD_LOCAL struct
+{
+  uint8_t mode;              ///< one of SFG_INPUT_RECORD_*
+  uint8_t *record;           ///< record being recorded
+  const uint8_t *playback;   ///< record being played back
+  uint32_t size;             ///< size of the record (buffer)
+  uint32_t position;         ///< where the next run goes or comes from
+  uint32_t length;           ///< size of the last finished record, 0 = none
+  uint16_t keys;             ///< keys of the current run
+  uint8_t steps;             ///< steps recorded or left in the current run
+  uint8_t settings;          ///< SFG_game.settings from before the playback
+} SFG_inputRecord;
+#endif
+
+void SFG_setAndInitLevel(uint8_t levelNumber)
+{
+  SFG_LOG("setting and initializing level");
+
+  SFG_game.currentRandom = 0;
+
+  if (SFG_game.saved != SFG_CANT_SAVE)
+    SFG_game.saved = 0;
+
+#if SFG_LEVEL_PREFETCH
+  if (SFG_levelPreparation.level != &SFG_prefetchedLevel ||
+    SFG_levelPreparation.levelNumber != levelNumber)
+    SFG_startLevelPreparation(levelNumber,&SFG_prefetchedLevel);
+
+  /* The win animation and the intro only start the level once it's prefetched,
+     this only waits for levels started right away (menu, restart, load). */
+  while (!SFG_prepareLevel(255))
+  {
+  }
+
+  SFG_currentLevelState = &SFG_prefetchedLevel;
+  SFG_levelPreparation.level = 0;
+  SFG_levelPreparation.startAsked = 0;
+#else
+  SFG_startLevelPreparation(levelNumber,&SFG_currentLevel);
+
+  while (!SFG_prepareLevel(255))
+  {
+  }
+#endif
+
+  SFG_gridInit();
+  SFG_activeInit();
+
+#if SFG_AI_SCHEDULER
+  SFG_aiScheduler.next = 0; // the same start whatever was played before
+#endif
+
+#if SFG_INTERPOLATION
+  for (uint8_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+  {
+    SFG_interpolation.monsterCoords[i][0] =
+      SFG_currentLevel.monsterRecords[i].coords[0];
+    SFG_interpolation.monsterCoords[i][1] =
+      SFG_currentLevel.monsterRecords[i].coords[1];
+    SFG_interpolation.monsterMoveFrames[i] =
+      SFG_game.frame - SFG_AI_UPDATE_FRAME_INTERVAL;
+    SFG_interpolation.monsterMoveGaps[i] = SFG_AI_UPDATE_FRAME_INTERVAL;
+  }
+#endif
+
+#if SFG_MONSTER_FLOW_FIELD
+  SFG_flowFieldInit();
+#endif
+
+  SFG_currentLevel.timeStart = SFG_game.frameTime; 
+  SFG_currentLevel.frameStart = SFG_game.frame;
+
+  SFG_game.spriteAnimationFrame = 0;
+
+  SFG_initPlayer();
+  SFG_setGameState(SFG_GAME_STATE_LEVEL_START);
+  SFG_setMusic(SFG_MUSIC_NEXT);
   SFG_processEvent(SFG_EVENT_LEVEL_STARTS,levelNumber);
+
+#if SFG_INPUT_RECORDS
+  if (SFG_inputRecord.mode == SFG_INPUT_RECORD_ARMED)
+    SFG_inputRecord.mode = SFG_INPUT_RECORD_RECORDING; // header at next step
+#endif
+}
+
+#if SFG_INPUT_RECORDS
+void SFG_inputRecordWriteU32(uint8_t *data, uint32_t value)
+{
+  for (uint8_t i = 0; i < 4; ++i)
+  {
+    data[i] = value & 0xff;
+    value >>= 8;
+  }
+}
+
+uint32_t SFG_inputRecordReadU32(const uint8_t *data)
+{
+  return data[0] | (((uint32_t) data[1]) << 8) |
+    (((uint32_t) data[2]) << 16) | (((uint32_t) data[3]) << 24);
+}
+
+/**
+  Starts recording the keys into given memory from the next level start (also
+  if the level is started from SFG_EVENT_LEVEL_STARTS), replacing what was
+  being recorded or played back.
+*/
+void SFG_recordInput(uint8_t *record, uint32_t size)
+{
+  SFG_inputRecord.mode = SFG_INPUT_RECORD_ARMED;
+  SFG_inputRecord.record = record;
+  SFG_inputRecord.size = size;
+  SFG_inputRecord.position = 0;
+  SFG_inputRecord.length = 0;
+  SFG_inputRecord.steps = 0;
+}
+
+/**
+  Ends the record with the end run, recording stops.
+*/
+void SFG_finishInputRecord()
+{
+  uint8_t *r = SFG_inputRecord.record + SFG_inputRecord.position;
+
+  if (SFG_inputRecord.steps != 0)
+  {
+    r[0] = SFG_inputRecord.steps;
+    r[1] = SFG_inputRecord.keys & 0xff;
+    r[2] = SFG_inputRecord.keys >> 8;
+    r += 3;
+  }
+
+  *r = 0;
+
+  SFG_inputRecord.length = r + 1 - SFG_inputRecord.record;
+  SFG_inputRecord.mode = SFG_INPUT_RECORD_OFF;
+}
+
+/**
+  Stops recording or playing back, returns the size of the record made since
+  the last SFG_recordInput(), or 0 if there is none (e.g. no level started
+  since). A record whose memory got full ends early and is returned as well.
+*/
+uint32_t SFG_stopInput()
+{
+  if (SFG_inputRecord.mode == SFG_INPUT_RECORD_RECORDING &&
+    SFG_inputRecord.position != 0)
+    SFG_finishInputRecord();
+
+  if (SFG_inputRecord.mode == SFG_INPUT_RECORD_PLAYING)
+    SFG_game.settings = SFG_inputRecord.settings;
+
+  SFG_inputRecord.mode = SFG_INPUT_RECORD_OFF;
+
+  return SFG_inputRecord.length;
+}
+
+/**
+  Loads the next run of the record being played back, playback stops at the
+  end run and the settings from before it are back.
+*/
+void SFG_inputRecordNextRun()
+{
+  const uint8_t *r = SFG_inputRecord.playback + SFG_inputRecord.position;
+
+  if (SFG_inputRecord.position + 3 > SFG_inputRecord.size || r[0] == 0)
+  {
+    SFG_stopInput();
+    return;
+  }
+
+  SFG_inputRecord.steps = r[0];
+  SFG_inputRecord.keys = r[1] | (((uint16_t) r[2]) << 8);
+  SFG_inputRecord.position += 3;
+}
+
+/**
+  Starts playing back given record from its level start, the level is started
+  right away. While it plays, its keys are used instead of SFG_keyPressed(),
+  after its end (or SFG_stopInput()) the game goes on with the real keys and
+  the settings it had before, the record's own are used while it plays. Returns
+  0 if the record is not valid (or from a different version), otherwise 1.
+*/
+uint8_t SFG_playInput(const uint8_t *record, uint32_t size)
+{
+  if (size < SFG_INPUT_RECORD_HEADER_SIZE + 1 ||
+    record[0] != SFG_INPUT_RECORD_VERSION ||
+    record[1] >= SFG_NUMBER_OF_LEVELS)
+    return 0;
+
+  if (SFG_inputRecord.mode != SFG_INPUT_RECORD_PLAYING)
+    SFG_inputRecord.settings = SFG_game.settings;
+
+  SFG_inputRecord.mode = SFG_INPUT_RECORD_PLAYING; // already during level start
+  SFG_inputRecord.playback = record;
+  SFG_inputRecord.size = size;
+  SFG_inputRecord.position = SFG_INPUT_RECORD_HEADER_SIZE;
+  SFG_inputRecord.length = 0;
+
+  SFG_game.settings = record[2];
+  SFG_game.cheatState = record[3];
+  SFG_game.frame = SFG_inputRecordReadU32(record + 4);
+
+  SFG_setAndInitLevel(record[1]);
+
+  SFG_game.frame += record[8];
+  SFG_game.stateTime = SFG_inputRecordReadU32(record + 9);
+  SFG_player.health = record[13];
+
+  for (uint8_t i = 0; i < SFG_AMMO_TOTAL; ++i)
+    SFG_player.ammo[i] = record[14 + i];
+
+  SFG_player.weapon = record[17];
+
+  for (uint8_t i = 0; i < SFG_KEY_COUNT; ++i)
+    SFG_game.keyStates[i] = record[18 + i];
+
+  SFG_inputRecordNextRun();
+
+  return 1;
+}
+#endif
+
+/**
+  Gets the keys pressed in this game step (bit n = key n) from SFG_keyPressed()
+  or, with SFG_INPUT_RECORDS, from the record being played back, and records
+  them if a record is being made.
+*/
+uint16_t SFG_stepKeys()
+{
+  uint16_t keys = 0;
+
+#if SFG_INPUT_RECORDS
+  if (SFG_inputRecord.mode == SFG_INPUT_RECORD_PLAYING)
+  {
+    keys = SFG_inputRecord.keys;
+    SFG_inputRecord.steps--;
+
+    if (SFG_inputRecord.steps == 0)
+      SFG_inputRecordNextRun();
+
+    return keys;
+  }
+#endif
+
+  for (uint8_t i = 0; i < SFG_KEY_COUNT; ++i)
+    if (SFG_keyPressed(i))
+      keys |= ((uint16_t) 1) << i;
+
+#if SFG_INPUT_RECORDS
+  if (SFG_inputRecord.mode != SFG_INPUT_RECORD_RECORDING)
+    return keys;
+
+  uint8_t *r = SFG_inputRecord.record;
+
+  if (SFG_inputRecord.position == 0) // first step, write the header
+  {
+    if (SFG_inputRecord.size < SFG_INPUT_RECORD_HEADER_SIZE + 4)
+    {
+      SFG_inputRecord.mode = SFG_INPUT_RECORD_OFF;
+      return keys;
+    }
+
+    r[0] = SFG_INPUT_RECORD_VERSION;
+    r[1] = SFG_currentLevel.levelNumber;
+    r[2] = SFG_game.settings;
+    r[3] = SFG_game.cheatState;
+    SFG_inputRecordWriteU32(r + 4,SFG_currentLevel.frameStart);
+    r[8] = SFG_game.frame - SFG_currentLevel.frameStart;
+    SFG_inputRecordWriteU32(r + 9,SFG_game.stateTime);
+    r[13] = SFG_player.health;
+
+    for (uint8_t i = 0; i < SFG_AMMO_TOTAL; ++i)
+      r[14 + i] = SFG_player.ammo[i];
+
+    r[17] = SFG_player.weapon;
+
+    for (uint8_t i = 0; i < SFG_KEY_COUNT; ++i)
+      r[18 + i] = SFG_game.keyStates[i];
+
+    SFG_inputRecord.position = SFG_INPUT_RECORD_HEADER_SIZE;
+  }
+
+  if (SFG_inputRecord.steps != 0 &&
+    (keys != SFG_inputRecord.keys || SFG_inputRecord.steps == 255))
+  {
+    r += SFG_inputRecord.position;
+    r[0] = SFG_inputRecord.steps;
+    r[1] = SFG_inputRecord.keys & 0xff;
+    r[2] = SFG_inputRecord.keys >> 8;
+    SFG_inputRecord.position += 3;
+    SFG_inputRecord.steps = 0;
+  }
+
+  if (SFG_inputRecord.steps == 0)
+  {
+    if (SFG_inputRecord.position + 4 > SFG_inputRecord.size)
+    {
+      SFG_finishInputRecord(); // full, this step is not recorded anymore
+      return keys;
+    }
+
+    SFG_inputRecord.keys = keys;
+  }
+
+  SFG_inputRecord.steps++;
+#endif
+
+  return keys;
 }
 
 void SFG_createDefaultSaveData(uint8_t *memory)
@@ -1686,6 +2588,10 @@ void SFG_init()
 {
   SFG_LOG("initializing game")
 
+#if SFG_LEVEL_PREFETCH
+  SFG_currentLevelState = SFG_levelStates;
+#endif
+
   SFG_game.frame = 0;
   SFG_game.frameTime = 0;
   SFG_game.currentRandom = 0;
@@ -1704,6 +2610,15 @@ void SFG_init()
 
   SFG_game.antiSpam = 0;
 
+#if SFG_HUD_LAYER
+  SFG_game.hudKey = 0;
+  SFG_game.hudShown = 0;
+#endif
+
+#if SFG_HARDWARE_WEAPON
+  SFG_game.weaponShown = 0;
+#endif
+
   SFG_LOG("computing average texture colors")
 
   for (uint8_t i = 0; i < SFG_WALL_TEXTURE_COUNT; ++i)
@@ -2021,10 +2936,21 @@ void SFG_removeItem(uint8_t index)
 {
   SFG_LOG("removing item");
 
+  SFG_grid.itemRecordIndices[SFG_currentLevel.itemRecords[index] &
+    ~SFG_ITEM_RECORD_ACTIVE_MASK] = SFG_GRID_NONE;
+
+  SFG_activeListRemove(SFG_active.items,&SFG_active.itemCount,
+    SFG_currentLevel.itemRecords[index] & ~SFG_ITEM_RECORD_ACTIVE_MASK);
+
   for (uint16_t j = index; j < SFG_currentLevel.itemRecordCount - 1; ++j)
+  {
     SFG_currentLevel.itemRecords[j] =
       SFG_currentLevel.itemRecords[j + 1];
 
+    SFG_grid.itemRecordIndices[SFG_currentLevel.itemRecords[j] &
+      ~SFG_ITEM_RECORD_ACTIVE_MASK] = j;
+  }
+
   SFG_currentLevel.itemRecordCount--; 
 }
 
@@ -2061,9 +2987,9 @@ RCL_Unit SFG_directionTangent(RCL_Unit dirX, RCL_Unit dirY, RCL_Unit dirZ)
 */
 RCL_Unit SFG_autoaimVertically()
 {
-  for (uint16_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+  for (uint8_t i = 0; i < SFG_active.monsterCount; ++i)
   {
-    SFG_MonsterRecord m = SFG_currentLevel.monsterRecords[i];
+    SFG_MonsterRecord m = SFG_currentLevel.monsterRecords[SFG_active.monsters[i]];
     
     uint8_t state = SFG_MR_STATE(m);
  
@@ -2167,9 +3093,13 @@ void SFG_createExplosion(RCL_Unit x, RCL_Unit y, RCL_Unit z)
     SFG_pushPlayerAway(x,y,SFG_EXPLOSION_PUSH_AWAY_DISTANCE);
   }
 
-  for (uint16_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+  uint8_t nearby[SFG_MAX_LEVEL_ELEMENTS];
+  uint8_t nearbyCount =
+    SFG_gridMonstersNear(x,y,SFG_EXPLOSION_RADIUS,nearby);
+
+  for (uint8_t i = 0; i < nearbyCount; ++i)
   {
-    SFG_MonsterRecord *monster = &(SFG_currentLevel.monsterRecords[i]);
+    SFG_MonsterRecord *monster = &(SFG_currentLevel.monsterRecords[nearby[i]]);
 
     uint16_t state = SFG_MR_STATE(*monster); 
 
@@ -2196,8 +3126,16 @@ void SFG_createExplosion(RCL_Unit x, RCL_Unit y, RCL_Unit z)
   // explode nearby barrels
 
   if (damage >= SFG_BARREL_EXPLOSION_DAMAGE_THRESHOLD)
-    for (uint16_t i = 0; i < SFG_currentLevel.itemRecordCount; ++i)
+  {
+    nearbyCount = SFG_gridItemsNear(x,y,SFG_EXPLOSION_RADIUS,nearby);
+
+    for (uint8_t j = 0; j < nearbyCount; ++j)
     {
+      uint8_t i = SFG_grid.itemRecordIndices[nearby[j]];
+
+      if (i == SFG_GRID_NONE) // already exploded by a chained explosion
+        continue;
+
       SFG_ItemRecord item = SFG_currentLevel.itemRecords[i];
 
       /* We DON'T check just active barrels but all, otherwise it looks weird
@@ -2219,11 +3157,9 @@ void SFG_createExplosion(RCL_Unit x, RCL_Unit y, RCL_Unit z)
 
       if (SFG_taxicabDistance(
         x,y,z,elementX,elementY,elementHeight) <= SFG_EXPLOSION_RADIUS)
-      {
         SFG_explodeBarrel(i,elementX,elementY,elementHeight);
-        i--;
-      }
     }
+  }
 }
 
 void SFG_createDust(RCL_Unit x, RCL_Unit y, RCL_Unit z)
@@ -2257,6 +3193,145 @@ void SFG_getMonsterWorldPosition(SFG_MonsterRecord *monster, RCL_Unit *x,
        + RCL_UNITS_PER_SQUARE / 2;
 }
 
+#if SFG_MONSTER_FLOW_FIELD
+/**
+  Continues computing the flow field, to be called each frame.
+*/
+void SFG_updateFlowField()
+{
+  uint8_t building = SFG_flowField.ready == 0;
+  uint8_t *distances = SFG_flowField.distances[building];
+
+  if (SFG_player.squarePosition[0] != SFG_flowField.target[0] ||
+    SFG_player.squarePosition[1] != SFG_flowField.target[1])
+  {
+    if (SFG_player.squarePosition[0] < 0 ||
+      SFG_player.squarePosition[0] >= SFG_MAP_SIZE ||
+      SFG_player.squarePosition[1] < 0 ||
+      SFG_player.squarePosition[1] >= SFG_MAP_SIZE)
+      return;
+
+    SFG_flowField.target[0] = SFG_player.squarePosition[0];
+    SFG_flowField.target[1] = SFG_player.squarePosition[1];
+
+    for (uint16_t i = 0; i < SFG_MAP_SIZE * SFG_MAP_SIZE; ++i)
+      distances[i] = SFG_FLOW_FIELD_UNKNOWN;
+
+    uint16_t index = SFG_flowField.target[1] * SFG_MAP_SIZE +
+      SFG_flowField.target[0];
+
+    distances[index] = 0;
+    SFG_flowField.queue[0] = index;
+    SFG_flowField.queueStart = 0;
+    SFG_flowField.queueEnd = 1;
+  }
+
+  if (SFG_flowField.queueStart == SFG_flowField.queueEnd)
+    return; // up to date
+
+  for (uint16_t n = 0; n < SFG_FLOW_FIELD_BUDGET &&
+    SFG_flowField.queueStart != SFG_flowField.queueEnd; ++n)
+  {
+    uint16_t index = SFG_flowField.queue[SFG_flowField.queueStart];
+    SFG_flowField.queueStart++;
+
+    uint8_t distance = distances[index];
+
+    if (distance >= SFG_FLOW_FIELD_UNKNOWN - 1)
+      continue; // too far, the rest stays unknown
+
+    int16_t x = index % SFG_MAP_SIZE;
+    int16_t y = index / SFG_MAP_SIZE;
+
+    RCL_Unit height = SFG_floorCollisionHeightAt(x,y);
+
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+      int16_t x2 = x + (i == 0) - (i == 1);
+      int16_t y2 = y + (i == 2) - (i == 3);
+
+      if (x2 < 0 || x2 >= SFG_MAP_SIZE || y2 < 0 || y2 >= SFG_MAP_SIZE)
+        continue;
+
+      uint16_t index2 = y2 * SFG_MAP_SIZE + x2;
+
+      if (distances[index2] != SFG_FLOW_FIELD_UNKNOWN)
+        continue;
+
+      RCL_Unit height2 = SFG_floorCollisionHeightAt(x2,y2);
+
+      /* monsters walk from the neighbour to this square, so the step height
+         between them matters, and they have to fit in the neighbour, squares
+         they can't enter stay unknown (closed doors are walls until the player
+         opens them and moves on) */
+      if (RCL_abs(height2 - height) > RCL_CAMERA_COLL_STEP_HEIGHT ||
+        SFG_ceilingHeightAt(x2,y2) - height2 < SFG_MONSTER_COLLISION_HEIGHT)
+        continue;
+
+      distances[index2] = distance + 1;
+      SFG_flowField.queue[SFG_flowField.queueEnd] = index2;
+      SFG_flowField.queueEnd++;
+    }
+  }
+
+  if (SFG_flowField.queueStart == SFG_flowField.queueEnd)
+    SFG_flowField.ready = building; // complete, monsters switch to it
+}
+
+/**
+  Returns the walking state that takes a monster at given square towards the
+  player according to the flow field, or SFG_MONSTER_STATE_IDLE if the field
+  doesn't know the way.
+*/
+uint8_t SFG_flowFieldDirection(int16_t x, int16_t y)
+{
+  static const uint8_t states[9] =
+  {
+    SFG_MONSTER_STATE_GOING_NW, SFG_MONSTER_STATE_GOING_N,
+    SFG_MONSTER_STATE_GOING_NE, SFG_MONSTER_STATE_GOING_W,
+    SFG_MONSTER_STATE_IDLE,     SFG_MONSTER_STATE_GOING_E,
+    SFG_MONSTER_STATE_GOING_SW, SFG_MONSTER_STATE_GOING_S,
+    SFG_MONSTER_STATE_GOING_SE
+  };
+
+  if (SFG_flowField.ready == 255)
+    return SFG_MONSTER_STATE_IDLE;
+
+  const uint8_t *distances = SFG_flowField.distances[SFG_flowField.ready];
+
+  #define distanceAt(xx,yy) \
+    (((xx) < 0 || (xx) >= SFG_MAP_SIZE || (yy) < 0 || (yy) >= SFG_MAP_SIZE) ? \
+    SFG_FLOW_FIELD_UNKNOWN : distances[(yy) * SFG_MAP_SIZE + (xx)])
+
+  uint8_t best = distanceAt(x,y);
+  uint8_t result = 4;
+
+  if (best == SFG_FLOW_FIELD_UNKNOWN)
+    return SFG_MONSTER_STATE_IDLE;
+
+  for (int8_t j = -1; j <= 1; ++j)
+    for (int8_t i = -1; i <= 1; ++i)
+    {
+      uint8_t d = distanceAt(x + i,y + j);
+
+      if (d >= best)
+        continue;
+
+      if (i != 0 && j != 0 && // diagonally only if not cutting a corner
+        (distanceAt(x + i,y) == SFG_FLOW_FIELD_UNKNOWN ||
+        distanceAt(x,y + j) == SFG_FLOW_FIELD_UNKNOWN))
+        continue;
+
+      best = d;
+      result = (j + 1) * 3 + i + 1;
+    }
+
+  #undef distanceAt
+
+  return states[result];
+}
+#endif
+
 void SFG_monsterPerformAI(SFG_MonsterRecord *monster)
 {
   uint8_t state = SFG_MR_STATE(*monster);
@@ -2396,6 +3471,15 @@ void SFG_monsterPerformAI(SFG_MonsterRecord *monster)
       {
         // walk towards player
 
+#if SFG_MONSTER_FLOW_FIELD
+        state = SFG_flowFieldDirection(monsterSquare[0],monsterSquare[1]);
+
+        if (state != SFG_MONSTER_STATE_IDLE)
+        {
+          // the flow field knows the way
+        }
+        else
+#endif
         if (monsterSquare[0] > SFG_player.squarePosition[0])
         {
           if (monsterSquare[1] > SFG_player.squarePosition[1])
@@ -2558,8 +3642,25 @@ void SFG_monsterPerformAI(SFG_MonsterRecord *monster)
   }
 
   monster->stateType = state | (monsterNumber << 4);
+
+#if SFG_INTERPOLATION
+  uint8_t index = monster - SFG_currentLevel.monsterRecords;
+
+  SFG_interpolation.monsterCoords[index][0] = monster->coords[0];
+  SFG_interpolation.monsterCoords[index][1] = monster->coords[1];
+  /* the scheduler may update a monster sooner or later than every AI
+     interval, and a monster that stood (e.g. attacking) waited longer, so the
+     gap is kept between one frame and two intervals */
+  SFG_interpolation.monsterMoveGaps[index] = RCL_max(1,RCL_min(
+    2 * SFG_AI_UPDATE_FRAME_INTERVAL,(uint8_t) (SFG_game.frame -
+    SFG_interpolation.monsterMoveFrames[index])));
+  SFG_interpolation.monsterMoveFrames[index] = SFG_game.frame;
+#endif
+
   monster->coords[0] = newPos[0];
   monster->coords[1] = newPos[1];;
+
+  SFG_gridUpdateMonster(monster - SFG_currentLevel.monsterRecords);
 }
 
 static inline uint8_t SFG_elementCollides(
@@ -2606,20 +3707,170 @@ uint8_t SFG_projectileCollides(SFG_ProjectileRecord *projectile,
 }
 
 /**
-  Updates a frame of the currently loaded level, i.e. enemies, projectiles,
-  animations etc., with the exception of player.
+  Updates AI of a monster or handles its death, done every
+  SFG_AI_UPDATE_FRAME_INTERVAL frames for the active monsters.
 */
-void SFG_updateLevel()
+void SFG_updateMonster(uint8_t index)
 {
-  // update projectiles:
+  SFG_MonsterRecord *monster = &(SFG_currentLevel.monsterRecords[index]);
+  uint8_t state = SFG_MR_STATE(*monster);
 
-  uint8_t substractFrames =
-    ((SFG_game.frame - SFG_currentLevel.frameStart) & 0x01) ? 1 : 0;
-    /* ^ only substract frames to live every other frame because a maximum of
-       256 frames would be too few */
+  if (state == SFG_MONSTER_STATE_DEAD)
+    return; // dead bodies stay in the active list to be drawn
 
-  for (int8_t i = 0; i < SFG_currentLevel.projectileRecordCount; ++i)
-  { // ^ has to be signed
+  if (state == SFG_MONSTER_STATE_DYING)
+  {
+    monster->stateType =
+      (monster->stateType & 0xf0) | SFG_MONSTER_STATE_DEAD;
+
+    SFG_gridRemoveMonster(index);
+  }
+  else if (monster->health == 0)
+  {
+    monster->stateType = (monster->stateType & SFG_MONSTER_MASK_TYPE) |
+      SFG_MONSTER_STATE_DYING;
+
+    if (SFG_MR_TYPE(*monster) == SFG_LEVEL_ELEMENT_MONSTER_ENDER)
+    {
+      SFG_currentLevel.bossCount--;
+
+      // last boss killed gives player a key card
+
+      if (SFG_currentLevel.bossCount == 0)
+      {
+        SFG_LOG("boss killed, giving player a card");
+        SFG_player.cards |= 0x04;
+      }
+    }
+
+    SFG_processEvent(SFG_EVENT_MONSTER_DIES,SFG_MR_TYPE(*monster));
+
+    if (SFG_MR_TYPE(*monster) == SFG_LEVEL_ELEMENT_MONSTER_EXPLODER)
+      SFG_createExplosion(
+        SFG_MONSTER_COORD_TO_RCL_UNITS(monster->coords[0]),
+        SFG_MONSTER_COORD_TO_RCL_UNITS(monster->coords[1]),
+        SFG_floorCollisionHeightAt(
+          SFG_MONSTER_COORD_TO_SQUARES(monster->coords[0]),
+          SFG_MONSTER_COORD_TO_SQUARES(monster->coords[0])) +
+        RCL_UNITS_PER_SQUARE / 2);
+  }
+  else
+  {
+#if SFG_PREVIEW_MODE == 0
+    SFG_monsterPerformAI(monster);
+#endif
+  }
+}
+
+#if SFG_AI_SCHEDULER
+/**
+  Says whether a monster can be seen by the player, i.e. is in front of the
+  camera and not behind a wall. Only uses the simulation state, so the AI
+  doesn't depend on whether or how often frames are drawn.
+*/
+static inline uint8_t SFG_monsterInSight(const SFG_MonsterRecord *monster)
+{
+  RCL_Vector2D pos;
+
+  pos.x = SFG_MONSTER_COORD_TO_RCL_UNITS(monster->coords[0]);
+  pos.y = SFG_MONSTER_COORD_TO_RCL_UNITS(monster->coords[1]);
+
+  if ((pos.x - SFG_player.camera.position.x) * SFG_player.direction.x +
+    (pos.y - SFG_player.camera.position.y) * SFG_player.direction.y <= 0)
+    return 0; // behind the camera, no need to cast a ray
+
+  return SFG_spriteIsVisible(pos,
+    SFG_floorHeightAt(
+      SFG_MONSTER_COORD_TO_SQUARES(monster->coords[0]),
+      SFG_MONSTER_COORD_TO_SQUARES(monster->coords[1])) +
+    SFG_SPRITE_SIZE_TO_HEIGHT_ABOVE_GROUND(SFG_GET_MONSTER_SPRITE_SIZE(
+      SFG_MONSTER_TYPE_TO_INDEX(SFG_MR_TYPE(*monster)))));
+}
+
+/**
+  Spreads the monster AI updates over frames: the active monsters are gone
+  through round-robin and each one that is due gets updated, but at most
+  SFG_AI_BUDGET per frame, the rest wait for the next frame. Monsters that are
+  near the player or in sight (SFG_monsterInSight) are due every
+  SFG_AI_UPDATE_FRAME_INTERVAL frames, the others half as often.
+*/
+void SFG_scheduleAI()
+{
+  uint8_t frame = SFG_game.frame;
+  uint8_t count = SFG_active.monsterCount;
+  uint8_t position = SFG_aiScheduler.next;
+  uint8_t resumeAt = 255;
+  uint8_t updated = 0;
+  uint8_t lag = 0;
+
+  if (position >= count)
+    position = 0;
+
+  for (uint8_t n = 0; n < count; ++n)
+  {
+    uint8_t index = SFG_active.monsters[position];
+    SFG_MonsterRecord *monster = &(SFG_currentLevel.monsterRecords[index]);
+
+    position = (position + 1 < count) ? position + 1 : 0;
+
+    if (SFG_MR_STATE(*monster) == SFG_MONSTER_STATE_DEAD)
+      continue;
+
+    uint8_t interval = SFG_AI_UPDATE_FRAME_INTERVAL;
+    uint8_t waited = frame - SFG_aiScheduler.lastUpdate[index];
+
+    if (waited < interval)
+      continue;
+
+    /* A far monster is only tested for sight while that decides whether it's
+       due, and not once the budget is used up, as the ray costs. */
+    if (RCL_abs(SFG_MONSTER_COORD_TO_SQUARES(monster->coords[0]) -
+        SFG_player.squarePosition[0]) +
+      RCL_abs(SFG_MONSTER_COORD_TO_SQUARES(monster->coords[1]) -
+        SFG_player.squarePosition[1]) > SFG_AI_NEAR_DISTANCE &&
+      (waited >= 2 * interval || updated >= SFG_AI_BUDGET ||
+      !SFG_monsterInSight(monster)))
+      interval *= 2;
+
+    if (waited < interval)
+      continue;
+
+    if (updated < SFG_AI_BUDGET)
+    {
+      SFG_aiScheduler.lastUpdate[index] = frame;
+      updated++;
+      SFG_updateMonster(index);
+    }
+    else
+    {
+      if (resumeAt == 255) // next frame starts with the first one left out
+        resumeAt = (position != 0 ? position : count) - 1;
+
+      lag = RCL_max(lag,waited - interval);
+    }
+  }
+
+  SFG_aiScheduler.next = resumeAt != 255 ? resumeAt : position;
+
+  SFG_AI_STATS(updated,lag);
+}
+#endif
+
+/**
+  Updates a frame of the currently loaded level, i.e. enemies, projectiles,
+  animations etc., with the exception of player.
+*/
+void SFG_updateLevel()
+{
+  // update projectiles:
+
+  uint8_t substractFrames =
+    ((SFG_game.frame - SFG_currentLevel.frameStart) & 0x01) ? 1 : 0;
+    /* ^ only substract frames to live every other frame because a maximum of
+       256 frames would be too few */
+
+  for (int8_t i = 0; i < SFG_currentLevel.projectileRecordCount; ++i)
+  { // ^ has to be signed
     SFG_ProjectileRecord *p = &(SFG_currentLevel.projectileRecords[i]);
 
     uint8_t attackType = 255;
@@ -2681,10 +3932,17 @@ void SFG_updateLevel()
 
       // check collision with active level elements
 
+      uint8_t nearby[SFG_MAX_LEVEL_ELEMENTS];
+      uint8_t nearbyCount;
+
       if (!eliminate) // monsters 
-        for (uint16_t j = 0; j < SFG_currentLevel.monsterRecordCount; ++j)
+      {
+        nearbyCount = SFG_gridMonstersNear(p->position[0],p->position[1],
+          SFG_ELEMENT_COLLISION_RADIUS,nearby);
+
+        for (uint8_t j = 0; j < nearbyCount; ++j)
         {
-          SFG_MonsterRecord *m = &(SFG_currentLevel.monsterRecords[j]);
+          SFG_MonsterRecord *m = &(SFG_currentLevel.monsterRecords[nearby[j]]);
 
           uint8_t state = SFG_MR_STATE(*m);
 
@@ -2705,10 +3963,17 @@ void SFG_updateLevel()
             }
           }
         }
+      }
 
       if (!eliminate) // items (can't check itemCollisionMap because of barrels)
-        for (uint16_t j = 0; j < SFG_currentLevel.itemRecordCount; ++j)
+      {
+        nearbyCount = SFG_gridItemsNear(p->position[0],p->position[1],
+          SFG_ELEMENT_COLLISION_RADIUS,nearby);
+
+        for (uint8_t k = 0; k < nearbyCount; ++k)
         {
+          uint8_t j = SFG_grid.itemRecordIndices[nearby[k]];
+
           const SFG_LevelElement *e = SFG_getActiveItemElement(j);
 
           if (e != 0 && SFG_itemCollides(e->type))
@@ -2733,6 +3998,7 @@ void SFG_updateLevel()
             }
           }
         }
+      }
     }
 
     if (eliminate)
@@ -2855,6 +4121,8 @@ void SFG_updateLevel()
       SFG_ItemRecord item =
         SFG_currentLevel.itemRecords[SFG_currentLevel.checkedItemIndex];
 
+      uint8_t wasActive = item & SFG_ITEM_RECORD_ACTIVE_MASK;
+
       item &= ~SFG_ITEM_RECORD_ACTIVE_MASK;
 
       SFG_LevelElement e =
@@ -2866,7 +4134,14 @@ void SFG_updateLevel()
           e.coords[1] * RCL_UNITS_PER_SQUARE + RCL_UNITS_PER_SQUARE / 2,
           SFG_floorHeightAt(e.coords[0],e.coords[1]) + RCL_UNITS_PER_SQUARE / 2)
         )
+      {
+        if (!wasActive)
+          SFG_activeListAdd(SFG_active.items,&SFG_active.itemCount,item);
+
         item |= SFG_ITEM_RECORD_ACTIVE_MASK;
+      }
+      else if (wasActive)
+        SFG_activeListRemove(SFG_active.items,&SFG_active.itemCount,item);
 
       SFG_currentLevel.itemRecords[SFG_currentLevel.checkedItemIndex] = item;
 
@@ -2901,6 +4176,10 @@ void SFG_updateLevel()
           )
         )
       {
+        if (SFG_MR_STATE(*monster) != SFG_MONSTER_STATE_INACTIVE)
+          SFG_activeListRemove(SFG_active.monsters,&SFG_active.monsterCount,
+            SFG_currentLevel.checkedMonsterIndex);
+
         monster->stateType = 
            (monster->stateType & SFG_MONSTER_MASK_TYPE) |
            SFG_MONSTER_STATE_INACTIVE;
@@ -2911,6 +4190,15 @@ void SFG_updateLevel()
           (monster->stateType & SFG_MONSTER_MASK_TYPE) |
           (monster->health != 0 ? 
             SFG_MONSTER_STATE_IDLE : SFG_MONSTER_STATE_DEAD);
+
+        SFG_activeListAdd(SFG_active.monsters,&SFG_active.monsterCount,
+          SFG_currentLevel.checkedMonsterIndex);
+
+#if SFG_AI_SCHEDULER
+        // due right away
+        SFG_aiScheduler.lastUpdate[SFG_currentLevel.checkedMonsterIndex] =
+          SFG_game.frame - SFG_AI_UPDATE_FRAME_INTERVAL;
+#endif
       }
 
       SFG_currentLevel.checkedMonsterIndex++;
@@ -2921,61 +4209,21 @@ void SFG_updateLevel()
     }
   }
 
+#if SFG_MONSTER_FLOW_FIELD
+  SFG_updateFlowField();
+#endif
+
   // update AI and handle dead monsters:
+#if SFG_AI_SCHEDULER
+  SFG_scheduleAI();
+#else
   if ((SFG_game.frame - SFG_currentLevel.frameStart) %
       SFG_AI_UPDATE_FRAME_INTERVAL == 0)
   {
-    for (uint16_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
-    {
-      SFG_MonsterRecord *monster = &(SFG_currentLevel.monsterRecords[i]);
-      uint8_t state = SFG_MR_STATE(*monster);
-
-      if ((state == SFG_MONSTER_STATE_INACTIVE) || 
-          (state == SFG_MONSTER_STATE_DEAD))
-        continue;
-
-      if (state == SFG_MONSTER_STATE_DYING)
-      {
-        monster->stateType =
-          (monster->stateType & 0xf0) | SFG_MONSTER_STATE_DEAD;
-      }
-      else if (monster->health == 0)
-      {
-        monster->stateType = (monster->stateType & SFG_MONSTER_MASK_TYPE) |
-          SFG_MONSTER_STATE_DYING;
-
-        if (SFG_MR_TYPE(*monster) == SFG_LEVEL_ELEMENT_MONSTER_ENDER)
-        {
-          SFG_currentLevel.bossCount--;
-
-          // last boss killed gives player a key card
-
-          if (SFG_currentLevel.bossCount == 0)
-          {
-            SFG_LOG("boss killed, giving player a card");
-            SFG_player.cards |= 0x04;
-          }
-        }
-
-        SFG_processEvent(SFG_EVENT_MONSTER_DIES,SFG_MR_TYPE(*monster));
-
-        if (SFG_MR_TYPE(*monster) == SFG_LEVEL_ELEMENT_MONSTER_EXPLODER)
-          SFG_createExplosion(
-            SFG_MONSTER_COORD_TO_RCL_UNITS(monster->coords[0]),
-            SFG_MONSTER_COORD_TO_RCL_UNITS(monster->coords[1]),
-            SFG_floorCollisionHeightAt(
-              SFG_MONSTER_COORD_TO_SQUARES(monster->coords[0]),
-              SFG_MONSTER_COORD_TO_SQUARES(monster->coords[0])) +
-            RCL_UNITS_PER_SQUARE / 2);
-      }
-      else
-      {
-#if SFG_PREVIEW_MODE == 0
-        SFG_monsterPerformAI(monster);
-#endif
-      }
-    }
+    for (uint8_t i = 0; i < SFG_active.monsterCount; ++i)
+      SFG_updateMonster(SFG_active.monsters[i]);
   }
+#endif
 }
 
 /**
@@ -3239,6 +4487,9 @@ void SFG_gameStepPlaying()
 
   int16_t mouseX = 0, mouseY = 0;
 
+#if SFG_INPUT_RECORDS
+  if (SFG_inputRecord.mode != SFG_INPUT_RECORD_PLAYING)
+#endif
   SFG_getMouseOffset(&mouseX,&mouseY);
 
   if (mouseX != 0)                                  // mouse turning
@@ -3353,10 +4604,14 @@ void SFG_gameStepPlaying()
 
   // handle player collision with level elements:
 
+  uint8_t nearby[SFG_MAX_LEVEL_ELEMENTS];
+  uint8_t nearbyCount = SFG_gridMonstersNear(SFG_player.camera.position.x,
+    SFG_player.camera.position.y,SFG_ELEMENT_COLLISION_RADIUS,nearby);
+
   // monsters:
-  for (uint16_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+  for (uint8_t i = 0; i < nearbyCount; ++i)
   {
-    SFG_MonsterRecord *m = &(SFG_currentLevel.monsterRecords[i]);
+    SFG_MonsterRecord *m = &(SFG_currentLevel.monsterRecords[nearby[i]]);
 
     uint8_t state = SFG_MR_STATE(*m);
 
@@ -3388,11 +4643,19 @@ void SFG_gameStepPlaying()
 
   uint8_t collidesWithTeleporter = 0;
 
+  nearbyCount = SFG_gridItemsNear(SFG_player.camera.position.x,
+    SFG_player.camera.position.y,SFG_ELEMENT_COLLISION_RADIUS,nearby);
+
   /* item collisions with player (only those that don't stop player's movement,
-     as those are handled differently, via itemCollisionMap): */
-  for (int16_t i = 0; i < SFG_currentLevel.itemRecordCount; ++i)
-    // ^ has to be int16_t (signed)
+     as those are handled differently, via itemCollisionMap); after teleporting
+     the items at the destination are checked in the next frame: */
+  for (uint8_t k = 0; k < nearbyCount; ++k)
   {
+    uint8_t i = SFG_grid.itemRecordIndices[nearby[k]];
+
+    if (i == SFG_GRID_NONE)
+      continue;
+
     if (!(SFG_currentLevel.itemRecords[i] & SFG_ITEM_RECORD_ACTIVE_MASK))
       continue;
 
@@ -3485,7 +4748,6 @@ void SFG_gameStepPlaying()
 #if !SFG_PREVIEW_MODE
           SFG_removeItem(i);
           SFG_player.lastItemTakenFrame = SFG_game.frame;
-          i--;
           SFG_playGameSound(3,255);
           SFG_processEvent(SFG_EVENT_PLAYER_TAKES_ITEM,e->type);
 #endif
@@ -3522,6 +4784,10 @@ void SFG_gameStepPlaying()
                 SFG_floorHeightAt(e2.coords[0],e2.coords[1]) +
                 RCL_CAMERA_COLL_HEIGHT_BELOW;
 
+              SFG_activeListAdd(SFG_active.items,&SFG_active.itemCount,
+                SFG_currentLevel.itemRecords[j] &
+                ~SFG_ITEM_RECORD_ACTIVE_MASK);
+
               SFG_currentLevel.itemRecords[j] |= SFG_ITEM_RECORD_ACTIVE_MASK;
               /* ^ we have to make the new teleporter immediately active so
                  that it will immediately collide */
@@ -3661,14 +4927,12 @@ void SFG_gameStepPlaying()
       {
         // player's melee attack
 
-        for (uint16_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+        for (uint8_t i = 0; i < SFG_active.monsterCount; ++i)
         {
-          SFG_MonsterRecord *m = &(SFG_currentLevel.monsterRecords[i]);
-
-          uint8_t state = SFG_MR_STATE(*m);
+          SFG_MonsterRecord *m =
+            &(SFG_currentLevel.monsterRecords[SFG_active.monsters[i]]);
 
-          if ((state == SFG_MONSTER_STATE_INACTIVE) || 
-              (state == SFG_MONSTER_STATE_DEAD))
+          if (SFG_MR_STATE(*m) == SFG_MONSTER_STATE_DEAD)
             continue;
 
           RCL_Unit pX, pY, pZ;
@@ -3999,8 +5263,10 @@ void SFG_gameStep()
   
   SFG_game.blink = (SFG_game.frame / SFG_BLINK_PERIOD_FRAMES) % 2;
 
+  uint16_t keys = SFG_stepKeys();
+
   for (uint8_t i = 0; i < SFG_KEY_COUNT; ++i)
-    if (!SFG_keyPressed(i))
+    if (!((keys >> i) & 0x01))
       SFG_game.keyStates[i] = 0;
     else if (SFG_game.keyStates[i] < 255)
       SFG_game.keyStates[i]++;
@@ -4058,9 +5324,16 @@ void SFG_gameStep()
      
       SFG_updateLevel();
 
+      uint8_t nextReady = 1;
+
+#if SFG_LEVEL_PREFETCH
+      if (SFG_currentLevel.levelNumber < (SFG_NUMBER_OF_LEVELS - 1))
+        nextReady = SFG_prefetchLevel(SFG_currentLevel.levelNumber + 1);
+#endif
+
       int32_t t = SFG_game.stateTime;
 
-      if (t > SFG_WIN_ANIMATION_DURATION)
+      if (t > SFG_WIN_ANIMATION_DURATION && nextReady)
       {
         if (SFG_currentLevel.levelNumber == (SFG_NUMBER_OF_LEVELS - 1))
         {
@@ -4106,8 +5379,16 @@ void SFG_gameStep()
       break;
 
     case SFG_GAME_STATE_INTRO:
+#if SFG_LEVEL_PREFETCH
+      if (SFG_keyJustPressed(SFG_KEY_A) || SFG_keyJustPressed(SFG_KEY_B))
+        SFG_levelPreparation.startAsked = 1;
+
+      if (SFG_prefetchLevel(0) && SFG_levelPreparation.startAsked)
+        SFG_setAndInitLevel(0);
+#else
       if (SFG_keyJustPressed(SFG_KEY_A) || SFG_keyJustPressed(SFG_KEY_B))
         SFG_setAndInitLevel(0);
+#endif
 
       break;
 
@@ -4346,9 +5627,16 @@ uint8_t SFG_drawNumber(
 */
 void SFG_drawIndicationBorder(uint16_t width, uint8_t color)
 {
+#if SFG_HUD_LAYER
+  // the HUD is on a separate layer, keep the border inside the 3D view
+  #define BORDER_BOTTOM (SFG_GAME_RESOLUTION_Y - SFG_HUD_BAR_HEIGHT)
+#else
+  #define BORDER_BOTTOM SFG_GAME_RESOLUTION_Y
+#endif
+
   for (int_fast16_t j = 0; j < width; ++j)
   {
-    uint16_t j2 = SFG_GAME_RESOLUTION_Y - 1 - j;
+    uint16_t j2 = BORDER_BOTTOM - 1 - j;
 
     for (int_fast16_t i = 0; i < SFG_GAME_RESOLUTION_X; ++i)
     {
@@ -4364,7 +5652,7 @@ void SFG_drawIndicationBorder(uint16_t width, uint8_t color)
   {
     uint16_t i2 = SFG_GAME_RESOLUTION_X - 1 - i;
 
-    for (int_fast16_t j = width; j < SFG_GAME_RESOLUTION_Y - width; ++j)
+    for (int_fast16_t j = width; j < BORDER_BOTTOM - width; ++j)
     {
       if ((i & 0x01) == (j & 0x01))
       {
@@ -4373,6 +5661,8 @@ void SFG_drawIndicationBorder(uint16_t width, uint8_t color)
       }
     }
   }
+
+  #undef BORDER_BOTTOM
 }
 
 /**
@@ -4391,6 +5681,10 @@ void SFG_drawWeapon(int16_t bobOffset)
      
   uint8_t fireType = SFG_GET_WEAPON_FIRE_TYPE(SFG_player.weapon);
 
+#if SFG_HARDWARE_WEAPON
+  int16_t flashY = SFG_WEAPON_OVERLAY_NO_FLASH;
+#endif
+
   if (shotAnimationFrame < animationLength)
   {
     if (fireType == SFG_WEAPON_FIRE_TYPE_MELEE)
@@ -4408,18 +5702,28 @@ void SFG_drawWeapon(int16_t bobOffset)
         ((fireType == SFG_WEAPON_FIRE_TYPE_FIREBALL) ||
          (fireType == SFG_WEAPON_FIRE_TYPE_BULLET)) &&
         shotAnimationFrame < animationLength / 2)
+#if SFG_HARDWARE_WEAPON
+        flashY = SFG_WEAPON_IMAGE_POSITION_Y -
+          (SFG_TEXTURE_SIZE / 3) * SFG_WEAPON_IMAGE_SCALE + bobOffset;
+#else
         SFG_blitImage(SFG_effectSprites,
           SFG_WEAPON_IMAGE_POSITION_X,
           SFG_WEAPON_IMAGE_POSITION_Y -
             (SFG_TEXTURE_SIZE / 3) * SFG_WEAPON_IMAGE_SCALE + bobOffset,
           SFG_WEAPON_IMAGE_SCALE);
+#endif
     }
   }
 
+#if SFG_HARDWARE_WEAPON
+  SFG_setWeaponOverlay(SFG_player.weapon,SFG_WEAPON_IMAGE_POSITION_X,
+    SFG_WEAPON_IMAGE_POSITION_Y + bobOffset - 1,flashY);
+#else
   SFG_blitImage(SFG_weaponImages + SFG_player.weapon * SFG_TEXTURE_STORE_SIZE,
   SFG_WEAPON_IMAGE_POSITION_X,
   SFG_WEAPON_IMAGE_POSITION_Y + bobOffset - 1,
   SFG_WEAPON_IMAGE_SCALE);
+#endif
 }
 
 uint16_t SFG_textLen(const char *text)
@@ -4661,6 +5965,190 @@ void SFG_drawWinOverlay()
   #undef INNER_STRIP_HEIGHT
 }
 
+/**
+  Returns the visible card squares of the HUD as a 3 bit mask.
+*/
+static inline uint8_t SFG_hudCardMask()
+{
+  return 
+    (SFG_player.cards | ((SFG_player.cards >> 3) * SFG_game.blink)) & 0x07;
+}
+
+#if SFG_HUD_LAYER
+/**
+  Packs everything the HUD shows into a single number so that its changes can
+  be detected without redrawing the HUD.
+*/
+uint32_t SFG_hudKey()
+{
+  return
+    SFG_player.health |
+    ((SFG_player.weapon != SFG_WEAPON_KNIFE ?
+      SFG_player.ammo[SFG_weaponAmmo(SFG_player.weapon)] : 0) << 8) |
+    (((uint32_t) SFG_hudCardMask()) << 16) |
+    (((uint32_t) (SFG_game.cheatState & 0x80)) << 12);
+}
+#endif
+
+/**
+  Draws the HUD bar at the bottom of the screen.
+*/
+void SFG_drawHUD()
+{
+  // bar
+
+  uint8_t color = 61;
+  uint8_t color2 = 48;
+
+  if (SFG_game.cheatState & 0x80)
+  {
+    color = 170;
+    color2 = 0;
+  }
+
+  for (uint16_t j = SFG_GAME_RESOLUTION_Y - SFG_HUD_BAR_HEIGHT;
+    j < SFG_GAME_RESOLUTION_Y; ++j)
+  {
+    for (uint16_t i = 0; i < SFG_GAME_RESOLUTION_X; ++i)
+      SFG_setGamePixel(i,j,color);
+
+    color = color2;
+  }
+
+  #define TEXT_Y (SFG_GAME_RESOLUTION_Y - SFG_HUD_MARGIN - \
+    SFG_FONT_CHARACTER_SIZE * SFG_FONT_SIZE_MEDIUM)
+
+  SFG_drawNumber( // health
+    SFG_player.health,
+    SFG_HUD_MARGIN,
+    TEXT_Y,
+    SFG_FONT_SIZE_MEDIUM,
+    SFG_player.health > SFG_PLAYER_HEALTH_WARNING_LEVEL ? 6 : 175);
+
+  SFG_drawNumber( // ammo
+    SFG_player.weapon != SFG_WEAPON_KNIFE ?
+      SFG_player.ammo[SFG_weaponAmmo(SFG_player.weapon)] : 0,
+    SFG_GAME_RESOLUTION_X - SFG_HUD_MARGIN -
+      (SFG_FONT_CHARACTER_SIZE + 1) * SFG_FONT_SIZE_MEDIUM * 3,
+    TEXT_Y,
+    SFG_FONT_SIZE_MEDIUM,
+    6); 
+
+  uint8_t cards = SFG_hudCardMask();
+
+  for (uint8_t i = 0; i < 3; ++i) // access cards
+    if ((cards >> i) & 0x01)
+      SFG_fillRectangle(
+        SFG_HUD_MARGIN + (SFG_FONT_CHARACTER_SIZE + 1) *
+          SFG_FONT_SIZE_MEDIUM * (5 + i),
+        TEXT_Y,
+        SFG_FONT_SIZE_MEDIUM * SFG_FONT_CHARACTER_SIZE,
+        SFG_FONT_SIZE_MEDIUM * SFG_FONT_CHARACTER_SIZE,
+        i == 0 ? 93 : (i == 1 ? 124 : 60));
+
+  #undef TEXT_Y
+}
+
+/**
+  Informs the layers drawn outside of the frame (see SFG_HUD_LAYER,
+  SFG_HARDWARE_WEAPON and SFG_PALETTE_EFFECTS) that the current frame doesn't
+  show the 3D view.
+*/
+static inline void SFG_no3DView()
+{
+#if SFG_HUD_LAYER
+  SFG_game.hudShown = 0;
+#endif
+
+#if SFG_PALETTE_EFFECTS
+  SFG_setPaletteEffect(SFG_PALETTE_EFFECT_NONE,0);
+#endif
+
+#if SFG_HARDWARE_WEAPON
+  if (SFG_game.weaponShown)
+  {
+    SFG_setWeaponOverlay(SFG_WEAPON_OVERLAY_HIDE,0,0,
+      SFG_WEAPON_OVERLAY_NO_FLASH);
+    SFG_game.weaponShown = 0;
+  }
+#endif
+}
+
+#if SFG_RENDER_THREADS > 1
+/**
+  Sprites of the current frame collected for SFG_RENDER_THREADS, so that every
+  column range draws all of them in the same order.
+*/
+SFG_THREAD_LOCAL struct
+{
+  struct
+  {
+    const uint8_t *image;
+    int16_t centerX;
+    int16_t centerY;
+    int16_t size;
+    uint8_t minusValue;
+    RCL_Unit distance;
+  } sprites[SFG_MAX_MONSTERS + SFG_MAX_ITEMS + SFG_MAX_PROJECTILES];
+
+  uint8_t spriteCount;
+  uint8_t samplingPoints[SFG_RENDER_THREADS][SFG_MAX_SPRITE_SIZE]; /**< Own
+                                    sprite sampling points of each range. */
+} SFG_parallelDraw;
+
+void SFG_queueSprite(
+  const uint8_t *image,
+  int16_t centerX,
+  int16_t centerY,
+  int16_t size,
+  uint8_t minusValue,
+  RCL_Unit distance)
+{
+  uint8_t i = SFG_parallelDraw.spriteCount;
+
+  SFG_parallelDraw.sprites[i].image = image;
+  SFG_parallelDraw.sprites[i].centerX = centerX;
+  SFG_parallelDraw.sprites[i].centerY = centerY;
+  SFG_parallelDraw.sprites[i].size = size;
+  SFG_parallelDraw.sprites[i].minusValue = minusValue;
+  SFG_parallelDraw.sprites[i].distance = distance;
+
+  SFG_parallelDraw.spriteCount++;
+}
+
+/**
+  Draws the walls and then the queued sprites of one column range of the 3D
+  view, called through the frontend's SFG_drawInParallel().
+*/
+void SFG_drawPart(uint8_t part)
+{
+  int16_t fromX = (part * SFG_player.camera.resolution.x) / SFG_RENDER_THREADS;
+  int16_t toX =
+    ((part + 1) * SFG_player.camera.resolution.x) / SFG_RENDER_THREADS;
+
+  RCL_renderComplexColumns(SFG_texturesAt,SFG_game.rayConstraints,fromX,toX);
+
+  // rays to screen columns
+  fromX *= SFG_RAYCASTING_SUBSAMPLE;
+  toX = part == SFG_RENDER_THREADS - 1 ?
+    SFG_GAME_RESOLUTION_X : toX * SFG_RAYCASTING_SUBSAMPLE;
+
+  for (uint8_t i = 0; i < SFG_parallelDraw.spriteCount; ++i)
+    SFG_drawScaledSpriteColumns(
+      SFG_parallelDraw.sprites[i].image,
+      SFG_parallelDraw.sprites[i].centerX,
+      SFG_parallelDraw.sprites[i].centerY,
+      SFG_parallelDraw.sprites[i].size,
+      SFG_parallelDraw.sprites[i].minusValue,
+      SFG_parallelDraw.sprites[i].distance,
+      fromX,toX,SFG_parallelDraw.samplingPoints[part]);
+}
+
+  #define SFG_DRAW_SPRITE SFG_queueSprite
+#else
+  #define SFG_DRAW_SPRITE SFG_drawScaledSprite
+#endif
+
 void SFG_draw()
 {
 #if SFG_BACKGROUND_BLUR != 0
@@ -4669,6 +6157,7 @@ void SFG_draw()
 
   if (SFG_game.state == SFG_GAME_STATE_MENU)
   {
+    SFG_no3DView();
     SFG_drawMenu();
     return;
   }
@@ -4676,12 +6165,14 @@ void SFG_draw()
   if (SFG_game.state == SFG_GAME_STATE_INTRO ||
       SFG_game.state == SFG_GAME_STATE_OUTRO)
   {
+    SFG_no3DView();
     SFG_drawStoryText();
     return;
   }
 
   if (SFG_keyIsDown(SFG_KEY_MAP) || (SFG_game.state == SFG_GAME_STATE_MAP))
   {
+    SFG_no3DView();
     SFG_drawMap();
   } 
   else
@@ -4727,96 +6218,124 @@ void SFG_draw()
     SFG_player.camera.height += headBobOffset;
 #endif // headbob enabled?
 
+#if SFG_RENDER_THREADS > 1
+    /* only prepare the walls here, they're drawn in parallel together with
+       the sprites below */
+    RCL_renderComplexBegin(
+      SFG_player.camera,
+      SFG_floorHeightAt,
+      SFG_ceilingHeightAt,
+      0);
+
+    SFG_parallelDraw.spriteCount = 0;
+#else
     RCL_renderComplex(
       SFG_player.camera,
       SFG_floorHeightAt,
       SFG_ceilingHeightAt,
       SFG_texturesAt,
       SFG_game.rayConstraints);
+#endif
  
     // draw sprites:
 
     // monster sprites:
-    for (int_fast16_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+    for (uint_fast8_t i = 0; i < SFG_active.monsterCount; ++i)
     {
-      SFG_MonsterRecord m = SFG_currentLevel.monsterRecords[i];
+      SFG_MonsterRecord m = SFG_currentLevel.monsterRecords[
+        SFG_active.monsters[i]];
       uint8_t state = SFG_MR_STATE(m);
 
-      if (state != SFG_MONSTER_STATE_INACTIVE)
-      {
-        RCL_Vector2D worldPosition;
+      RCL_Vector2D worldPosition;
 
-        worldPosition.x = SFG_MONSTER_COORD_TO_RCL_UNITS(m.coords[0]);
-        worldPosition.y = SFG_MONSTER_COORD_TO_RCL_UNITS(m.coords[1]);
+      worldPosition.x = SFG_MONSTER_COORD_TO_RCL_UNITS(m.coords[0]);
+      worldPosition.y = SFG_MONSTER_COORD_TO_RCL_UNITS(m.coords[1]);
 
-        uint8_t spriteSize = SFG_GET_MONSTER_SPRITE_SIZE(
-          SFG_MONSTER_TYPE_TO_INDEX(SFG_MR_TYPE(m)));
+#if SFG_INTERPOLATION
+      {
+        /* a monster is moved smoothly over as many frames as there were
+           between its last two moves, which is the AI interval unless the
+           scheduler spreads the updates differently */
+        uint8_t index = SFG_active.monsters[i];
+
+        RCL_Unit alpha = RCL_min(RCL_UNITS_PER_SQUARE,
+          (((uint8_t) (SFG_game.frame - 1 -
+          SFG_interpolation.monsterMoveFrames[index])) * RCL_UNITS_PER_SQUARE +
+          SFG_interpolation.alpha) /
+          SFG_interpolation.monsterMoveGaps[index]);
+
+        worldPosition.x = SFG_interpolate(SFG_MONSTER_COORD_TO_RCL_UNITS(
+          SFG_interpolation.monsterCoords[index][0]),worldPosition.x,alpha);
+        worldPosition.y = SFG_interpolate(SFG_MONSTER_COORD_TO_RCL_UNITS(
+          SFG_interpolation.monsterCoords[index][1]),worldPosition.y,alpha);
+      }
+#endif
 
-        RCL_Unit worldHeight = 
-          SFG_floorHeightAt(
-            SFG_MONSTER_COORD_TO_SQUARES(m.coords[0]),
-            SFG_MONSTER_COORD_TO_SQUARES(m.coords[1]))
-            + SFG_SPRITE_SIZE_TO_HEIGHT_ABOVE_GROUND(spriteSize);
+      uint8_t spriteSize = SFG_GET_MONSTER_SPRITE_SIZE(
+        SFG_MONSTER_TYPE_TO_INDEX(SFG_MR_TYPE(m)));
 
-        RCL_PixelInfo p =
-          RCL_mapToScreen(worldPosition,worldHeight,SFG_player.camera);
+      RCL_Unit worldHeight = 
+        SFG_floorHeightAt(
+          SFG_MONSTER_COORD_TO_SQUARES(m.coords[0]),
+          SFG_MONSTER_COORD_TO_SQUARES(m.coords[1]))
+          + SFG_SPRITE_SIZE_TO_HEIGHT_ABOVE_GROUND(spriteSize);
 
-        if (p.depth > 0 &&
-          SFG_spriteIsVisible(worldPosition,worldHeight))
-        {
-          const uint8_t *s =
-            SFG_getMonsterSprite(
-              SFG_MR_TYPE(m),
-              state,
-              SFG_game.spriteAnimationFrame & 0x01);
+      RCL_PixelInfo p =
+        RCL_mapToScreen(worldPosition,worldHeight,SFG_player.camera);
 
-          SFG_drawScaledSprite(s,
-            p.position.x * SFG_RAYCASTING_SUBSAMPLE,p.position.y,
-            RCL_perspectiveScaleVertical(
-            SFG_SPRITE_SIZE_PIXELS(spriteSize),
-            p.depth),
-            p.depth / (RCL_UNITS_PER_SQUARE * 2),p.depth);
-        }
+      if (p.depth > 0 &&
+        SFG_spriteIsVisible(worldPosition,worldHeight))
+      {
+        const uint8_t *s =
+          SFG_getMonsterSprite(
+            SFG_MR_TYPE(m),
+            state,
+            SFG_game.spriteAnimationFrame & 0x01);
+
+        SFG_DRAW_SPRITE(s,
+          p.position.x * SFG_RAYCASTING_SUBSAMPLE,p.position.y,
+          RCL_perspectiveScaleVertical(
+          SFG_SPRITE_SIZE_PIXELS(spriteSize),
+          p.depth),
+          p.depth / (RCL_UNITS_PER_SQUARE * 2),p.depth);
       }
     }
 
     // item sprites:
-    for (int_fast16_t i = 0; i < SFG_currentLevel.itemRecordCount; ++i)
-      if (SFG_currentLevel.itemRecords[i] & SFG_ITEM_RECORD_ACTIVE_MASK)
-      {
-        RCL_Vector2D worldPosition;
+    for (uint_fast8_t i = 0; i < SFG_active.itemCount; ++i)
+    {
+      RCL_Vector2D worldPosition;
 
-        SFG_LevelElement e = 
-          SFG_currentLevel.levelPointer->elements[
-            SFG_currentLevel.itemRecords[i] & ~SFG_ITEM_RECORD_ACTIVE_MASK];
+      SFG_LevelElement e = 
+        SFG_currentLevel.levelPointer->elements[SFG_active.items[i]];
 
-        worldPosition.x =
-          SFG_ELEMENT_COORD_TO_RCL_UNITS(e.coords[0]);
+      worldPosition.x =
+        SFG_ELEMENT_COORD_TO_RCL_UNITS(e.coords[0]);
 
-        worldPosition.y =
-          SFG_ELEMENT_COORD_TO_RCL_UNITS(e.coords[1]);
+      worldPosition.y =
+        SFG_ELEMENT_COORD_TO_RCL_UNITS(e.coords[1]);
 
-        const uint8_t *sprite;
-        uint8_t spriteSize;
+      const uint8_t *sprite;
+      uint8_t spriteSize;
 
-        SFG_getItemSprite(e.type,&sprite,&spriteSize);
+      SFG_getItemSprite(e.type,&sprite,&spriteSize);
 
-        if (sprite != 0)
-        {
-          RCL_Unit worldHeight = SFG_floorHeightAt(e.coords[0],e.coords[1])
-            + SFG_SPRITE_SIZE_TO_HEIGHT_ABOVE_GROUND(spriteSize);
-
-          RCL_PixelInfo p =
-            RCL_mapToScreen(worldPosition,worldHeight,SFG_player.camera);
-
-          if (p.depth > 0 &&
-            SFG_spriteIsVisible(worldPosition,worldHeight))
-            SFG_drawScaledSprite(sprite,p.position.x * SFG_RAYCASTING_SUBSAMPLE,
-              p.position.y,
-              RCL_perspectiveScaleVertical(SFG_SPRITE_SIZE_PIXELS(spriteSize),
-              p.depth),p.depth / (RCL_UNITS_PER_SQUARE * 2),p.depth);
-        }
+      if (sprite != 0)
+      {
+        RCL_Unit worldHeight = SFG_floorHeightAt(e.coords[0],e.coords[1])
+          + SFG_SPRITE_SIZE_TO_HEIGHT_ABOVE_GROUND(spriteSize);
+
+        RCL_PixelInfo p =
+          RCL_mapToScreen(worldPosition,worldHeight,SFG_player.camera);
+
+        if (p.depth > 0 &&
+          SFG_spriteIsVisible(worldPosition,worldHeight))
+          SFG_DRAW_SPRITE(sprite,p.position.x * SFG_RAYCASTING_SUBSAMPLE,
+            p.position.y,
+            RCL_perspectiveScaleVertical(SFG_SPRITE_SIZE_PIXELS(spriteSize),
+            p.depth),p.depth / (RCL_UNITS_PER_SQUARE * 2),p.depth);
       }
+    }
 
     // projectile sprites:
     for (uint8_t i = 0; i < SFG_currentLevel.projectileRecordCount; ++i)
@@ -4831,8 +6350,21 @@ void SFG_draw()
       worldPosition.x = proj->position[0];
       worldPosition.y = proj->position[1];
 
+      RCL_Unit worldHeight = proj->position[2];
+
+#if SFG_INTERPOLATION
+      {
+        // projectiles move by their direction each step, go back part of it
+        RCL_Unit back = RCL_UNITS_PER_SQUARE - SFG_interpolation.alpha;
+
+        worldPosition.x -= (proj->direction[0] * back) / RCL_UNITS_PER_SQUARE;
+        worldPosition.y -= (proj->direction[1] * back) / RCL_UNITS_PER_SQUARE;
+        worldHeight -= (proj->direction[2] * back) / RCL_UNITS_PER_SQUARE;
+      }
+#endif
+
       RCL_PixelInfo p =
-        RCL_mapToScreen(worldPosition,proj->position[2],SFG_player.camera);
+        RCL_mapToScreen(worldPosition,worldHeight,SFG_player.camera);
        
       const uint8_t *s =
         SFG_effectSprites + proj->type * SFG_TEXTURE_STORE_SIZE;
@@ -4857,13 +6389,17 @@ void SFG_draw()
 
       if (p.depth > 0 && 
         SFG_spriteIsVisible(worldPosition,proj->position[2]))
-        SFG_drawScaledSprite(s,
+        SFG_DRAW_SPRITE(s,
             p.position.x * SFG_RAYCASTING_SUBSAMPLE,p.position.y,
             RCL_perspectiveScaleVertical(spriteSize,p.depth),
             SFG_fogValueDiminish(p.depth),
             p.depth);  
     }
 
+#if SFG_RENDER_THREADS > 1
+    SFG_drawInParallel(SFG_drawPart);
+#endif
+
 #if SFG_HEADBOB_ENABLED
     // after rendering sprites substract back the head bob offset
     SFG_player.camera.height -= headBobOffset;
@@ -4876,65 +6412,49 @@ void SFG_draw()
 
 #if SFG_PREVIEW_MODE == 0
     SFG_drawWeapon(weaponBobOffset);
+
+  #if SFG_HARDWARE_WEAPON
+    SFG_game.weaponShown = 1;
+  #endif
 #endif
 
     // draw HUD:
 
-    // bar
+#if SFG_HUD_LAYER
+    uint32_t hudKey = SFG_hudKey();
 
-    uint8_t color = 61;
-    uint8_t color2 = 48;
-
-    if (SFG_game.cheatState & 0x80)
+    if (!SFG_game.hudShown || (hudKey != SFG_game.hudKey))
     {
-      color = 170;
-      color2 = 0;
-    }
-
-    for (uint16_t j = SFG_GAME_RESOLUTION_Y - SFG_HUD_BAR_HEIGHT;
-      j < SFG_GAME_RESOLUTION_Y; ++j)
-    {
-      for (uint16_t i = 0; i < SFG_GAME_RESOLUTION_X; ++i)
-        SFG_setGamePixel(i,j,color);
-
-      color = color2;
+      SFG_drawHUD();
+      SFG_game.hudKey = hudKey;
+      SFG_processEvent(SFG_EVENT_HUD_CHANGED,0);
     }
 
-    #define TEXT_Y (SFG_GAME_RESOLUTION_Y - SFG_HUD_MARGIN - \
-      SFG_FONT_CHARACTER_SIZE * SFG_FONT_SIZE_MEDIUM)
-
-    SFG_drawNumber( // health
-      SFG_player.health,
-      SFG_HUD_MARGIN,
-      TEXT_Y,
-      SFG_FONT_SIZE_MEDIUM,
-      SFG_player.health > SFG_PLAYER_HEALTH_WARNING_LEVEL ? 6 : 175);
-
-    SFG_drawNumber( // ammo
-      SFG_player.weapon != SFG_WEAPON_KNIFE ?
-        SFG_player.ammo[SFG_weaponAmmo(SFG_player.weapon)] : 0,
-      SFG_GAME_RESOLUTION_X - SFG_HUD_MARGIN -
-        (SFG_FONT_CHARACTER_SIZE + 1) * SFG_FONT_SIZE_MEDIUM * 3,
-      TEXT_Y,
-      SFG_FONT_SIZE_MEDIUM,
-      6); 
-
-    for (uint8_t i = 0; i < 3; ++i) // access cards
-      if ( 
-        ((SFG_player.cards >> i) | ((SFG_player.cards >> (i + 3))
-        & SFG_game.blink)) & 0x01)
-        SFG_fillRectangle(
-          SFG_HUD_MARGIN + (SFG_FONT_CHARACTER_SIZE + 1) *
-            SFG_FONT_SIZE_MEDIUM * (5 + i),
-          TEXT_Y,
-          SFG_FONT_SIZE_MEDIUM * SFG_FONT_CHARACTER_SIZE,
-          SFG_FONT_SIZE_MEDIUM * SFG_FONT_CHARACTER_SIZE,
-          i == 0 ? 93 : (i == 1 ? 124 : 60));
-
-    #undef TEXT_Y
+    SFG_game.hudShown = 1;
+#else
+    SFG_drawHUD();
+#endif
 
     // border indicator
 
+#if SFG_PALETTE_EFFECTS
+    uint32_t framesAgo;
+
+    if (SFG_game.state == SFG_GAME_STATE_LOSE)
+      SFG_setPaletteEffect(SFG_PALETTE_EFFECT_DEATH,
+        SFG_game.stateTime < SFG_LOSE_ANIMATION_DURATION ?
+        (SFG_game.stateTime * 255) / SFG_LOSE_ANIMATION_DURATION : 255);
+    else if ((framesAgo = SFG_game.frame - SFG_player.lastHurtFrame)
+        <= SFG_HUD_BORDER_INDICATOR_DURATION_FRAMES)
+      SFG_setPaletteEffect(SFG_PALETTE_EFFECT_HURT,255 - (framesAgo * 255) /
+        (SFG_HUD_BORDER_INDICATOR_DURATION_FRAMES + 1));
+    else if ((framesAgo = SFG_game.frame - SFG_player.lastItemTakenFrame)
+        <= SFG_HUD_BORDER_INDICATOR_DURATION_FRAMES)
+      SFG_setPaletteEffect(SFG_PALETTE_EFFECT_ITEM,255 - (framesAgo * 255) /
+        (SFG_HUD_BORDER_INDICATOR_DURATION_FRAMES + 1));
+    else
+      SFG_setPaletteEffect(SFG_PALETTE_EFFECT_NONE,0);
+#else
     if ((SFG_game.frame - SFG_player.lastHurtFrame
         <= SFG_HUD_BORDER_INDICATOR_DURATION_FRAMES) ||
         (SFG_game.state == SFG_GAME_STATE_LOSE))
@@ -4944,6 +6464,7 @@ void SFG_draw()
         <= SFG_HUD_BORDER_INDICATOR_DURATION_FRAMES)
       SFG_drawIndicationBorder(SFG_HUD_BORDER_INDICATOR_WIDTH_PIXELS,
       SFG_HUD_ITEM_TAKEN_INDICATION_COLOR);
+#endif
 
     if (SFG_game.state == SFG_GAME_STATE_WIN)
       SFG_drawWinOverlay();
@@ -4952,6 +6473,386 @@ void SFG_draw()
   }
 }
 
+#if SFG_SNAPSHOTS
+#define SFG_SNAPSHOT_VERSION 1 ///< Raise when the snapshot contents change.
+
+#if SFG_AI_SCHEDULER
+  #define SFG_SNAPSHOT_AI_FIELDS(f) f(SFG_aiScheduler)
+#else
+  #define SFG_SNAPSHOT_AI_FIELDS(f)
+#endif
+
+#if SFG_MONSTER_FLOW_FIELD
+  #define SFG_SNAPSHOT_FLOW_FIELDS(f) f(SFG_flowField)
+#else
+  #define SFG_SNAPSHOT_FLOW_FIELDS(f)
+#endif
+
+/**
+  Everything a snapshot holds, i.e. the whole mutable state of the simulation.
+  Left out are caches and things derived from this (they're recomputed when a
+  snapshot is restored) and the settings and save data, which are not
+  rewound.
+*/
+#define SFG_SNAPSHOT_FIELDS(f) \
+  f(SFG_game.state) f(SFG_game.stateTime) f(SFG_game.currentRandom) \
+  f(SFG_game.spriteAnimationFrame) f(SFG_game.soundsPlayedThisFrame) \
+  f(SFG_game.keyStates) f(SFG_game.frameTime) f(SFG_game.frame) \
+  f(SFG_game.blink) f(SFG_game.cheatState) \
+  f(SFG_player) f(SFG_currentLevel) \
+  SFG_SNAPSHOT_AI_FIELDS(f) SFG_SNAPSHOT_FLOW_FIELDS(f)
+
+#define SFG_SNAPSHOT_FIELD_SIZE(x) + sizeof(x)
+
+/**
+  Size of a snapshot in bytes: version and level number, then the fields.
+*/
+#define SFG_SNAPSHOT_SIZE (2 SFG_SNAPSHOT_FIELDS(SFG_SNAPSHOT_FIELD_SIZE))
+
+/**
+  Maximum size of a delta between two snapshots: a pair of run lengths for
+  every 255 bytes at worst.
+*/
+#define SFG_SNAPSHOT_DELTA_MAX_SIZE \
+  (SFG_SNAPSHOT_SIZE + 2 * (SFG_SNAPSHOT_SIZE / 255 + 2))
+
+/**
+  Recent snapshots with SFG_SNAPSHOTS, for rewinding: the latest one whole
+  and before it a ring of deltas, each of which turns a snapshot into the one
+  before it.
+*/
+SFG_THREAD_LOCAL struct
+{
+  uint8_t snapshots[2][SFG_SNAPSHOT_SIZE]; ///< latest one and the next one
+  uint8_t latest;                 ///< which of snapshots is the latest one
+  uint8_t hasLatest;
+  uint8_t levelNumber;            ///< level the snapshots are from
+  uint32_t levelFrameStart;       ///< start of that level, to notice restarts
+  uint8_t delta[SFG_SNAPSHOT_DELTA_MAX_SIZE]; ///< helper for encoding
+  uint8_t deltas[SFG_SNAPSHOT_BUFFER_SIZE];
+  uint16_t deltaStart[SFG_SNAPSHOT_COUNT];
+  uint16_t deltaLength[SFG_SNAPSHOT_COUNT];
+  uint16_t oldest;                ///< ring index of the oldest delta
+  uint16_t count;                 ///< number of deltas = steps to rewind
+  int32_t timeShift;              /**< Added to the frontend time so that it
+                                       goes on from restored frame times. */
+} SFG_snapshots;
+
+void SFG_snapshotCopy(uint8_t *snapshot, uint8_t toSnapshot)
+{
+  #define SFG_SNAPSHOT_COPY(x) \
+    { \
+      uint8_t *field = (uint8_t *) &(x); \
+      if (toSnapshot) \
+        for (uint16_t i = 0; i < sizeof(x); ++i) \
+          *snapshot++ = field[i]; \
+      else \
+        for (uint16_t i = 0; i < sizeof(x); ++i) \
+          field[i] = *snapshot++; \
+    }
+
+  SFG_SNAPSHOT_FIELDS(SFG_SNAPSHOT_COPY)
+
+  #undef SFG_SNAPSHOT_COPY
+}
+
+/**
+  Saves the current mutable game state into a snapshot of SFG_SNAPSHOT_SIZE
+  bytes.
+*/
+void SFG_snapshotWrite(uint8_t *snapshot)
+{
+  snapshot[0] = SFG_SNAPSHOT_VERSION;
+  snapshot[1] = SFG_currentLevel.levelNumber;
+
+  SFG_snapshotCopy(snapshot + 2,1);
+}
+
+/**
+  Restores the game state from a snapshot made by SFG_snapshotWrite. Only
+  snapshots of the current level can be restored (the level data stay loaded),
+  returns 0 if the snapshot can't be restored, otherwise 1.
+*/
+uint8_t SFG_snapshotRead(const uint8_t *snapshot)
+{
+  if (snapshot[0] != SFG_SNAPSHOT_VERSION ||
+    snapshot[1] != SFG_currentLevel.levelNumber)
+    return 0;
+
+  const SFG_Level *levelPointer = SFG_currentLevel.levelPointer;
+  const uint8_t *textures[7];
+
+  for (uint8_t i = 0; i < 7; ++i)
+    textures[i] = SFG_currentLevel.textures[i];
+
+  SFG_snapshotCopy((uint8_t *) snapshot + 2,0);
+
+  // pointers may be different memory than when the snapshot was made
+  SFG_currentLevel.levelPointer = levelPointer;
+
+  for (uint8_t i = 0; i < 7; ++i)
+    SFG_currentLevel.textures[i] = textures[i];
+
+  SFG_gridInit();
+  SFG_activeInit();
+
+#if SFG_INTERPOLATION
+  for (uint8_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+  {
+    SFG_interpolation.monsterCoords[i][0] =
+      SFG_currentLevel.monsterRecords[i].coords[0];
+    SFG_interpolation.monsterCoords[i][1] =
+      SFG_currentLevel.monsterRecords[i].coords[1];
+    SFG_interpolation.monsterMoveFrames[i] =
+      SFG_game.frame - SFG_AI_UPDATE_FRAME_INTERVAL;
+    SFG_interpolation.monsterMoveGaps[i] = SFG_AI_UPDATE_FRAME_INTERVAL;
+  }
+
+  SFG_interpolation.cameraPosition = SFG_player.camera.position;
+  SFG_interpolation.cameraHeight = SFG_player.camera.height;
+  SFG_interpolation.cameraDirection = SFG_player.camera.direction;
+#endif
+
+  return 1;
+}
+
+/**
+  Encodes the difference of two snapshots into delta (of at most
+  SFG_SNAPSHOT_DELTA_MAX_SIZE bytes) and returns its size. The bytes of the
+  snapshots are XORed and the result stored as pairs of run lengths (zero
+  bytes to skip, changed bytes to follow) followed by the changed bytes, so
+  snapshots of following steps make small deltas.
+*/
+uint16_t SFG_snapshotEncode(const uint8_t *snapshot1, const uint8_t *snapshot2,
+  uint8_t *delta)
+{
+  uint16_t length = 0;
+  uint16_t i = 0;
+
+  while (i < SFG_SNAPSHOT_SIZE)
+  {
+    uint8_t same = 0, changed = 0;
+
+    while (i < SFG_SNAPSHOT_SIZE && same < 255 &&
+      snapshot1[i] == snapshot2[i])
+    {
+      same++;
+      i++;
+    }
+
+    uint16_t changedStart = length + 2;
+
+    while (i < SFG_SNAPSHOT_SIZE && changed < 255 &&
+      snapshot1[i] != snapshot2[i])
+    {
+      delta[changedStart + changed] = snapshot1[i] ^ snapshot2[i];
+      changed++;
+      i++;
+    }
+
+    delta[length] = same;
+    delta[length + 1] = changed;
+    length += 2 + changed;
+  }
+
+  return length;
+}
+
+/**
+  Applies a delta made by SFG_snapshotEncode to either of the two snapshots it
+  was made from, turning it into the other one.
+*/
+void SFG_snapshotDecode(uint8_t *snapshot, const uint8_t *delta,
+  uint16_t length)
+{
+  uint16_t i = 0;
+
+  while (length > 0)
+  {
+    uint8_t changed = delta[1];
+
+    i += delta[0];
+    delta += 2;
+
+    for (uint8_t j = 0; j < changed; ++j)
+    {
+      snapshot[i] ^= *delta;
+      delta++;
+      i++;
+    }
+
+    length -= 2 + changed;
+  }
+}
+
+void SFG_clearSnapshots()
+{
+  SFG_snapshots.hasLatest = 0;
+  SFG_snapshots.count = 0;
+}
+
+/**
+  Takes a snapshot of the current step and keeps the delta to the previous one,
+  dropping the oldest ones as needed.
+*/
+void SFG_pushSnapshot()
+{
+  if (SFG_snapshots.hasLatest &&
+    (SFG_snapshots.levelNumber != SFG_currentLevel.levelNumber ||
+    SFG_snapshots.levelFrameStart != SFG_currentLevel.frameStart))
+    SFG_clearSnapshots(); // can't rewind to another level
+
+  uint8_t *latest = SFG_snapshots.snapshots[SFG_snapshots.latest];
+  uint8_t *next = SFG_snapshots.snapshots[!SFG_snapshots.latest];
+
+  SFG_snapshotWrite(next);
+
+  if (SFG_snapshots.hasLatest)
+  {
+    uint16_t length = SFG_snapshotEncode(latest,next,SFG_snapshots.delta);
+
+    if (length > SFG_SNAPSHOT_BUFFER_SIZE)
+      SFG_snapshots.count = 0; // doesn't fit at all, history is lost
+    else
+    {
+      uint16_t start = 0, newestStart = 0;
+
+      if (SFG_snapshots.count > 0)
+      {
+        uint16_t newest = (SFG_snapshots.oldest + SFG_snapshots.count - 1) %
+          SFG_SNAPSHOT_COUNT;
+
+        newestStart = SFG_snapshots.deltaStart[newest];
+        start = newestStart + SFG_snapshots.deltaLength[newest];
+      }
+
+      uint8_t wrapped = start + length > SFG_SNAPSHOT_BUFFER_SIZE;
+
+      if (wrapped)
+        start = 0;
+
+      /* Drop the oldest deltas while there are too many or they're in the way.
+         When going back to the buffer start, the ones behind the newest one
+         are older than the ones at the start, so they go first. */
+      while (SFG_snapshots.count > 0)
+      {
+        uint16_t oldStart = SFG_snapshots.deltaStart[SFG_snapshots.oldest];
+
+        if (SFG_snapshots.count < SFG_SNAPSHOT_COUNT &&
+          !(wrapped && oldStart > newestStart) &&
+          (oldStart >= start + length ||
+           oldStart + SFG_snapshots.deltaLength[SFG_snapshots.oldest] <=
+           start))
+          break;
+
+        SFG_snapshots.oldest = (SFG_snapshots.oldest + 1) % SFG_SNAPSHOT_COUNT;
+        SFG_snapshots.count--;
+      }
+
+      uint16_t index = (SFG_snapshots.oldest + SFG_snapshots.count) %
+        SFG_SNAPSHOT_COUNT;
+
+      SFG_snapshots.deltaStart[index] = start;
+      SFG_snapshots.deltaLength[index] = length;
+
+      for (uint16_t i = 0; i < length; ++i)
+        SFG_snapshots.deltas[start + i] = SFG_snapshots.delta[i];
+
+      SFG_snapshots.count++;
+    }
+
+    SFG_SNAPSHOT_STATS(length,SFG_snapshots.count);
+  }
+
+  SFG_snapshots.latest = !SFG_snapshots.latest;
+  SFG_snapshots.hasLatest = 1;
+  SFG_snapshots.levelNumber = SFG_currentLevel.levelNumber;
+  SFG_snapshots.levelFrameStart = SFG_currentLevel.frameStart;
+}
+
+/**
+  Rewinds the game by given number of steps, at most as many as there are
+  snapshots of (in the current level). Returns the number of steps rewound.
+*/
+uint16_t SFG_rewind(uint16_t steps)
+{
+  uint16_t rewound = 0;
+  uint8_t *latest = SFG_snapshots.snapshots[SFG_snapshots.latest];
+
+  while (rewound < steps && SFG_snapshots.count > 0)
+  {
+    uint16_t newest = (SFG_snapshots.oldest + SFG_snapshots.count - 1) %
+      SFG_SNAPSHOT_COUNT;
+
+    SFG_snapshotDecode(latest,
+      SFG_snapshots.deltas + SFG_snapshots.deltaStart[newest],
+      SFG_snapshots.deltaLength[newest]);
+
+    SFG_snapshots.count--;
+    rewound++;
+  }
+
+  if (rewound > 0)
+  {
+    uint32_t frameTime = SFG_game.frameTime;
+
+    SFG_snapshotRead(latest);
+
+    SFG_snapshots.timeShift += SFG_game.frameTime - frameTime;
+  }
+
+  return rewound;
+}
+#endif // SFG_SNAPSHOTS
+
+#if SFG_INTERPOLATION
+/**
+  Draws the game as it was timeSinceStep ms after the step before the last
+  one, i.e. between the last two steps, so that the frames are smooth even if
+  the simulation runs at a low rate.
+*/
+void SFG_drawInterpolated(int32_t timeSinceStep)
+{
+  RCL_Camera camera = SFG_player.camera;
+
+  SFG_interpolation.alpha = RCL_min(RCL_UNITS_PER_SQUARE,
+    (timeSinceStep * RCL_UNITS_PER_SQUARE) / SFG_MS_PER_FRAME);
+
+  if (RCL_abs(camera.position.x - SFG_interpolation.cameraPosition.x) +
+    RCL_abs(camera.position.y - SFG_interpolation.cameraPosition.y) <
+    2 * RCL_UNITS_PER_SQUARE) // not after teleporting or starting a level
+  {
+    RCL_Unit turn = camera.direction - SFG_interpolation.cameraDirection;
+
+    // turn the shorter way
+    if (turn > RCL_UNITS_PER_SQUARE / 2)
+      turn -= RCL_UNITS_PER_SQUARE;
+    else if (turn < -1 * RCL_UNITS_PER_SQUARE / 2)
+      turn += RCL_UNITS_PER_SQUARE;
+
+    SFG_player.camera.position.x = SFG_interpolate(
+      SFG_interpolation.cameraPosition.x,camera.position.x,
+      SFG_interpolation.alpha);
+
+    SFG_player.camera.position.y = SFG_interpolate(
+      SFG_interpolation.cameraPosition.y,camera.position.y,
+      SFG_interpolation.alpha);
+
+    SFG_player.camera.height = SFG_interpolate(
+      SFG_interpolation.cameraHeight,camera.height,SFG_interpolation.alpha);
+
+    SFG_player.camera.direction = RCL_wrap(
+      SFG_interpolation.cameraDirection +
+      (turn * SFG_interpolation.alpha) / RCL_UNITS_PER_SQUARE,
+      RCL_UNITS_PER_SQUARE);
+  }
+
+  SFG_draw();
+
+  SFG_player.camera = camera;
+}
+#endif
+
 uint8_t SFG_mainLoopBody()
 {
   /* Standard deterministic game loop, independed of actual achieved FPS.
@@ -4960,12 +6861,21 @@ uint8_t SFG_mainLoopBody()
 
   if (SFG_game.state != SFG_GAME_STATE_INIT)
   {
+#if SFG_HEADLESS
+    // virtual time, exactly one step per call
+    uint32_t timeNow = SFG_game.frameTime + SFG_MS_PER_FRAME;
+#else
     uint32_t timeNow = SFG_getTimeMs();
+#endif
 
 #if SFG_TIME_MULTIPLIER != 1024
     timeNow = (timeNow * SFG_TIME_MULTIPLIER) / 1024;
 #endif
 
+#if SFG_SNAPSHOTS && !SFG_HEADLESS
+    timeNow += SFG_snapshots.timeShift;
+#endif
+
     int32_t timeSinceLastFrame = timeNow - SFG_game.frameTime;
 
     if (timeSinceLastFrame >= SFG_MS_PER_FRAME)
@@ -4980,8 +6890,19 @@ uint8_t SFG_mainLoopBody()
 
         SFG_game.frameTime += SFG_MS_PER_FRAME;
 
+#if SFG_INTERPOLATION
+        SFG_interpolation.cameraPosition = SFG_player.camera.position;
+        SFG_interpolation.cameraHeight = SFG_player.camera.height;
+        SFG_interpolation.cameraDirection = SFG_player.camera.direction;
+#endif
+
         SFG_gameStep();
 
+#if SFG_SNAPSHOTS
+        if (SFG_game.state == SFG_GAME_STATE_PLAYING)
+          SFG_pushSnapshot();
+#endif
+
         if (SFG_player.weapon != previousWeapon)
           SFG_processEvent(SFG_EVENT_PLAYER_CHANGES_WEAPON,SFG_player.weapon);
 
@@ -5001,16 +6922,29 @@ uint8_t SFG_mainLoopBody()
         SFG_game.antiSpam--;
 
       // render only once
+#if SFG_HEADLESS
+      // nothing is drawn
+#elif SFG_INTERPOLATION
+      SFG_drawInterpolated(timeSinceLastFrame);
+#else
       SFG_draw();
+#endif
 
+#if !SFG_HEADLESS
       if (SFG_game.frame % 16 == 0)
         SFG_CPU_LOAD(((SFG_getTimeMs() - timeNow) * 100) / SFG_MS_PER_FRAME);
+#endif
     }
     else
     {
+#if SFG_INTERPOLATION
+      // no step to do, draw a frame further between the last two steps
+      SFG_drawInterpolated(timeSinceLastFrame);
+#else
       // wait, relieve CPU
       SFG_sleepMs(RCL_max(1,
         (3 * (SFG_game.frameTime + SFG_MS_PER_FRAME - timeNow)) / 4));
+#endif
     }
   }
   else if (!SFG_keyPressed(SFG_KEY_A) && !SFG_keyPressed(SFG_KEY_B))
@@ -5023,6 +6957,21 @@ uint8_t SFG_mainLoopBody()
   return SFG_game.continues;
 }
 
+void SFG_getRunState(SFG_RunState *state)
+{
+  state->levelNumber = SFG_currentLevel.levelNumber;
+  state->health = SFG_player.health;
+  state->kills = 0;
+  state->monsters = SFG_currentLevel.monsterRecordCount;
+
+  for (uint8_t i = 0; i < SFG_currentLevel.monsterRecordCount; ++i)
+    if (SFG_currentLevel.monsterRecords[i].health == 0)
+      state->kills++;
+
+  state->levelWon = SFG_game.state == SFG_GAME_STATE_WIN;
+  state->steps = SFG_game.frame;
+}
+
 #undef SFG_SAVE_TOTAL_TIME
 
 #endif // guard
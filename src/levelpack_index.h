@@ -0,0 +1,14 @@
+/* Generated by tools/mklevels.c, don't edit. */
+
+#ifndef LEVELPACK_INDEX_H
+#define LEVELPACK_INDEX_H
+
+#define LEVELPACK_LEVEL_SIZE 4622
+#define LEVELPACK_MAX_SECTORS 2
+
+static const unsigned char levelpack_sectors[10] = { 0, 1, 3, 5, 6, 7, 9, 11, 12, 14 };
+static const unsigned short levelpack_sizes[10] = { 1532, 2149, 2444, 1817, 1428, 2250, 2272, 1976, 2111, 1674 };
+
+#define LEVELPACK_SIZE 30720
+
+#endif
@@ -169,6 +169,8 @@ static inline SFG_TileDefinition SFG_getMapTile
 
 #define SFG_NUMBER_OF_LEVELS 10
 
+#if !SFG_LEVEL_PACK // with a level pack the frontend loads them, see SFG_loadLevel
+
 /*
   NOTE: Initially the levels were stored sequentially in one big array, but that
   caused some issues with Arduino's PROGMEM, so now we store each level in a
@@ -1979,5 +1981,7 @@ static const SFG_Level * SFG_levels[SFG_NUMBER_OF_LEVELS] =
   &SFG_level6, &SFG_level7, &SFG_level8, &SFG_level9
 };
 
+#endif // !SFG_LEVEL_PACK
+
 #endif // guard
 
@@ -0,0 +1,68 @@
+/*
+ * Gameblabla small PCFX lib Copyright 2024
+ * Licensed under MIT license
+ * See LICENSE file for more
+*/
+
+#include "lz.h"
+
+void LZ_Init(lz_stream_t* lz, const void* src, void* dst, uint32_t size)
+{
+	lz->src = src;
+	lz->dst = dst;
+	lz->left = size;
+}
+
+/*
+ * Decodes tokens until at least max_out bytes were written (or everything was), so a
+ * big asset can be unpacked a bit at a time. Returns 1 once it's all there.
+*/
+int LZ_Decode_Step(lz_stream_t* lz, uint32_t max_out)
+{
+	const uint8_t* src = lz->src;
+	uint8_t* dst = lz->dst;
+	uint32_t left = lz->left;
+	uint32_t stop = left > max_out ? left - max_out : 0;
+	
+	while (left > stop)
+	{
+		uint32_t t = *src++;
+		uint32_t n;
+		
+		if (t < 0x80)
+		{
+			n = t + 1;
+			left -= n;
+			while (n--) *dst++ = *src++;
+		}
+		else if (t < 0xC0)
+		{
+			uint8_t v = *src++;
+			n = t - 0x80 + LZ_MIN_MATCH;
+			left -= n;
+			while (n--) *dst++ = v;
+		}
+		else
+		{
+			const uint8_t* from = dst - (src[0] | (src[1] << 8));
+			src += 2;
+			n = t - 0xC0 + LZ_MIN_MATCH;
+			left -= n;
+			while (n--) *dst++ = *from++; // may overlap, byte by byte on purpose
+		}
+	}
+	
+	lz->src = src;
+	lz->dst = dst;
+	lz->left = left;
+	
+	return left == 0;
+}
+
+void LZ_Decode(const void* src, void* dst, uint32_t size)
+{
+	lz_stream_t lz;
+	
+	LZ_Init(&lz, src, dst, size);
+	LZ_Decode_Step(&lz, size);
+}
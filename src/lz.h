@@ -0,0 +1,34 @@
+#ifndef LZ_H
+#define LZ_H
+
+#include <stdint.h>
+
+/*
+ * Byte oriented LZ/RLE format of the packed assets (tools/mklevels.c packs them), made
+ * to decode fast on the V810 : no bit reading, every token starts on a byte.
+ *
+ *   0x00 - 0x7F : (t + 1) literal bytes follow
+ *   0x80 - 0xBF : run, the next byte repeated (t - 0x80 + LZ_MIN_MATCH) times
+ *   0xC0 - 0xFF : match, (t - 0xC0 + LZ_MIN_MATCH) bytes copied from the output,
+ *                 the 16 bit little endian distance back follows
+*/
+
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_LITERALS 128
+#define LZ_MAX_MATCH (64 + LZ_MIN_MATCH - 1)
+#define LZ_MAX_DISTANCE 65535
+
+typedef struct
+{
+	const uint8_t* src;
+	uint8_t* dst;
+	uint32_t left;    // bytes still to write
+} lz_stream_t;
+
+extern void LZ_Init(lz_stream_t* lz, const void* src, void* dst, uint32_t size);
+
+extern int LZ_Decode_Step(lz_stream_t* lz, uint32_t max_out);
+
+extern void LZ_Decode(const void* src, void* dst, uint32_t size);
+
+#endif
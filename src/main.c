@@ -33,11 +33,13 @@
 // #define SFG_INFINITE_AMMO 1
 // #define SFG_TIME_MULTIPLIER 512
 // #define SFG_CPU_LOAD(percent) printf("CPU load: %d%\n",percent);
+// #define SFG_AI_STATS(updated,lag) printf("AI: %d updates, %d frames late\n",updated,lag);
 // #define GAME_LQ
 
 
 // lower quality
-#define SFG_FPS 20
+#define SFG_INTERPOLATION 1 // drawn in between steps, so fewer of them look smooth
+#define SFG_FPS 15
 #define SFG_RAYCASTING_SUBSAMPLE 3
 #define SFG_DIMINISH_SPRITES 0
 #define SFG_DITHERED_SHADOW 0
@@ -47,6 +49,16 @@
 #define SFG_RAYCASTING_VISIBILITY_MAX_HITS 6
 #define SFG_CAN_EXIT 0
 #define SFG_DRAW_LEVEL_BACKGROUND 1
+#define SFG_HUD_LAYER 1
+#define SFG_HARDWARE_WEAPON 1
+#define SFG_PALETTE_EFFECTS 1
+#define SFG_MONSTER_FLOW_FIELD 1
+#define SFG_AI_SCHEDULER 1
+#define SFG_INPUT_RECORDS 1 // every level is recorded, see Replay_Switch
+#ifndef FXUPLOADER
+#define SFG_LEVEL_PACK 1 // the levels are read from the CD, see SFG_loadLevel
+#define SFG_LEVEL_PREFETCH 1
+#endif
 
 #define SFG_PLAYER_DAMAGE_MULTIPLIER 1024
 #define SDL_MUSIC_VOLUME 16
@@ -67,11 +79,34 @@
 #include "game_constants.h"
 #include "shared_objects.h"
 
-uint32_t ticks = 0;
 extern uint32_t nframe;
 
 //#define DEBUGFPS 1
 
+/*
+ * Plays the bytebeat soundtrack of sounds.h on ADPCM channel 1 instead of the CD-DA
+ * tracks, this is the only music there is without a CD (FXUPLOADER).
+*/
+//#define MUSIC_BYTEBEAT 1
+#if defined(FXUPLOADER) && !defined(MUSIC_BYTEBEAT)
+#define MUSIC_BYTEBEAT 1
+#endif
+
+/*
+ * Records every sound request, drop and start in audio_trace (see audiotrace.h), to
+ * find out how late the sounds start and why some don't.
+*/
+//#define AUDIO_TRACE 1
+#ifdef AUDIO_TRACE
+#include "audiotrace.h"
+#define SFG_SOUND_TRACE(soundIndex,volume,dropped) { \
+	Audio_Trace(AUDIO_EVENT_REQUEST, soundIndex, 255, volume, SFG_game.frame); \
+	if (dropped) Audio_Trace(AUDIO_EVENT_DROP_FRAME, soundIndex, 255, volume, SFG_game.frame); }
+#define AUDIO_EVENT(type, sound, voice, volume) Audio_Trace(type, sound, voice, volume, SFG_game.frame)
+#else
+#define AUDIO_EVENT(type, sound, voice, volume) {}
+#endif
+
 #if 0
 #define SFG_SCREEN_RESOLUTION_X 256
 #define SFG_SCREEN_RESOLUTION_Y 240
@@ -117,7 +152,9 @@ uint32_t framebuffer[(256*240)/4];
 #define SFG_SCREEN_RESOLUTION_X 128
 #define SFG_SCREEN_RESOLUTION_Y 120
 #define SFG_RESOLUTION_SCALEDOWN 1
-uint32_t framebuffer[(256*240)/4];
+// two buffers : one is drawn into while the other one is uploaded (see Present_Frame)
+uint32_t framebuffers[2][(256*240)/4];
+uint32_t *framebuffer = framebuffers[0];
 static inline void SFG_setPixel(uint32_t x, uint32_t y, uint32_t colorIndex)
 {
     // Calculate the index into the framebuffer, accounting for the spacing
@@ -136,7 +173,14 @@ static inline void SFG_setPixel(uint32_t x, uint32_t y, uint32_t colorIndex)
 #include "sounds.h"
 #include "fastking.h"
 #include "pcfx.h"
-#include "snd.h"
+#include "soundbank.h"
+#include "adpcmstream.h"
+#include "cdqueue.h"
+#include "sndbank_index.h"
+#ifdef FXUPLOADER
+#include "sndbank_data.h"
+#endif
+#include "lbas.h"
 
 
 #define KRAM_PAGE0 0x00000000
@@ -151,7 +195,34 @@ static inline void SFG_setPixel(uint32_t x, uint32_t y, uint32_t colorIndex)
 #define CDDA_LOOP 0x04
 
 
-#define WAIT_CD 0x800
+/*
+ * CD-DA commands that found the CD queue full wait here and are queued again before the next
+ * poll (cd_audio_retry), so a music change isn't lost. A new start command replaces the ones
+ * still waiting, they were for an older change.
+*/
+static u8 cddaWaiting[2][10];
+static int cddaWaitingCount = 0;
+
+static void cd_audio(const u8 cmd[10])
+{
+	if (cmd[0] == 0xD8)
+		cddaWaitingCount = 0;
+
+	if (cddaWaitingCount == 0 && CD_Queue_Audio(cmd) == 0)
+		return;
+
+	if (cddaWaitingCount < 2)
+		memcpy(cddaWaiting[cddaWaitingCount++], cmd, 10);
+}
+
+static void cd_audio_retry()
+{
+	while (cddaWaitingCount && CD_Queue_Audio(cddaWaiting[0]) == 0)
+	{
+		cddaWaitingCount--;
+		memmove(cddaWaiting[0], cddaWaiting[1], 10);
+	}
+}
 
 static void cd_start_track(u8 start)
 {	
@@ -161,7 +232,6 @@ static void cd_start_track(u8 start)
 	 * 0xD8 is for the starting track and 0xD9 is for the ending track as well and controlling whenever
 	 * or not the track should loop (after it's done playing).
 	*/
-	int r10;
 	u8 scsicmd10[10];
 	memset(scsicmd10, 0, sizeof(scsicmd10));
 	
@@ -169,23 +239,9 @@ static void cd_start_track(u8 start)
 	scsicmd10[1] = 0x00;
 	scsicmd10[2] = start;
 	scsicmd10[9] = 0x80; // 0x80, 0x40 LBA, 0x00 MSB, Other : Illegal
-	eris_low_scsi_command(scsicmd10,10);
-
-	/* Same here. Without this, it will freeze the whole application. */
-	r10 = WAIT_CD; 
-    while (r10 != 0) {
-        r10--;
-		__asm__ (
-        "nop\n"
-        "nop\n"
-        "nop\n"
-        "nop"
-        :
-        :
-        :
-		);
-    }
-	eris_low_scsi_status();
+	
+	// sent and waited for by CD_Queue_Poll, the game doesn't stop for the drive
+	cd_audio(scsicmd10);
 }
 
 static void cd_end_track(u8 end, u8 loop)
@@ -196,7 +252,6 @@ static void cd_end_track(u8 end, u8 loop)
 	 * 0xD8 is for the starting track and 0xD9 is for the ending track as well and controlling whenever
 	 * or not the track should loop (after it's done playing).
 	*/
-	int r10;
 	u8 scsicmd10[10];
 	
 	memset(scsicmd10, 0, sizeof(scsicmd10));
@@ -205,24 +260,7 @@ static void cd_end_track(u8 end, u8 loop)
 	scsicmd10[2] = end;
 	scsicmd10[9] = 0x80; // 0x80, 0x40 LBA, 0x00 MSB, Other : Illegal
 
-	eris_low_scsi_command(scsicmd10,10);
-	
-	/* Same here. Without this, it will freeze the whole application. */
-	r10 = WAIT_CD; 
-    while (r10 != 0) {
-        r10--;
-		__asm__ (
-        "nop\n"
-        "nop\n"
-        "nop\n"
-        "nop"
-        :
-        :
-        :
-		);
-    }
-	eris_low_scsi_status();
-
+	cd_audio(scsicmd10);
 }
 
 
@@ -246,7 +284,8 @@ void SFG_setPixel(uint16_t x, uint16_t y, uint8_t colorIndex)
 
 uint32_t SFG_getTimeMs()
 {
-  return ticks * 100;
+  // the timer set up by initTimer ticks every 1423 / (21.47727 MHz / 15) = 1 ms
+  return getTicks();
 }
 
 void SFG_save(uint8_t data[SFG_SAVE_SIZE])
@@ -292,10 +331,10 @@ uint8_t SFG_load(uint8_t data[SFG_SAVE_SIZE])
 }
 
 void SFG_sleepMs(uint16_t timeMs)
-{/*
-#ifndef __EMSCRIPTEN__
-  usleep(timeMs * 1000);
-#endif*/
+{
+	const int end = getTicks() + timeMs;
+
+	while (getTicks() < end) { }
 }
 
 
@@ -335,10 +374,419 @@ void SFG_getMouseOffset(int16_t *x, int16_t *y)
 */
 }
 
+/*
+ * The HUD bar lives on BG1 (16 colors, see Set_BG1_Layer) and is only uploaded
+ * when it changes, so each frame only the 3D view part of BG0 has to be sent.
+*/
+#define HUD_KRAM_ADDR 0x8000 // right after BG0 (256*240 bytes = 0x7800 words)
+#define HUD_PAL_OFFSET 0x1F0 // 0x100-0x1EF are for the sprites
+#define HUD_SCREEN_Y ((SFG_SCREEN_RESOLUTION_Y - SFG_HUD_BAR_HEIGHT) * 2)
+#define HUD_SCREEN_LINES (SFG_HUD_BAR_HEIGHT * 2)
+#define VIEW_UPLOAD_SIZE (HUD_SCREEN_Y * 256)
+
+// game colors the HUD is drawn with, in the order of their BG1 color
+static const uint8_t hudColors[] = { 48, 61, 0, 170, 6, 175, 93, 124, 60 };
+
+extern unsigned short mypal[256];
+
+static uint8_t hudNibble[256];
+static uint8_t hudbuf[HUD_SCREEN_LINES * 128];
+static uint8_t hudOnScreen = 0;
+
+static void Init_HUD()
+{
+	int i;
+
+	memset(hudNibble, 1, sizeof(hudNibble));
+
+	eris_tetsu_set_palette(HUD_PAL_OFFSET, 0x0088); // transparent anyway
+
+	for (i = 0; i < sizeof(hudColors); i++)
+	{
+		// color 0 of BG1 is transparent, so start at 1
+		hudNibble[hudColors[i]] = i + 1;
+		eris_tetsu_set_palette(HUD_PAL_OFFSET + i + 1, mypal[hudColors[i]]);
+	}
+
+	Set_BG1_Layer(HUD_KRAM_ADDR, HUD_PAL_OFFSET);
+}
+
+static void Upload_HUD()
+{
+	int x, y;
+	const uint8_t *src;
+	uint8_t *dst = hudbuf;
+
+	for (y = 0; y < HUD_SCREEN_LINES; y++)
+	{
+		src = ((uint8_t *) framebuffer) + (HUD_SCREEN_Y + y) * 256;
+
+		// one game pixel is two screen pixels, i.e. one byte at 4bpp
+		for (x = 0; x < SFG_SCREEN_RESOLUTION_X; x++)
+		{
+			uint8_t n = hudNibble[src[x << 1]];
+			*dst++ = (n << 4) | n;
+		}
+	}
+
+	Present_Lock();
+	eris_king_set_kram_write(HUD_KRAM_ADDR + HUD_SCREEN_Y * 64, 1);
+	king_kram_write_buffer(hudbuf, sizeof(hudbuf));
+	Present_Unlock();
+}
+
+/*
+ * ADPCM samples, kept in KRAM by the sound bank (see soundbank.c). Only the ones a
+ * level can play are made resident when it starts, the menu only needs the click.
+ * They are encoded at build time by tools/mkbank.c into sndbank.bin, each sample on
+ * its own CD sectors, and read from the CD straight to KRAM when they're made
+ * resident, so they take no RAM. Without a CD (FXUPLOADER) they're in the executable
+ * instead (sndbank_data.h).
+*/
+#define SND_KRAM_START 0
+#define SND_KRAM_END (4096*7)
+
+static soundbank_entry_t sndManifest[SNDBANK_COUNT];
+
+static void Load_Sound_Bank()
+{
+	int i;
+	
+	for (i = 0; i < SNDBANK_COUNT; i++)
+	{
+		#ifdef FXUPLOADER
+		sndManifest[i].data = sndbank_data[i];
+		sndManifest[i].lba = 0;
+		#else
+		sndManifest[i].data = 0;
+		sndManifest[i].lba = BINARY_LBA_SNDBANK_BIN + sndbank_offsets[i] / 2048;
+		#endif
+		sndManifest[i].size = sndbank_sizes[i];
+	}
+}
+
+/*
+ * Makes the sounds resident and waits until they're in KRAM. A read that found the
+ * CD queue full left its sample out, it's asked for again once the queue is empty.
+*/
+static void Load_Sounds(u32 sounds)
+{
+	Soundbank_Load(sounds);
+	CD_Queue_Flush();
+	Soundbank_Load(sounds);
+	CD_Queue_Flush();
+}
+
+#if SFG_LEVEL_PACK
+#include "levelpack_index.h"
+#include "lz.h"
+
+/*
+ * The levels in RAM : the one being played and the next one, prefetched during the win
+ * screen (SFG_LEVEL_PREFETCH). Their packed data (see lz.h) is read from levels.bin
+ * (built by tools/mklevels.c) on the CD and unpacked a bit per call, SFG_loadLevel
+ * returns 0 until it's done.
+*/
+#define LEVEL_UNPACK_STEP 1024 // bytes unpacked per SFG_loadLevel call
+
+static SFG_Level levelSlots[2];
+static int8_t levelSlotNumber[2] = { -1, -1 };
+static uint8_t levelSlotCurrent;
+static uint8_t levelPacked[LEVELPACK_MAX_SECTORS * 2048];
+static lz_stream_t levelLz;
+static int8_t levelLoading = -1;
+static volatile uint8_t levelRead;
+
+static void Level_Read_Done(void* arg, u32 tag)
+{
+	// an older read for another level may finish first
+	if (tag == (u32)levelLoading) levelRead = 1;
+}
+
+const SFG_Level *SFG_loadLevel(uint8_t levelNumber)
+{
+	uint8_t slot = levelSlotCurrent ^ 1;
+	
+	// restarting a level doesn't read it again, the game never changes it
+	if (levelSlotNumber[levelSlotCurrent] == levelNumber) return &levelSlots[levelSlotCurrent];
+	
+	if (levelSlotNumber[slot] == levelNumber)
+	{
+		levelSlotCurrent = slot;
+		return &levelSlots[slot];
+	}
+	
+	if (levelLoading != levelNumber)
+	{
+		// the queue may be full (CD-DA retries, PSG refills), it's polled to make room
+		// and the read is asked again next call
+		if (CD_Queue_Read(BINARY_LBA_LEVELS_BIN + levelpack_sectors[levelNumber], levelPacked,
+			levelpack_sizes[levelNumber], Level_Read_Done, 0, levelNumber))
+		{
+			CD_Queue_Poll();
+			return 0;
+		}
+		
+		levelLoading = levelNumber;
+		levelRead = 0;
+		return 0;
+	}
+	
+	if (!levelRead)
+	{
+		CD_Queue_Poll();
+		if (!levelRead) return 0;
+		levelSlotNumber[slot] = -1;
+		LZ_Init(&levelLz, levelPacked, &levelSlots[slot], LEVELPACK_LEVEL_SIZE);
+		levelRead = 2;
+	}
+	
+	if (!LZ_Decode_Step(&levelLz, LEVEL_UNPACK_STEP)) return 0;
+	
+	levelLoading = -1;
+	levelSlotNumber[slot] = levelNumber;
+	levelSlotCurrent = slot;
+	
+	return &levelSlots[slot];
+}
+#endif
+
+static u32 Level_Sounds()
+{
+	int i;
+	u32 sounds = (1 << SNDBANK_CLICK) | (1 << SNDBANK_SHOT) | (1 << SNDBANK_EXPLOSION) | (1 << SNDBANK_MONSTER);
+
+	if (SFG_currentLevel.doorRecordCount)
+		sounds |= 1 << SNDBANK_DOOR;
+
+	// plasma is also the teleport sound
+	for (i = 0; i < SFG_MAX_LEVEL_ELEMENTS; i++)
+	{
+		uint8_t type = SFG_currentLevel.levelPointer->elements[i].type;
+
+		if (type == SFG_LEVEL_ELEMENT_PLASMA || type == SFG_LEVEL_ELEMENT_TELEPORTER ||
+			type == SFG_LEVEL_ELEMENT_MONSTER_PLASMABOT)
+			sounds |= 1 << SNDBANK_PLASMA;
+	}
+
+	return sounds;
+}
+
+#if SFG_INPUT_RECORDS
+/*
+ * Each level is recorded from its start (SFG_INPUT_RECORDS) into inputRecord.
+ * Pressing select (the weapon cycling key, which the menu doesn't use) in the menu
+ * plays the record back from the start of the level, again on every press, then the
+ * game goes on with the pad. The record stays in RAM, from where it can be taken
+ * (e.g. in an emulator debugger) for a bug report and played back on the host with
+ * tools/replay.c.
+*/
+#define INPUT_RECORD_SIZE 16384 // 6 minutes if every step had new keys, usually far more
+#define PAD_SELECT (1 << 6)     // as read for SFG_KEY_CYCLE_WEAPON
+
+static uint8_t inputRecord[INPUT_RECORD_SIZE];
+#endif
+
 void SFG_processEvent(uint8_t event, uint8_t data)
 {
+	switch (event)
+	{
+		case SFG_EVENT_HUD_CHANGED:
+			Upload_HUD();
+		break;
+		case SFG_EVENT_LEVEL_STARTS:
+			Load_Sounds(Level_Sounds());
+#if SFG_INPUT_RECORDS
+			if (SFG_inputRecord.mode != SFG_INPUT_RECORD_PLAYING)
+				SFG_recordInput(inputRecord, INPUT_RECORD_SIZE);
+#endif
+		break;
+		default:
+		break;
+	}
+}
+
+
+/*
+ * The weapon is shown with 7up sprites: each 32x32 image is doubled like the
+ * rest of the screen and cut into two 32x64 sprites. The weapon is uploaded
+ * when it changes and the fire flash once at start.
+*/
+#define WEAPON_CHIP VDC_CHIP_1
+#define WEAPON_VRAM 0x4000
+#define FLASH_VRAM 0x4400
+#define WEAPON_PAL 0
+#define FLASH_PAL 1
+#define SPR_PAL_BASE 0x100
+
+#if SFG_WEAPON_IMAGE_SCALE != 1
+  #error "the weapon sprites are made for SFG_WEAPON_IMAGE_SCALE 1"
+#endif
+
+static unsigned short spritebuf[2 * 8 * 64];
+static uint8_t spriteWeapon = SFG_WEAPON_OVERLAY_HIDE;
+
+static void Upload_Sprite_Image(const uint8_t *image, int vram_addr, int pal)
+{
+	uint8_t remap[16];
+	int i, t, x, y, sx, sy;
+	unsigned short *pattern;
+
+	// sprite color 0 is transparent, so the transparent color of the image has to go there
+	t = 15;
+	for (i = 1; i < 16; i++)
+	{
+		if (image[i] == SFG_TRANSPARENT_COLOR)
+		{
+			t = i;
+			break;
+		}
+	}
+
+	Present_Lock(); // the palette writes
+	for (i = 0; i < 16; i++)
+	{
+		if (image[i] == SFG_TRANSPARENT_COLOR)
+		{
+			remap[i] = 0;
+		}
+		else
+		{
+			remap[i] = i ? i : t;
+			eris_tetsu_set_palette(SPR_PAL_BASE + pal * 16 + remap[i], mypal[image[i]]);
+		}
+	}
+	Present_Unlock();
+
+	memset(spritebuf, 0, sizeof(spritebuf));
+
+	for (y = 0; y < 64; y++)
+	{
+		for (x = 0; x < 64; x++)
+		{
+			int u = x >> 1, v = y >> 1;
+			uint8_t n = remap[(image[16 + (u * SFG_TEXTURE_SIZE + v) / 2] >> (4 * (v % 2 == 0))) & 0x0f];
+
+			if (!n) continue;
+
+			// 2x4 patterns of 16x16 per sprite, 4 bitplanes of 16 words per pattern
+			sx = x & 31;
+			sy = y;
+			pattern = spritebuf + (x >> 5) * 8 * 64 + ((sy >> 4) * 2 + (sx >> 4)) * 64;
+
+			for (i = 0; i < 4; i++)
+			{
+				if (n & (1 << i))
+					pattern[i * 16 + (sy & 15)] |= 0x8000 >> (sx & 15);
+			}
+		}
+	}
+
+	Upload_Sprite_Data(WEAPON_CHIP, spritebuf, sizeof(spritebuf) / 2, vram_addr);
+}
+
+static void Init_Weapon_Sprites()
+{
+	int i;
+
+	Init_Sprite(WEAPON_CHIP);
+	Upload_Sprite_Image(SFG_effectSprites, FLASH_VRAM, FLASH_PAL);
+
+	for (i = 0; i < 4; i++)
+		Hide_Sprite(WEAPON_CHIP, i);
+}
+
+void SFG_setWeaponOverlay(uint8_t weapon, int16_t x, int16_t y, int16_t flashY)
+{
+	int i;
+
+	if (weapon == SFG_WEAPON_OVERLAY_HIDE)
+	{
+		for (i = 0; i < 4; i++)
+			Hide_Sprite(WEAPON_CHIP, i);
+		return;
+	}
+
+	if (weapon != spriteWeapon)
+	{
+		Upload_Sprite_Image(SFG_weaponImages + weapon * SFG_TEXTURE_STORE_SIZE, WEAPON_VRAM, WEAPON_PAL);
+		spriteWeapon = weapon;
+	}
+
+	x *= 2;
+
+	// lower sprite numbers are on top, the weapon covers the flash
+	Set_Sprite(WEAPON_CHIP, 0, x, y * 2, WEAPON_VRAM / 64, SPR_SIZE_32X64, WEAPON_PAL);
+	Set_Sprite(WEAPON_CHIP, 1, x + 32, y * 2, WEAPON_VRAM / 64 + 8, SPR_SIZE_32X64, WEAPON_PAL);
+
+	if (flashY == SFG_WEAPON_OVERLAY_NO_FLASH)
+	{
+		Hide_Sprite(WEAPON_CHIP, 2);
+		Hide_Sprite(WEAPON_CHIP, 3);
+	}
+	else
+	{
+		Set_Sprite(WEAPON_CHIP, 2, x, flashY * 2, FLASH_VRAM / 64, SPR_SIZE_32X64, FLASH_PAL);
+		Set_Sprite(WEAPON_CHIP, 3, x + 32, flashY * 2, FLASH_VRAM / 64 + 8, SPR_SIZE_32X64, FLASH_PAL);
+	}
+}
+
+/*
+ * Palette effects : tinted copies of the palette are made at start, SFG_setPaletteEffect
+ * only picks one and queues it, the timer IRQ writes it during the vertical blank.
+ * Colors are YUV : 8 bits of Y, 4 bits of U and 4 bits of V.
+*/
+#define PAL_EFFECT_LEVELS 4
+
+static unsigned short effectPal[3][PAL_EFFECT_LEVELS][256];
+static unsigned short *currentPal = mypal;
+
+static unsigned short Tint_Color(unsigned short c, int u, int v, int y_keep, int mix)
+{
+	// mix is in 1/16
+	int y = c >> 8;
+	int cu = (c >> 4) & 0x0f;
+	int cv = c & 0x0f;
+
+	y = (y * y_keep) >> 4;
+	cu += ((u - cu) * mix) >> 4;
+	cv += ((v - cv) * mix) >> 4;
+
+	return (y << 8) | (cu << 4) | cv;
+}
+
+static void Init_Palette_Effects()
+{
+	int i, l, mix;
+
+	for (l = 0; l < PAL_EFFECT_LEVELS; l++)
+	{
+		mix = ((l + 1) * 8) / PAL_EFFECT_LEVELS; // up to a half of the tint
+
+		for (i = 0; i < 256; i++)
+		{
+			effectPal[SFG_PALETTE_EFFECT_HURT - 1][l][i] = Tint_Color(mypal[i], 5, 15, 16, mix);
+			effectPal[SFG_PALETTE_EFFECT_ITEM - 1][l][i] = Tint_Color(mypal[i], 3, 1, 16, mix);
+			// fades to a quarter of the brightness, shifted to red
+			effectPal[SFG_PALETTE_EFFECT_DEATH - 1][l][i] = Tint_Color(mypal[i], 6, 12, 16 - (l + 1) * 3, mix);
+		}
+	}
 }
 
+void SFG_setPaletteEffect(uint8_t effect, uint8_t strength)
+{
+	unsigned short *pal = mypal;
+	int level = (strength * PAL_EFFECT_LEVELS) / 256;
+
+	if (effect != SFG_PALETTE_EFFECT_NONE && strength)
+		pal = effectPal[effect - 1][level];
+
+	if (pal != currentPal)
+	{
+		currentPal = pal;
+		Queue_Palette(pal, 256);
+	}
+}
 
 static uint32_t padtype, paddata;
 
@@ -376,6 +824,28 @@ int8_t SFG_keyPressed(uint8_t key)
 
   #undef b
 }
+
+#if SFG_INPUT_RECORDS
+static uint32_t inputRecordLength, padPrevious;
+
+static void Replay_Switch()
+{
+	uint32_t pressed = paddata & ~padPrevious & PAD_SELECT;
+
+	padPrevious = paddata;
+
+	if (!pressed || SFG_game.state != SFG_GAME_STATE_MENU)
+		return;
+
+	uint32_t length = SFG_stopInput();
+
+	if (length)
+		inputRecordLength = length;
+
+	if (inputRecordLength)
+		SFG_playInput(inputRecord, inputRecordLength);
+}
+#endif
   
 int running = 1;
 
@@ -406,23 +876,365 @@ static inline char* myitoa(int val)
 }
 
 
+/*
+ * Voice manager : the two ADPCM channels are handed out to the sounds by score (the
+ * priority of the sound * 256 + its volume). A new sound takes a free channel or steals
+ * the one with the lowest score, if that score isn't higher than its own. Sounds are only
+ * started at the end of the frame, all of them with one Play_ADPCM_Voices call.
+ * With MUSIC_BYTEBEAT the second channel belongs to the music.
+*/
+#ifdef MUSIC_BYTEBEAT
+#define ADPCM_VOICES 1
+#else
+#define ADPCM_VOICES 2
+#endif
+#define SFX_COUNT 6
+
+typedef struct
+{
+	uint8_t sample;     // in the sound bank
+	uint8_t priority;
+} sfx_sample_t;
+
+typedef struct
+{
+	uint8_t sound;      // index of the sound playing, 255 = none
+	uint16_t score;
+	uint32_t start;     // time the sound started at, in ms
+	uint32_t end;       // time the sound ends at, in ms
+	uint32_t endAddr;   // KRAM address the sample ends at
+} voice_t;
+
+static const sfx_sample_t sfxSamples[SFX_COUNT] =
+{
+	{ SNDBANK_SHOT, 2 },       // 0 shot
+	{ SNDBANK_DOOR, 1 },       // 1 door
+	{ SNDBANK_EXPLOSION, 3 },  // 2 explosion
+	{ SNDBANK_CLICK, 0 },      // 3 click
+	{ SNDBANK_PLASMA, 2 },     // 4 plasma
+	{ SNDBANK_MONSTER, 2 },    // 5 monster
+};
+
+static voice_t voices[ADPCM_VOICES] = { [0 ... ADPCM_VOICES - 1] = { 255 } };
+static uint32_t voicesPending = 0;   // channels to start at the end of the frame
+static uint8_t voicesVolume[ADPCM_VOICES];
+
+void SFG_playSound(uint8_t soundIndex, uint8_t volume)
+{
+	int i, v = -1;
+	int32_t lowest = 0x7fffffff;
+	uint32_t now = getTicks();
+	uint16_t score;
+
+	if (volume == 0 || soundIndex >= SFX_COUNT) return;
+
+	if (Soundbank_Address(sfxSamples[soundIndex].sample) == SOUNDBANK_NOT_RESIDENT)
+	{
+		AUDIO_EVENT(AUDIO_EVENT_DROP_MISSING, soundIndex, 255, volume);
+		return; // not used by this level
+	}
+
+	score = sfxSamples[soundIndex].priority * 256 + volume;
+
+	for (i = 0; i < ADPCM_VOICES; i++)
+	{
+		int32_t s = (now >= voices[i].end && !(voicesPending & (1 << i))) ? -1 : voices[i].score;
+
+		// the same sound twice in one frame, just keep the louder one
+		if ((voicesPending & (1 << i)) && voices[i].sound == soundIndex)
+		{
+			if (score > voices[i].score)
+			{
+				voices[i].score = score;
+				voicesVolume[i] = volume;
+			}
+			AUDIO_EVENT(AUDIO_EVENT_MERGED, soundIndex, i, volume);
+			return;
+		}
+
+		if (s < lowest)
+		{
+			lowest = s;
+			v = i;
+		}
+	}
+
+	if (lowest > score)
+	{
+		AUDIO_EVENT(AUDIO_EVENT_DROP_BUSY, soundIndex, 255, volume);
+		return; // everything playing is more important
+	}
+
+	if (voicesPending & (1 << v))
+		AUDIO_EVENT(AUDIO_EVENT_REPLACED, voices[v].sound, v, voicesVolume[v]);
+
+	voices[v].sound = soundIndex;
+	voices[v].score = score;
+	voices[v].start = now;
+	// 4 bits per sample at 32 kHz, see Play_ADPCM for the size
+	voices[v].end = now + (Soundbank_Size(sfxSamples[soundIndex].sample) - 2048) / 16;
+	voices[v].endAddr = Soundbank_Address(sfxSamples[soundIndex].sample) +
+		((Soundbank_Size(sfxSamples[soundIndex].sample) - 2048) >> 1);
+	voicesVolume[v] = volume;
+	voicesPending |= 1 << v;
+
+	AUDIO_EVENT(AUDIO_EVENT_ACCEPT, soundIndex, v, volume);
+}
+
+/* Mask of the channels still playing a sound. */
+static uint32_t Voices_Playing()
+{
+	int i;
+	uint32_t playing = 0;
+	uint32_t now = getTicks();
+
+	for (i = 0; i < ADPCM_VOICES; i++)
+	{
+		if (now < voices[i].end)
+			playing |= 1 << i;
+	}
+
+	return playing;
+}
+
+static void Voices_Commit()
+{
+	int i;
+	uint32_t addr[ADPCM_VOICES], size[ADPCM_VOICES];
+	uint32_t playing = 0;
+	uint32_t now = getTicks();
+
+	if (!voicesPending) return;
+
+	for (i = 0; i < ADPCM_VOICES; i++)
+	{
+		if (voicesPending & (1 << i))
+		{
+			// engine volume is 0 to 255, ADPCM volume 0 to 63
+			eris_low_adpcm_set_volume(i, voicesVolume[i] >> 2, voicesVolume[i] >> 2);
+			addr[i] = Soundbank_Address(sfxSamples[voices[i].sound].sample);
+			size[i] = Soundbank_Size(sfxSamples[voices[i].sound].sample);
+			playing |= 1 << i;
+		}
+		else if (now < voices[i].end)
+		{
+			playing |= 1 << i;
+		}
+	}
+
+	// don't stop the music
+	playing |= Stream_Channel_Mask();
+
+	Present_Lock();
+	Play_ADPCM_Voices(voicesPending, addr, size, playing, ADPCM_RATE_32000);
+	Present_Unlock();
+
+	for (i = 0; i < ADPCM_VOICES; i++)
+	{
+		if (voicesPending & (1 << i))
+			AUDIO_EVENT(AUDIO_EVENT_START, voices[i].sound, i, voicesVolume[i]);
+	}
+
+	voicesPending = 0;
+}
+
+#ifdef MUSIC_BYTEBEAT
+/*
+ * Bytebeat music : SFG_getNextMusicSample gives 8 kHz samples and the ADPCM channels play
+ * at 32 kHz, so each one is repeated 4 times and encoded into the ring of the ADPCM stream
+ * (see adpcmstream.c) in batches. At most MUSIC_BUDGET batches are made per frame, which
+ * bounds the time it takes and is still more than a frame drawn every
+ * SCHED_MAX_RENDER_EVERY steps plays.
+*/
+#define MUSIC_CHANNEL 1
+#define MUSIC_KRAM_START (SND_KRAM_END | KRAM_PAGE1)
+#define MUSIC_KRAM_WORDS 8192           // 16 KB, half a second per half
+#define MUSIC_BATCH 256                 // bytebeat samples per batch
+#define MUSIC_BATCH_BYTES (MUSIC_BATCH * 4 / 2)
+#define MUSIC_BUDGET 8
+#define MUSIC_VOLUME 64                 // a quarter of full scale, under the sound effects
+
+static struct
+{
+	uint8_t on;
+	adpcm_state_t adpcm;
+	uint32_t batches;                   // made so far
+	uint32_t starved;                   // frames that used the whole budget
+} music;
+
+static void Music_Batch()
+{
+	short pcm[MUSIC_BATCH * 4];
+	unsigned char adpcm[MUSIC_BATCH_BYTES];
+	int i;
+
+	for (i = 0; i < MUSIC_BATCH; i++)
+	{
+		int16_t sample = SFG_getNextMusicSample();
+
+		sample = (sample - SFG_musicTrackAverages[SFG_MusicState.track]) * MUSIC_VOLUME;
+
+		pcm[i * 4] = sample;
+		pcm[i * 4 + 1] = sample;
+		pcm[i * 4 + 2] = sample;
+		pcm[i * 4 + 3] = sample;
+	}
+
+	ADPCM_Encode(&music.adpcm, pcm, MUSIC_BATCH * 4, adpcm);
+	Stream_Write(adpcm, MUSIC_BATCH_BYTES);
+
+	music.batches++;
+}
+
+static void Music_Update()
+{
+	int batches = 0;
+
+	if (!music.on) return;
+
+	while (Stream_Free() >= MUSIC_BATCH_BYTES)
+	{
+		if (batches == MUSIC_BUDGET)
+		{
+			music.starved++;
+			break;
+		}
+
+		Music_Batch();
+		batches++;
+	}
+
+	if (Stream_Ready())
+		Stream_Play(Voices_Playing());
+}
+
+static void Music_Start()
+{
+	if (music.on) return;
+
+	music.on = 1;
+	music.adpcm.prev = 0;
+	music.adpcm.index = 0;
+	Stream_Init(MUSIC_CHANNEL, MUSIC_KRAM_START, MUSIC_KRAM_WORDS);
+}
+
+static void Music_Stop()
+{
+	if (!music.on) return;
+
+	music.on = 0;
+	Stream_Stop(Voices_Playing());
+}
+#endif
+
+/*
+ * Frame scheduler : SFG_mainLoopBody does as many game steps as the time that passed
+ * requires and then draws once. If drawing a frame costs more than one step (SFG_MS_PER_FRAME),
+ * the game is only drawn every renderEvery steps, which keeps the steps per drawn frame even
+ * instead of alternating. Every step that had to be caught up is a missed deadline.
+ * With SFG_INTERPOLATION the game draws on every call instead, between the last two steps,
+ * so it isn't waited for.
+*/
+#define SCHED_MAX_RENDER_EVERY 4
+
+static struct
+{
+	uint32_t drawn;       // frames drawn
+	uint32_t missed;      // steps done later than their deadline
+	uint16_t frameCost;   // average ms one drawn frame takes (steps + drawing), in 1/16
+	uint8_t renderEvery;  // steps per drawn frame the scheduler waits for
+} sched = { 0, 0, 0, 1 };
+
+static void Schedule_Frame(uint32_t start, uint32_t steps)
+{
+	uint32_t cost = (getTicks() - start) * 16;
+
+	sched.drawn++;
+
+	if (steps > sched.renderEvery)
+		sched.missed += steps - sched.renderEvery;
+
+	sched.frameCost = sched.frameCost ? (sched.frameCost * 7 + cost) / 8 : cost;
+
+	sched.renderEvery = (sched.frameCost / 16) / SFG_MS_PER_FRAME + 1;
+
+	if (sched.renderEvery > SCHED_MAX_RENDER_EVERY)
+		sched.renderEvery = SCHED_MAX_RENDER_EVERY;
+}
+
 void mainLoopIteration()
 {
+	uint32_t frame = SFG_game.frame;
+	uint32_t start;
+
+#if !SFG_INTERPOLATION
+	if (sched.renderEvery > 1 && SFG_game.state != SFG_GAME_STATE_INIT)
+	{
+		// wait until there are renderEvery steps to do
+		int32_t wait = SFG_game.frameTime + sched.renderEvery * SFG_MS_PER_FRAME - getTicks();
+
+		if (wait > 0)
+			SFG_sleepMs(wait);
+	}
+#endif
+
 	padtype = eris_pad_type(0);
 	paddata = eris_pad_read(0);
 
+#if SFG_INPUT_RECORDS
+	Replay_Switch();
+	frame = SFG_game.frame; // a replay starts at the frame it was recorded at
+#endif
+
+	start = getTicks();
+
+	cd_audio_retry();
+	CD_Queue_Poll();
+
 	if (!SFG_mainLoopBody())
 		running = 0;
 
+#ifdef MUSIC_BYTEBEAT
+	Music_Update();
+#endif
+	Voices_Commit();
+
+#if SFG_INTERPOLATION
+	if (SFG_game.state == SFG_GAME_STATE_INIT)
+		return; // nothing drawn yet
+#else
+	if (SFG_game.frame == frame)
+		return; // nothing new was drawn
+#endif
+
+	Schedule_Frame(start, SFG_game.frame - frame);
+
 #ifdef DEBUGFPS
 	SFG_drawText(myitoa(getFps()),8,8,
     SFG_FONT_SIZE_SMALL,4,0,0);
 #endif
 
-	eris_king_set_kram_write(1, 1);
-	king_kram_write_buffer(framebuffer, (256*240));
+	if (SFG_game.hudShown && hudOnScreen)
+	{
+		// the HUD part is on BG1 already
+		Present_Frame(framebuffer, 1, VIEW_UPLOAD_SIZE);
+	}
+	else
+	{
+		Present_Frame(framebuffer, 1, (256*240));
+	}
+
+	// draw the next frame into the other buffer while this one is uploaded
+	framebuffer = (framebuffer == framebuffers[0]) ? framebuffers[1] : framebuffers[0];
+
+	if (SFG_game.hudShown != hudOnScreen)
+	{
+		hudOnScreen = SFG_game.hudShown;
+		Present_Lock();
+		Show_BG1(hudOnScreen);
+		Present_Unlock();
+	}
 	
-	ticks++;
 	++nframe;
 }
 
@@ -430,6 +1242,22 @@ uint8_t musicOn = 0;
 
 int musicindex = 0;
 
+#ifdef MUSIC_BYTEBEAT
+void SFG_setMusic(uint8_t value)
+{
+	switch (value)
+	{
+		case SFG_MUSIC_TURN_ON: Music_Start(); break;
+		case SFG_MUSIC_TURN_OFF: Music_Stop(); break;
+		case SFG_MUSIC_NEXT:
+			// switch track at the next sample instead of calling SFG_nextMusicTrack,
+			// which generates all the samples left in the current one
+			if (music.on) SFG_MusicState.t = SFG_TRACK_SAMPLES;
+		break;
+		default: break; // no title or win track, the current one goes on
+	}
+}
+#else
 void SFG_setMusic(uint8_t value)
 {
   switch (value)
@@ -479,30 +1307,7 @@ void SFG_setMusic(uint8_t value)
     default: break;
   }
 }
-
-void SFG_playSound(uint8_t soundIndex, uint8_t volume)
-{
-	uint32_t addr;
-	if (volume == 0) return;
-	
-  switch (soundIndex)
-  {
-    case 2: 
-		addr = 4096*6 | KRAM_PAGE1;
-		Play_ADPCM(1, addr, sizeof(shot),0, ADPCM_RATE_32000); // Monster death
-      break;
-
-    case 5:
-		addr = 4096*3 | KRAM_PAGE1;
-		Play_ADPCM(0, addr, sizeof(monster),0, ADPCM_RATE_32000); // Hurt
-      break;
-
-    default:
-		addr = ADPCM_OFFSET;
-		Play_ADPCM(0, addr, sizeof(click), 0, ADPCM_RATE_32000); // Click
-      break;
-  }	
-}
+#endif
 
 void handleSignal(int signal)
 {
@@ -550,7 +1355,6 @@ unsigned short mypal[256] = {
 
 int main(int argc, char *argv[])
 {
-	uint32_t addr;
 	eris_king_init();
 	eris_tetsu_init();
 	eris_pad_init(0);
@@ -560,36 +1364,15 @@ int main(int argc, char *argv[])
 	Initialize_ADPCM(ADPCM_RATE_32000);
 	eris_low_cdda_set_volume(63,63);
 	
-	addr = ADPCM_OFFSET;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(click, sizeof(click));
-	
-	/*addr = 4096 | KRAM_PAGE1;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(door, sizeof(door));
-	
-	addr = 4096*2 | KRAM_PAGE1;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(explosion, sizeof(explosion));*/
-	
-	addr = 4096*3 | KRAM_PAGE1;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(monster, sizeof(monster));
-	
-	/*addr = 4096*4 | KRAM_PAGE1;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(noise, sizeof(noise));*/
-	
-	/*addr = 4096*5 | KRAM_PAGE1;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(plasma, sizeof(plasma));*/
-	
-	addr = 4096*6 | KRAM_PAGE1;
-	eris_king_set_kram_write(addr, 1);	
-	king_kram_write_buffer(shot, sizeof(shot));
+	Load_Sound_Bank();
+	Soundbank_Init(sndManifest, SNDBANK_COUNT, SND_KRAM_START, SND_KRAM_END, KRAM_PAGE1);
+	Load_Sounds(1 << SNDBANK_CLICK);
 	
 	Set_Video(KING_BGMODE_256_PAL);
 	Upload_Palette(mypal, 256);
+	Init_HUD();
+	Init_Palette_Effects();
+	Init_Weapon_Sprites();
 	initTimer(0, 1423);
 
 	
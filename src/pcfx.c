@@ -10,6 +10,8 @@
 
 #include "fastking.h"
 #include "pcfx.h"
+#include "adpcmstream.h"
+#include "cdqueue.h"
 
 uint32_t mainfreq;
 
@@ -20,11 +22,40 @@ int currentvid = -1;
 
 // FOR PSG
 
-unsigned char samplepsg_buf[SAMPLES_PSG_NUMBER][65535*2];
-uint32_t samplepsg_play[SAMPLES_PSG_NUMBER];
-uint32_t samplepsg_size[SAMPLES_PSG_NUMBER];
-uint32_t samplepsg_loop[SAMPLES_PSG_NUMBER];
-uint32_t samplepsg_ch[SAMPLES_PSG_NUMBER];
+/*
+ * PSG samples are 5 bits each, packed 8 in 5 bytes (bit 0 of the first byte is bit 0 of
+ * the first sample). They aren't kept in RAM, each sample playing has a ring of
+ * PSG_RING_SECTORS CD sectors : samplepsg_timer_irq plays them and frees a sector once it
+ * is past it, Update_PSGSamples refills the free ones from the CD (or from RAM, see
+ * Set_PSGSample_Data) outside of the IRQ. CD reads go through the CD queue and land
+ * when CD_Queue_Poll runs. A slot's filled byte is only set by the refill and only
+ * cleared by the IRQ, so no read-modify-write of one can undo a store of the other.
+*/
+#define PSG_SECTOR 2048
+#define PSG_RING_SECTORS 2
+#define PSG_RING_BITS (PSG_SECTOR * PSG_RING_SECTORS * 8)
+#define PSG_SILENCE 0x10
+
+typedef struct
+{
+	unsigned char ring[PSG_RING_SECTORS * PSG_SECTOR];
+	const unsigned char* data;    // the packed sample in RAM, or 0 to read it from the CD
+	u32 lba;
+	u32 sectors;                  // size of the packed sample in sectors
+	u32 samples;                  // number of 5 bit samples
+	u32 next_sector;              // next sector of the sample to put in the ring
+	u32 fill;                     // ring slot it goes to
+	volatile u8 filled[PSG_RING_SECTORS]; // ring slot i holds data to play, see below
+	u32 pending;                  // bit i : ring slot i is being read from the CD
+	volatile u32 bitpos;          // in the ring
+	volatile u32 left;            // samples left to play before the end (or the loop)
+	volatile u8 playing;
+	u8 loop;
+	u8 ch;
+} psg_stream_t;
+
+static psg_stream_t samplepsg[SAMPLES_PSG_NUMBER];
+u32 samplepsg_underruns = 0;
 #define BG_KRAM_PAGE 1
 #define ADPCM_KRAM_PAGE 0
 
@@ -96,6 +127,7 @@ void Set_Video(uint32_t bpp)
 			microprog[4] = KING_CODE_BG0_CG_4;
 			microprog[5] = KING_CODE_BG1_CG_0;
 			microprog[6] = KING_CODE_ROTATE;
+			microprog[7] = KING_CODE_BG1_CG_1; // for a 16 colors BG1 (see Set_BG1_Layer)
 		break;
 	}
 
@@ -133,6 +165,32 @@ void Set_Video(uint32_t bpp)
 
 }
 
+/*
+ * Sets up BG1 as a 16 colors bitmap layer on top of BG0.
+ * cg_addr is the KRAM address of its bitmap and pal_offset the first palette entry
+ * used by its 16 colors. It stays hidden until Show_BG1 is called.
+*/
+void Set_BG1_Layer(u32 cg_addr, int pal_offset)
+{
+	eris_king_set_bg_mode(currentvid, KING_BGMODE_16_PAL, 0, 0);
+	eris_king_set_bat_cg_addr(KING_BG1, 0, cg_addr);
+	eris_king_set_scroll(KING_BG1, 0, 0);
+	eris_king_set_bg_size(KING_BG1, KING_BGSIZE_256, KING_BGSIZE_256, KING_BGSIZE_256, KING_BGSIZE_256);
+	eris_tetsu_set_king_palette(0, pal_offset, 0, 0);
+	// 7up chip 1 (sprites) goes between BG0 and BG1
+	eris_tetsu_set_priorities(1, 5, 4, 6, 3, 2, 0);
+	
+	eris_tetsu_set_video_mode(TETSU_LINES_262, 0, TETSU_DOTCLOCK_5MHz, TETSU_COLORS_16,
+				TETSU_COLORS_16, 0, 1, 1, 1, 0, 0, 0);
+	
+	Show_BG1(0);
+}
+
+void Show_BG1(int show)
+{
+	eris_king_set_bg_prio(KING_BGPRIO_0, show ? KING_BGPRIO_1 : KING_BGPRIO_HIDE, KING_BGPRIO_HIDE, KING_BGPRIO_HIDE, 0);
+}
+
 void Init_Sprite(int chip)
 {
 	/*
@@ -142,18 +200,23 @@ void Init_Sprite(int chip)
 	eris_low_sup_set_video_mode(VDC_CHIP_0, 2, 2, 4, 0x1F, 0x11, 2, 239, 2);
 	 */
 	eris_low_sup_set_control(chip, 0, 0, 1);
-	eris_low_sup_set_access_width(0, 0, SUP_LOW_MAP_32X32, 0, 0);
-	eris_low_sup_set_scroll(0, 0, 0);
+	eris_low_sup_set_access_width(chip, 0, SUP_LOW_MAP_32X32, 0, 0);
+	eris_low_sup_set_scroll(chip, 0, 0);
 	eris_low_sup_set_video_mode(chip, 2, 2, 4, 0x1F, 0x11, 2, 239, 2);
 }
 
-void Update_Sprite(int chip, unsigned short array[], int size_sprite, int offset_spr)
+void Upload_Sprite_Data(int chip, unsigned short array[], int size_sprite, int offset_spr)
 {
 	int i;
-	eris_low_sup_set_vram_write(VDC_CHIP_0, offset_spr);
+	eris_low_sup_set_vram_write(chip, offset_spr);
 	for(i = 0; i < size_sprite; i++) {
-		eris_low_sup_vram_write(0, array[i]);
+		eris_low_sup_vram_write(chip, array[i]);
 	}
+}
+
+void Update_Sprite(int chip, unsigned short array[], int size_sprite, int offset_spr)
+{
+	Upload_Sprite_Data(chip, array, size_sprite, offset_spr);
 	
 	eris_sup_set(chip);
 	eris_sup_spr_set(0);
@@ -167,6 +230,25 @@ void Move_Sprite(int chip, int x, int y)
 	eris_sup_spr_xy(x, y);
 }
 
+/*
+ * Places sprite spr of the chip. x and y are in screen pixels (the 32/64 offsets of the SUP are added here),
+ * pattern is the VRAM address of the sprite data divided by 64 and ctrl holds the size and flip bits (SPR_SIZE_*).
+*/
+void Set_Sprite(int chip, int spr, int x, int y, int pattern, int ctrl, int pal)
+{
+	eris_sup_set(chip);
+	eris_sup_spr_set(spr);
+	eris_sup_spr_create(x + SPR_X_OFFSET, y + SPR_Y_OFFSET, pattern, ctrl);
+	eris_sup_spr_pal(pal);
+}
+
+void Hide_Sprite(int chip, int spr)
+{
+	eris_sup_set(chip);
+	eris_sup_spr_set(spr);
+	eris_sup_spr_xy(0, 0); // above the visible area
+}
+
 void Upload_Palette(unsigned short pal[], int sizep)
 {
 	int i;
@@ -223,23 +305,50 @@ void Initialize_ADPCM(uint32_t freq)
 
 // FOR ADPCM
 
-void LoadADPCMCD(u32 lba, u32 addr, uint32_t size_sample)
+typedef struct
+{
+	u32 addr;
+	u32 size;
+	unsigned char data[];   // whole sectors, as read from the CD
+} adpcm_load_t;
+
+static void LoadADPCMCD_Done(void* arg, u32 tag)
+{
+	adpcm_load_t* load = arg;
+	
+	Present_Lock();
+	eris_king_set_kram_read(load->addr, 1);
+	eris_king_set_kram_write(load->addr, 1);	
+	king_kram_write_buffer(load->data, load->size);
+	Present_Unlock();
+	
+	free(load);
+}
+
+/*
+ * The sample is read through the CD queue (see cdqueue.c) and only in KRAM once
+ * CD_Queue_Poll got it, use CD_Queue_Flush to wait for it. Returns -1 if the read
+ * couldn't be queued (no memory or the queue is full), then nothing is loaded.
+*/
+int LoadADPCMCD(u32 lba, u32 addr, uint32_t size_sample)
 {
 	// temp
-	unsigned char* temp_sample_space;
-	temp_sample_space = malloc(size_sample);
+	adpcm_load_t* load;
+	load = malloc(sizeof(adpcm_load_t) + ((size_sample + 2047) & ~2047));
+	if (!load) return -1;
+	load->addr = addr;
+	load->size = size_sample;
 	
 	// Works but slower
 	// There's eris_cd_read_kram(BINARY_LBA_TITLEI_VOX, start_adress, sspace);
 	// but for whatever reason, it fails to work for PAGE1, so it only works for PAGE0... :/
-	eris_cd_read(lba, temp_sample_space, size_sample);
-	
-	eris_king_set_kram_read(addr, 1);
-	eris_king_set_kram_write(addr, 1);	
-
-	king_kram_write_buffer(temp_sample_space, size_sample);
+	if (CD_Queue_Read(lba, load->data, size_sample, LoadADPCMCD_Done, load, 0))
+	{
+		free(load);
+		return -1;
+	}
 	
-	free(temp_sample_space);
+	return 0;
 }
 
 void Reset_ADPCM()
@@ -344,31 +453,152 @@ void Play_ADPCM(uint32_t channel, uint32_t start_adress, uint32_t sizet, unsigne
     out16(0x604, playCommand);
 }
 
+/*
+ * Starts the samples of the channels in the channels mask (start address and size as for Play_ADPCM)
+ * with a single play command : playing is the mask of all the channels that should be playing
+ * afterwards, so starting one channel doesn't restart or stop the other one.
+*/
+void Play_ADPCM_Voices(uint32_t channels, const uint32_t start_adress[], const uint32_t sizet[], uint32_t playing, uint32_t freq)
+{
+	int ch;
+	int playCommand = playing & 3;
+	
+	for (ch = 0; ch < 2; ch++)
+	{
+		if (!(channels & (1 << ch))) continue;
+		
+		eris_king_set_kram_read(start_adress[ch], 1);
+		
+		// control (sequential, no interrupts), start and end address, see Play_ADPCM
+		out16(0x600, ch ? 0x52 : 0x51);
+		out16(0x604, 0);
+		out16(0x600, ch ? 0x5C : 0x58);
+		out16(0x604, (start_adress[ch]/256));
+		out16(0x600, ch ? 0x5D : 0x59);
+		out32(0x604, ((start_adress[ch])+(((sizet[ch]-2048)>>1))));
+	}
+	
+	switch (freq) {
+		case ADPCM_RATE_16000: playCommand |= 4; break;
+		case ADPCM_RATE_8000: playCommand |= 8; break;
+		case ADPCM_RATE_4000: playCommand |= 16; break;
+	}
+	
+	out16(0x600,0x50);
+	out16(0x604, playCommand);
+}
+
+static void Fill_PSGSample_Done(void* arg, u32 slot)
+{
+	psg_stream_t* st = arg;
+	
+	st->pending &= ~(1 << slot);
+	st->filled[slot] = 1;
+}
+
+/* Returns 0 if the CD queue is full, the sector is read again next time. */
+static int Fill_PSGSample(psg_stream_t* st)
+{
+	if (st->data)
+	{
+		memcpy(st->ring + st->fill * PSG_SECTOR, st->data + st->next_sector * PSG_SECTOR, PSG_SECTOR);
+		st->filled[st->fill] = 1;
+	}
+	else
+	{
+		if (CD_Queue_Read(st->lba + st->next_sector, st->ring + st->fill * PSG_SECTOR, PSG_SECTOR,
+			Fill_PSGSample_Done, st, st->fill))
+			return 0;
+		
+		st->pending |= 1 << st->fill;
+	}
+	
+	st->fill = (st->fill + 1) % PSG_RING_SECTORS;
+	st->next_sector++;
+	
+	return 1;
+}
+
 void Play_PSGSample(int ch, int sample_numb, int loop)
 {
+	psg_stream_t* st = &samplepsg[sample_numb];
+	int i;
+	
+	st->playing = 0;
+	
 	eris_low_psg_set_main_volume(15, 15);
 	eris_low_psg_set_channel(ch);
 	eris_low_psg_set_volume(31, 1, 1);
 	eris_low_psg_set_balance(15, 15);	
 	eris_low_psg_set_freq(0);
 	eris_low_psg_set_noise(0, 0);
-	samplepsg_play[sample_numb] = 1;
-	samplepsg_loop[sample_numb] = loop;
-	samplepsg_ch[sample_numb] = ch;
+	
+	st->ch = ch;
+	st->loop = loop;
+	st->next_sector = 0;
+	st->fill = 0;
+	st->pending = 0;
+	st->bitpos = 0;
+	st->left = st->samples;
+	
+	for (i = 0; i < PSG_RING_SECTORS; i++)
+		st->filled[i] = 0;
+	
+	for (i = 0; i < PSG_RING_SECTORS && st->next_sector < st->sectors; i++)
+	{
+		if (!Fill_PSGSample(st)) break;
+	}
+	
+	st->playing = 1;
 }
 
+/* The sample is read from the CD as it plays, size is the one of the packed data in bytes. */
 void Load_PSGSample(u32 lba, int numb, uint32_t size_sample)
 {
-	samplepsg_size[numb] = size_sample;
-	eris_cd_read(lba, samplepsg_buf[numb], size_sample);
+	samplepsg[numb].playing = 0;
+	samplepsg[numb].data = 0;
+	samplepsg[numb].lba = lba;
+	samplepsg[numb].sectors = (size_sample + PSG_SECTOR - 1) / PSG_SECTOR;
+	samplepsg[numb].samples = (size_sample * 8) / 5;
 }
 
+/* Same for a sample already in RAM (e.g. from a decoder), data is padded to whole sectors. */
+void Set_PSGSample_Data(int numb, const unsigned char* data, uint32_t size_sample)
+{
+	Load_PSGSample(0, numb, size_sample);
+	samplepsg[numb].data = data;
+}
+
+/* Refills the rings, to be called often enough that the IRQ never catches up (once a frame). */
+void Update_PSGSamples()
+{
+	int i;
+	
+	for (i = 0; i < SAMPLES_PSG_NUMBER; i++)
+	{
+		psg_stream_t* st = &samplepsg[i];
+		
+		if (!st->playing) continue;
+		
+		while (!st->filled[st->fill] && !(st->pending & (1 << st->fill)))
+		{
+			if (st->next_sector >= st->sectors)
+			{
+				if (!st->loop) break;
+				st->next_sector = 0;
+			}
+			
+			if (!Fill_PSGSample(st)) break;
+		}
+	}
+}
 
 void Stop_PSGSample(int ch, int sample_numb, int loop)
 {
 	eris_low_psg_set_channel(ch);
-	samplepsg_play[sample_numb] = 0;
-	samplepsg_loop[sample_numb] = 0;
+	eris_low_psg_waveform_data(PSG_SILENCE);
+	samplepsg[sample_numb].playing = 0;
+	samplepsg[sample_numb].loop = 0;
 }
 
 volatile int __attribute__ ((zda)) zda_timer_count = 0;
@@ -384,64 +614,62 @@ __attribute__ ((noinline)) void increment_zda_timer_count (void)
 
 __attribute__ ((interrupt)) void samplepsg_timer_irq (void)
 {
-	const int i = 0;
 	eris_timer_ack_irq();
 
-#if 1
-	#if SAMPLES_PSG_NUMBER > 1
-	for(int i=0;i<SAMPLES_PSG_NUMBER;i++)
-	#endif
+	for(int i = 0; i < SAMPLES_PSG_NUMBER; i++)
 	{
-		if (samplepsg_play[i])
+		psg_stream_t* st = &samplepsg[i];
+		u32 bitpos, byte, shift, next, slot;
+		unsigned char value, ready;
+		
+		if (!st->playing) continue;
+		
+		bitpos = st->bitpos;
+		byte = bitpos >> 3;
+		shift = bitpos & 7;
+		
+		// the sector(s) the sample is in
+		slot = byte / PSG_SECTOR;
+		ready = st->filled[slot];
+		if (shift > 3 && ((byte + 1) & (PSG_SECTOR - 1)) == 0)
+			ready &= st->filled[(slot + 1) % PSG_RING_SECTORS];
+		
+		eris_low_psg_set_channel(st->ch);
+		
+		if (!ready)
 		{
-			eris_low_psg_set_channel(samplepsg_ch[i]);
-			eris_low_psg_waveform_data(samplepsg_buf[i][samplepsg_play[i]-1]);
-			samplepsg_play[i]++;
-			if (samplepsg_play[i] >= samplepsg_size[i]-2047)
-			{
-				samplepsg_play[i] = 0;
-				if (samplepsg_loop[i])
-				{
-					samplepsg_play[i] = 1;
-				}
-			}
+			// the refill is late, better silence than old data
+			eris_low_psg_waveform_data(PSG_SILENCE);
+			samplepsg_underruns++;
+			continue;
 		}
-	}
-#else
-	#if SAMPLES_PSG_NUMBER > 1
-	for(int i = 0; i < SAMPLES_PSG_NUMBER; i++)
-	#endif
-	{
-		if (samplepsg_play[i])
+		
+		value = st->ring[byte] >> shift;
+		if (shift > 3) // the sample goes on in the next byte
+			value |= st->ring[(byte + 1) & (PSG_RING_BITS / 8 - 1)] << (8 - shift);
+		
+		eris_low_psg_waveform_data(value & 0x1F);
+		
+		next = (bitpos + 5) & (PSG_RING_BITS - 1);
+		
+		if (--st->left == 0)
 		{
-			eris_low_psg_set_channel(samplepsg_ch[i]);
-			
-			// Calculate the byte index and bit offset for the current 5-bit value.
-			int byteIndex = (samplepsg_play[i] * 5) / 8;
-			int bitOffset = (samplepsg_play[i] * 5) % 8;
-			
-			// Extract the 5-bit value from the packed data.
-			unsigned char value = (samplepsg_buf[i][byteIndex] >> bitOffset) & 0x1F; // Extract first part
-			if (bitOffset > 3) { // If bits span across two bytes
-				value |= (samplepsg_buf[i][byteIndex + 1] << (8 - bitOffset)) & 0x1F;
-			}
-			
-			eris_low_psg_waveform_data(value);
-			
-			samplepsg_play[i]++;
-			
-			// Adjust the condition to wrap around correctly based on 5-bit value count.
-			if (samplepsg_play[i] >= (samplepsg_size[i] * 8) / 5 - 2047)
+			if (!st->loop)
 			{
-				samplepsg_play[i] = 0;
-				if (samplepsg_loop[i])
-				{
-					samplepsg_play[i] = 1;
-				}
+				st->playing = 0;
+				continue;
 			}
+			
+			// the sample starts again at the beginning of the next sector
+			next = ((bitpos + 5 + PSG_SECTOR * 8 - 1) & ~(PSG_SECTOR * 8 - 1)) & (PSG_RING_BITS - 1);
+			st->left = st->samples;
 		}
+		
+		if ((next ^ bitpos) & ~(PSG_SECTOR * 8 - 1))
+			st->filled[slot] = 0; // done with this sector
+		
+		st->bitpos = next;
 	}
-#endif
 }
 
 uint32_t nframe = 0;
@@ -467,10 +695,111 @@ int getTicks()
 	return zda_timer_count;
 }
 
+/*
+ * Present pipeline : a finished frame is handed to Present_Frame and uploaded to KRAM
+ * in PRESENT_CHUNK sized pieces from the timer IRQ, while the next frame is drawn into
+ * another RAM buffer. The KING and Tetsu registers are shared with the main code (see
+ * also Queue_Palette), so anything else touching them while the timer runs has to be
+ * inside Present_Lock/Unlock.
+*/
+static const unsigned char* volatile present_src = 0;
+static volatile u32 present_kram = 0;
+static volatile u32 present_left = 0;
+static volatile int present_lock = 0;
+static volatile int present_start = 0;
+present_stats_t present_stats;
+
+/* Declare this "noinline" for the same reason as increment_zda_timer_count. */
+__attribute__ ((noinline)) void present_upload_chunk (void)
+{
+	u32 size;
+	
+	if (present_left == 0 || present_lock) return;
+	
+	size = present_left > PRESENT_CHUNK ? PRESENT_CHUNK : present_left;
+	
+	eris_king_set_kram_write(present_kram, 1);
+	king_kram_write_buffer((void*)present_src, size);
+	
+	present_src += size;
+	present_kram += size >> 1; // KRAM addresses are in 16-bit words
+	present_left -= size;
+	
+	if (present_left == 0)
+	{
+		present_stats.latency = zda_timer_count - present_start;
+		if (present_stats.latency > present_stats.latency_max)
+			present_stats.latency_max = present_stats.latency;
+	}
+}
+
+void Present_Frame(const void* buf, u32 kram, u32 size)
+{
+	if (present_left)
+	{
+		present_stats.stalls++;
+		Present_Wait();
+	}
+	
+	present_stats.frames++;
+	
+	present_src = buf;
+	present_kram = kram;
+	present_start = zda_timer_count;
+	present_left = size; // set last, this starts the upload
+}
+
+void Present_Wait()
+{
+	while (present_left) { }
+}
+
+int Present_Queue_Depth()
+{
+	return present_left ? 1 : 0;
+}
+
+void Present_Lock()
+{
+	present_lock = 1;
+}
+
+void Present_Unlock()
+{
+	present_lock = 0;
+}
+
+/*
+ * Palette changes queued with Queue_Palette are written by the timer IRQ once the
+ * raster is in the vertical blank, so the colors never change in the middle of the screen.
+*/
+static unsigned short* volatile palette_pending = 0;
+static volatile int palette_size = 0;
+
+void Queue_Palette(unsigned short pal[], int sizep)
+{
+	palette_pending = 0;
+	palette_size = sizep;
+	palette_pending = pal;
+}
+
+__attribute__ ((noinline)) void palette_apply (void)
+{
+	if (palette_pending == 0 || present_lock) return;
+	
+	if (eris_tetsu_get_raster() < VBLANK_LINE) return;
+	
+	Upload_Palette(palette_pending, palette_size);
+	palette_pending = 0;
+}
+
 __attribute__ ((interrupt)) void my_timer_irq (void)
 {
 	eris_timer_ack_irq();
 	increment_zda_timer_count();
+	palette_apply();
+	present_upload_chunk();
+	if (!present_lock) stream_poll();
 }
 
 // Function to initialize the timer with a custom IRQ handler and period
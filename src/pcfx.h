@@ -26,6 +26,8 @@ extern void Initialize_ADPCM(uint32_t freq);
 
 extern void Play_ADPCM(uint32_t channel, uint32_t start_adress, uint32_t sizet, unsigned char loop, uint32_t freq );
 
+extern void Play_ADPCM_Voices(uint32_t channels, const uint32_t start_adress[], const uint32_t sizet[], uint32_t playing, uint32_t freq);
+
 extern void chartou32(char* str, u32* o);
 
 extern void printstr(u32* str, int x, int y, int tall);
@@ -34,28 +36,70 @@ extern void Clear_BG0(int bpp);
 
 extern void Upload_Palette(unsigned short pal[], int sizep);
 
-extern void LoadADPCMCD(u32 lba, u32 addr, uint32_t size_sample);
+extern int LoadADPCMCD(u32 lba, u32 addr, uint32_t size_sample);
 
 extern void Load_PSGSample(u32 lba, int numb, uint32_t size_sample);
 
 extern void Play_PSGSample(int ch, int sample_numb, int loop);
 
+extern void Set_PSGSample_Data(int numb, const unsigned char* data, uint32_t size_sample);
+
+extern void Update_PSGSamples();
+
+extern void Stop_PSGSample(int ch, int sample_numb, int loop);
+
 extern void initTimer(int psg, int period);
 
 extern __attribute__ ((interrupt)) void my_timer_irq (void);
 
 extern __attribute__ ((interrupt)) void samplepsg_timer_irq (void);
 
+extern void Set_BG1_Layer(u32 cg_addr, int pal_offset);
+
+extern void Show_BG1(int show);
+
 extern void Init_Sprite(int chip);
 
+extern void Upload_Sprite_Data(int chip, unsigned short array[], int size_sprite, int offset_spr);
+
 extern void Update_Sprite(int chip, unsigned short array[], int size_sprite, int offset_spr);
 
+extern void Set_Sprite(int chip, int spr, int x, int y, int pattern, int ctrl, int pal);
+
+extern void Hide_Sprite(int chip, int spr);
+
 extern void Reset_ADPCM();
 
 extern volatile int __attribute__ ((zda)) frame_text ;
 
 extern void Move_Sprite(int chip, int x, int y);
 
+typedef struct
+{
+	u32 frames;      // frames given to Present_Frame
+	u32 stalls;      // times Present_Frame had to wait for the previous upload
+	u32 latency;     // timer ticks the last upload took
+	u32 latency_max;
+} present_stats_t;
+
+#define PRESENT_CHUNK 2048 // bytes uploaded per timer IRQ, must be a multiple of 16
+
+extern present_stats_t present_stats;
+
+extern void Present_Frame(const void* buf, u32 kram, u32 size);
+
+extern void Present_Wait();
+
+extern int Present_Queue_Depth();
+
+extern void Present_Lock();
+
+extern void Present_Unlock();
+
+#define VBLANK_LINE 240
+
+extern void Queue_Palette(unsigned short pal[], int sizep);
+
 extern int getFps();
 
 extern int getTicks();
@@ -63,7 +107,17 @@ extern int getTicks();
 #define VDC_CHIP_0 0
 #define VDC_CHIP_1 1
 
-#define SAMPLES_PSG_NUMBER 1
+#define SPR_X_OFFSET 32
+#define SPR_Y_OFFSET 64
+
+#define SPR_SIZE_16X16 0x0000
+#define SPR_SIZE_32X16 0x0100
+#define SPR_SIZE_16X32 0x1000
+#define SPR_SIZE_32X32 0x1100
+#define SPR_SIZE_16X64 0x3000
+#define SPR_SIZE_32X64 0x3100
+
+#define SAMPLES_PSG_NUMBER 2 // PSG samples that can play at the same time
 
 extern int currentvid;
 
@@ -126,6 +126,12 @@
 
 #define RCL_HORIZONTAL_FOV_HALF (RCL_HORIZONTAL_FOV / 2)
 
+#ifndef RCL_THREAD_LOCAL
+#define RCL_THREAD_LOCAL /**< Storage class of the library's helper variables,
+                          can be e.g. _Thread_local to use the library from
+                          several threads at once. */
+#endif
+
 #ifndef RCL_CAMERA_COLL_RADIUS
 #define RCL_CAMERA_COLL_RADIUS RCL_UNITS_PER_SQUARE / 4
 #endif
@@ -414,6 +420,15 @@ void RCL_castRaysMultiHit(RCL_Camera cam, RCL_ArrayFunction arrayFunc,
   RCL_ArrayFunction typeFunction, RCL_ColumnFunction columnFunc,
   RCL_RayConstraints constraints);
 
+/**
+  Like RCL_castRaysMultiHit(...), but only casts the rays of the columns from
+  fromX up to (not including) toX, so that different column ranges can be cast
+  independently, e.g. from different threads.
+*/
+void RCL_castRaysMultiHitColumns(RCL_Camera cam, RCL_ArrayFunction arrayFunc,
+  RCL_ArrayFunction typeFunction, RCL_ColumnFunction columnFunc,
+  RCL_RayConstraints constraints, int16_t fromX, int16_t toX);
+
 /**
   Using provided functions, renders a complete complex (multilevel) camera
   view.
@@ -445,6 +460,24 @@ void RCL_renderComplex(RCL_Camera cam, RCL_ArrayFunction floorHeightFunc,
   RCL_ArrayFunction ceilingHeightFunc, RCL_ArrayFunction typeFunction,
   RCL_RayConstraints constraints);
 
+/**
+  RCL_renderComplex(...) split in two, for rendering the view in column ranges
+  in parallel. RCL_renderComplexBegin(...) prepares rendering the view and has
+  to be called alone, then RCL_renderComplexColumns(...) renders the columns
+  from fromX up to (not including) toX and can be called for disjoint ranges
+  from several threads at once (RCL_THREAD_LOCAL has to be left empty then).
+
+  @param floorPixelDistances array of camera.resolution.y values, only needed
+                             with RCL_COMPUTE_FLOOR_TEXCOORDS (can be 0
+                             otherwise), has to stay valid until all columns
+                             are rendered
+*/
+void RCL_renderComplexBegin(RCL_Camera cam, RCL_ArrayFunction floorHeightFunc,
+  RCL_ArrayFunction ceilingHeightFunc, RCL_Unit *floorPixelDistances);
+
+void RCL_renderComplexColumns(RCL_ArrayFunction typeFunction,
+  RCL_RayConstraints constraints, int16_t fromX, int16_t toX);
+
 /**
   Renders given camera view, with help of provided functions. This function is
   simpler and faster than RCL_renderComplex(...) and is meant to be rendering
@@ -506,20 +539,20 @@ void RCL_initRayConstraints(RCL_RayConstraints *constraints);
 #define _RCL_UNUSED(what) (void)(what);
 
 // global helper variables, for precomputing stuff etc.
-RCL_Camera _RCL_camera;
-RCL_Unit _RCL_horizontalDepthStep = 0; 
-RCL_Unit _RCL_startFloorHeight = 0;
-RCL_Unit _RCL_startCeil_Height = 0;
-RCL_Unit _RCL_camResYLimit = 0;
-RCL_Unit _RCL_middleRow = 0;
-RCL_ArrayFunction _RCL_floorFunction = 0;
-RCL_ArrayFunction _RCL_ceilFunction = 0;
-RCL_Unit _RCL_fHorizontalDepthStart = 0;
-RCL_Unit _RCL_cHorizontalDepthStart = 0;
-int16_t _RCL_cameraHeightScreen = 0;
-RCL_ArrayFunction _RCL_rollFunction = 0; // says door rolling
-RCL_Unit *_RCL_floorPixelDistances = 0;
-RCL_Unit _RCL_fovCorrectionFactors[2] = {0,0}; //correction for hor/vert fov
+RCL_THREAD_LOCAL RCL_Camera _RCL_camera;
+RCL_THREAD_LOCAL RCL_Unit _RCL_horizontalDepthStep = 0; 
+RCL_THREAD_LOCAL RCL_Unit _RCL_startFloorHeight = 0;
+RCL_THREAD_LOCAL RCL_Unit _RCL_startCeil_Height = 0;
+RCL_THREAD_LOCAL RCL_Unit _RCL_camResYLimit = 0;
+RCL_THREAD_LOCAL RCL_Unit _RCL_middleRow = 0;
+RCL_THREAD_LOCAL RCL_ArrayFunction _RCL_floorFunction = 0;
+RCL_THREAD_LOCAL RCL_ArrayFunction _RCL_ceilFunction = 0;
+RCL_THREAD_LOCAL RCL_Unit _RCL_fHorizontalDepthStart = 0;
+RCL_THREAD_LOCAL RCL_Unit _RCL_cHorizontalDepthStart = 0;
+RCL_THREAD_LOCAL int16_t _RCL_cameraHeightScreen = 0;
+RCL_THREAD_LOCAL RCL_ArrayFunction _RCL_rollFunction = 0; // says door rolling
+RCL_THREAD_LOCAL RCL_Unit *_RCL_floorPixelDistances = 0;
+RCL_THREAD_LOCAL RCL_Unit _RCL_fovCorrectionFactors[2] = {0,0}; //correction for hor/vert fov
 
 RCL_Unit RCL_clamp(RCL_Unit value, RCL_Unit valueMin, RCL_Unit valueMax)
 {
@@ -960,6 +993,14 @@ RCL_HitResult RCL_castRay(RCL_Ray ray, RCL_ArrayFunction arrayFunc)
 void RCL_castRaysMultiHit(RCL_Camera cam, RCL_ArrayFunction arrayFunc,
   RCL_ArrayFunction typeFunction, RCL_ColumnFunction columnFunc,
   RCL_RayConstraints constraints)
+{
+  RCL_castRaysMultiHitColumns(cam,arrayFunc,typeFunction,columnFunc,
+    constraints,0,cam.resolution.x);
+}
+
+void RCL_castRaysMultiHitColumns(RCL_Camera cam, RCL_ArrayFunction arrayFunc,
+  RCL_ArrayFunction typeFunction, RCL_ColumnFunction columnFunc,
+  RCL_RayConstraints constraints, int16_t fromX, int16_t toX)
 {
   RCL_Vector2D dir1 =
     RCL_angleToDirection(cam.direction - RCL_HORIZONTAL_FOV_HALF);
@@ -987,10 +1028,10 @@ void RCL_castRaysMultiHit(RCL_Camera cam, RCL_ArrayFunction arrayFunc,
   RCL_Ray r;
   r.start = cam.position;
 
-  RCL_Unit currentDX = 0;
-  RCL_Unit currentDY = 0;
+  RCL_Unit currentDX = dX * fromX;
+  RCL_Unit currentDY = dY * fromX;
 
-  for (int16_t i = 0; i < cam.resolution.x; ++i)
+  for (int16_t i = fromX; i < toX; ++i)
   {
     /* Here by linearly interpolating the direction vector its length changes,
     which in result achieves correcting the fish eye effect (computing
@@ -1567,6 +1608,21 @@ static inline void _RCL_precomputeFloorDistances(RCL_Camera camera,
 void RCL_renderComplex(RCL_Camera cam, RCL_ArrayFunction floorHeightFunc,
   RCL_ArrayFunction ceilingHeightFunc, RCL_ArrayFunction typeFunction,
   RCL_RayConstraints constraints)
+{
+#if RCL_COMPUTE_FLOOR_TEXCOORDS == 1
+  RCL_Unit floorPixelDistances[cam.resolution.y];
+#else
+  RCL_Unit *floorPixelDistances = 0;
+#endif
+
+  RCL_renderComplexBegin(cam,floorHeightFunc,ceilingHeightFunc,
+    floorPixelDistances);
+
+  RCL_renderComplexColumns(typeFunction,constraints,0,cam.resolution.x);
+}
+
+void RCL_renderComplexBegin(RCL_Camera cam, RCL_ArrayFunction floorHeightFunc,
+  RCL_ArrayFunction ceilingHeightFunc, RCL_Unit *floorPixelDistances)
 {
   _RCL_floorFunction = floorHeightFunc;
   _RCL_ceilFunction = ceilingHeightFunc;
@@ -1594,13 +1650,18 @@ void RCL_renderComplex(RCL_Camera cam, RCL_ArrayFunction floorHeightFunc,
   _RCL_horizontalDepthStep = RCL_HORIZON_DEPTH / cam.resolution.y; 
 
 #if RCL_COMPUTE_FLOOR_TEXCOORDS == 1
-  RCL_Unit floorPixelDistances[cam.resolution.y];
   _RCL_precomputeFloorDistances(cam,floorPixelDistances,0);
   _RCL_floorPixelDistances = floorPixelDistances; // pass to column function
+#else
+  _RCL_UNUSED(floorPixelDistances)
 #endif
+}
 
-  RCL_castRaysMultiHit(cam,_RCL_floorCeilFunction,typeFunction,
-    _RCL_columnFunctionComplex,constraints);
+void RCL_renderComplexColumns(RCL_ArrayFunction typeFunction,
+  RCL_RayConstraints constraints, int16_t fromX, int16_t toX)
+{
+  RCL_castRaysMultiHitColumns(_RCL_camera,_RCL_floorCeilFunction,typeFunction,
+    _RCL_columnFunctionComplex,constraints,fromX,toX);
 }
 
 void RCL_renderSimple(RCL_Camera cam, RCL_ArrayFunction floorHeightFunc,
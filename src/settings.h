@@ -457,6 +457,187 @@
   #define SFG_FORCE_SINGLE_ITEM_MENU 0
 #endif
 
+/**
+  If 1, the HUD bar is treated as a separate layer: it is only redrawn when
+  what it shows changes, after which SFG_EVENT_HUD_CHANGED is sent so that the
+  frontend can copy the bar out of its framebuffer (e.g. into a hardware
+  background). Frontends with hardware layers can then only upload the 3D view
+  each frame. SFG_game.hudShown says whether the HUD is currently on screen.
+*/
+#ifndef SFG_HUD_LAYER
+  #define SFG_HUD_LAYER 0
+#endif
+
+/**
+  If 1, the weapon isn't drawn into the frame, SFG_setWeaponOverlay() is called
+  instead so that the frontend can show it e.g. with hardware sprites. This
+  saves drawing the biggest image on the screen each frame.
+*/
+#ifndef SFG_HARDWARE_WEAPON
+  #define SFG_HARDWARE_WEAPON 0
+#endif
+
+/**
+  If 1, the hurt/item taken border indication and the death animation are not
+  drawn into the frame but reported with SFG_setPaletteEffect() so that the
+  frontend can show them by changing the palette.
+*/
+#ifndef SFG_PALETTE_EFFECTS
+  #define SFG_PALETTE_EFFECTS 0
+#endif
+
+/**
+  If 1, the levels are not compiled into the program and the frontend gives the
+  one to play with SFG_loadLevel() (e.g. reading it from a disc), so only one
+  level has to be in memory at a time.
+*/
+#ifndef SFG_LEVEL_PACK
+  #define SFG_LEVEL_PACK 0
+#endif
+
+/**
+  If 1, the next level is prepared (loaded, doors and elements initialized) a
+  bit each frame during the win animation and the intro, so that starting it
+  doesn't cause a long frame. Costs memory for one more level state.
+*/
+#ifndef SFG_LEVEL_PREFETCH
+  #define SFG_LEVEL_PREFETCH 0
+#endif
+
+/**
+  How much of the next level is prepared per frame with SFG_LEVEL_PREFETCH, in
+  map rows (or 8 level elements).
+*/
+#ifndef SFG_LEVEL_PREFETCH_BUDGET
+  #define SFG_LEVEL_PREFETCH_BUDGET 8
+#endif
+
+/**
+  If 1, monsters that walk towards the player follow a map-wide field of
+  walking distances to the player instead of heading straight at him, so they
+  find their way around walls and steps. Costs about 16 KB of RAM.
+*/
+#ifndef SFG_MONSTER_FLOW_FIELD
+  #define SFG_MONSTER_FLOW_FIELD 0
+#endif
+
+/**
+  How many map squares of the flow field (SFG_MONSTER_FLOW_FIELD) are computed
+  per frame after the player moves to another square.
+*/
+#ifndef SFG_FLOW_FIELD_BUDGET
+  #define SFG_FLOW_FIELD_BUDGET 256
+#endif
+
+/**
+  If 1, monster AI updates are spread over frames with at most SFG_AI_BUDGET
+  of them per frame, and monsters far from the player and out of sight are
+  updated half as often, so that a big room waking up doesn't make a slow
+  frame. If 0, all active monsters are updated together every few frames.
+*/
+#ifndef SFG_AI_SCHEDULER
+  #define SFG_AI_SCHEDULER 0
+#endif
+
+/**
+  Most monster AI updates per frame with SFG_AI_SCHEDULER.
+*/
+#ifndef SFG_AI_BUDGET
+  #define SFG_AI_BUDGET 8
+#endif
+
+/**
+  Monsters within this many squares (taxicab) of the player are updated at the
+  full AI rate with SFG_AI_SCHEDULER even when they're out of sight.
+*/
+#ifndef SFG_AI_NEAR_DISTANCE
+  #define SFG_AI_NEAR_DISTANCE 8
+#endif
+
+/**
+  If 1, the game is drawn as often as SFG_mainLoopBody() is called instead of
+  once per simulation step, with the camera, monsters and projectiles
+  interpolated between the last two steps (so the picture is one step behind).
+  Motion then stays smooth with a low SFG_FPS, which saves CPU time on the
+  simulation. The frontend decides how often to draw by how often it calls
+  SFG_mainLoopBody(), it isn't put to sleep between steps.
+*/
+#ifndef SFG_INTERPOLATION
+  #define SFG_INTERPOLATION 0
+#endif
+
+/**
+  If 1, the game runs headless, for balancing and regression tests: each call
+  of SFG_mainLoopBody() performs exactly one simulation step as fast as the CPU
+  allows, without looking at the clock or sleeping, and nothing is drawn. The
+  frontend only has to feed the inputs and can watch the run with
+  SFG_getRunState() (see tools/headless.c).
+*/
+#ifndef SFG_HEADLESS
+  #define SFG_HEADLESS 0
+#endif
+
+/**
+  Storage class of all the game state (SFG_game, SFG_player, SFG_currentLevel,
+  raycastlib's helper variables, ...). Defining it as e.g. _Thread_local gives
+  every thread its own game, so that a host program can run many games in
+  parallel threads (see tools/headless.c). Empty by default: the state is plain
+  globals.
+*/
+#ifndef SFG_THREAD_LOCAL
+  #define SFG_THREAD_LOCAL
+#endif
+
+/**
+  Number of column ranges the 3D view is split into for drawing them in
+  parallel, normally the number of worker threads of a host with a big
+  resolution. With more than 1 the frontend has to implement
+  SFG_drawInParallel(). Each range has the walls and then the sprites drawn
+  only into its own columns (and its part of the z-buffer). SFG_THREAD_LOCAL
+  has to stay empty then (the workers draw the same game) and
+  SFG_BACKGROUND_BLUR 0.
+*/
+#ifndef SFG_RENDER_THREADS
+  #define SFG_RENDER_THREADS 1
+#endif
+
+/**
+  If 1, the mutable game state is saved into a snapshot after every simulation
+  step while playing, and the recent snapshots are kept (as deltas) so that the
+  game can be rewound with SFG_rewind(), e.g. for reproducing AI bugs. Costs
+  about 3 * SFG_SNAPSHOT_SIZE (see game.h) plus SFG_SNAPSHOT_BUFFER_SIZE bytes
+  of RAM.
+*/
+#ifndef SFG_SNAPSHOTS
+  #define SFG_SNAPSHOTS 0
+#endif
+
+/**
+  Maximum number of steps SFG_SNAPSHOTS can rewind.
+*/
+#ifndef SFG_SNAPSHOT_COUNT
+  #define SFG_SNAPSHOT_COUNT 256
+#endif
+
+/**
+  Size in bytes of the buffer holding the deltas between the recent snapshots
+  with SFG_SNAPSHOTS. If it's full, the oldest ones are dropped even if there
+  are fewer than SFG_SNAPSHOT_COUNT.
+*/
+#ifndef SFG_SNAPSHOT_BUFFER_SIZE
+  #define SFG_SNAPSHOT_BUFFER_SIZE 32768
+#endif
+
+/**
+  If 1, the keys pressed in each game step can be recorded from a level start
+  (SFG_recordInput) and played back (SFG_playInput), the same on every
+  platform, e.g. for benchmarks, comparing drawn frames or reproducing bugs.
+  The record is run length encoded, usually a few bytes per second of play.
+*/
+#ifndef SFG_INPUT_RECORDS
+  #define SFG_INPUT_RECORDS 0
+#endif
+
 //------ developer/debug settings ------
 
 /**
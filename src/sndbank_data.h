@@ -0,0 +1,1828 @@
+/* Generated by tools/mkbank.c, don't edit. The sound bank of the build without a CD. */
+
+#ifndef SNDBANK_DATA_H
+#define SNDBANK_DATA_H
+
+static const unsigned char sndbank_click[4097] = {
+	0x0f, 0xff, 0xf9, 0x80, 0x11, 0x88, 0x89, 0x80, 0x11, 0x18, 0xab, 0xa0, 0x65, 0x43, 0x21, 0x08,
+	0x98, 0x80, 0x00, 0x80, 0x81, 0x10, 0xbf, 0xfd, 0xba, 0x91, 0x35, 0x33, 0x10, 0x08, 0x88, 0x00,
+	0x89, 0x80, 0x14, 0x29, 0xdf, 0xcb, 0xaa, 0x00, 0x10, 0x08, 0x80, 0x08, 0x8a, 0xa8, 0x66, 0x54,
+	0x22, 0x09, 0xab, 0xcc, 0xcb, 0xbb, 0xa9, 0x00, 0x08, 0x88, 0x25, 0x64, 0x31, 0x08, 0xaa, 0x91,
+	0x33, 0x29, 0xed, 0xca, 0xa8, 0x00, 0x8a, 0xdd, 0xba, 0x80, 0x35, 0x33, 0x11, 0x08, 0x98, 0x80,
+	0x00, 0x08, 0x08, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x89, 0x80, 0x01, 0x18,
+	0x9a, 0x90, 0x22, 0x28, 0xcb, 0xa1, 0x54, 0x29, 0xdd, 0xa0, 0x75, 0x44, 0x21, 0x88, 0x98, 0x80,
+	0x10, 0x88, 0x80, 0x08, 0x89, 0x98, 0x47, 0x74, 0x34, 0x23, 0x11, 0x09, 0x89, 0x80, 0x12, 0x18,
+	0xce, 0xdb, 0xba, 0x81, 0x24, 0x44, 0x33, 0x43, 0x23, 0x35, 0x34, 0x41, 0x10, 0x88, 0x03, 0x44,
+	0x32, 0x19, 0xbc, 0xcb, 0xbc, 0xca, 0xb9, 0x91, 0x25, 0x34, 0x23, 0x34, 0x43, 0x33, 0x20, 0x08,
+	0x88, 0x18, 0x9a, 0x90, 0x57, 0x43, 0x22, 0x88, 0x98, 0x80, 0x08, 0xa0, 0x27, 0x63, 0x41, 0x08,
+	0xab, 0xcc, 0xbb, 0xcb, 0xa9, 0x80, 0x13, 0x54, 0x54, 0x43, 0x32, 0x22, 0x00, 0x08, 0x88, 0x08,
+	0x01, 0x18, 0xad, 0xdd, 0xbc, 0xaa, 0xa9, 0x80, 0x14, 0x35, 0x34, 0x32, 0x31, 0x18, 0xbf, 0xcd,
+	0xbc, 0xcb, 0xbb, 0xbb, 0x99, 0x80, 0x12, 0x23, 0x53, 0x33, 0x10, 0x88, 0x00, 0x18, 0xae, 0xdb,
+	0xb9, 0x80, 0x20, 0x08, 0x90, 0x01, 0xaf, 0xff, 0xbd, 0xba, 0xa8, 0x03, 0x33, 0x21, 0x8a, 0xbb,
+	0xa8, 0x00, 0x89, 0x90, 0x37, 0x52, 0x28, 0xbd, 0xcb, 0xcc, 0xbc, 0xcc, 0xab, 0xaa, 0x9a, 0xa9,
+	0x90, 0x14, 0x44, 0x44, 0x35, 0x22, 0x20, 0x8a, 0xbd, 0xbb, 0xbb, 0xa8, 0x01, 0x22, 0x31, 0x33,
+	0x65, 0x33, 0x30, 0x9c, 0xcb, 0xa9, 0x81, 0x08, 0x9a, 0x80, 0x36, 0x42, 0x19, 0xbc, 0xca, 0x81,
+	0x23, 0x43, 0x34, 0x34, 0x33, 0x34, 0x33, 0x43, 0x43, 0x33, 0x33, 0x08, 0xcc, 0xcc, 0xa9, 0x00,
+	0x11, 0x08, 0xaa, 0x91, 0x37, 0x44, 0x34, 0x23, 0x31, 0x18, 0xbe, 0xbb, 0xb9, 0x01, 0x0a, 0xed,
+	0xbb, 0x91, 0x45, 0x22, 0x0a, 0xbc, 0xa0, 0x25, 0x43, 0x31, 0x10, 0x88, 0x00, 0x80, 0x88, 0x88,
+	0x11, 0x20, 0xdf, 0xfd, 0xbc, 0xba, 0x80, 0x13, 0x21, 0x08, 0xaa, 0xbc, 0xcb, 0xca, 0x91, 0x56,
+	0x44, 0x23, 0x20, 0x08, 0x9a, 0xad, 0xcc, 0xbc, 0xca, 0xaa, 0xaa, 0x98, 0x81, 0x25, 0x35, 0x32,
+	0x33, 0x23, 0x22, 0x19, 0xbd, 0xcb, 0xaa, 0x9a, 0xbb, 0xca, 0x82, 0x65, 0x33, 0x11, 0x88, 0x80,
+	0x01, 0x08, 0x9a, 0x91, 0x37, 0x34, 0x19, 0xcf, 0xcc, 0xba, 0xa8, 0x80, 0x11, 0x34, 0x54, 0x43,
+	0x32, 0x31, 0x11, 0x08, 0xab, 0xec, 0xcb, 0xcb, 0xbb, 0xa9, 0x90, 0x12, 0x33, 0x35, 0x44, 0x34,
+	0x32, 0x10, 0x08, 0x9a, 0xcc, 0xcc, 0xca, 0xa9, 0x98, 0x9a, 0x9a, 0x80, 0x35, 0x35, 0x22, 0x11,
+	0x12, 0x08, 0xae, 0xcb, 0xba, 0x9a, 0xab, 0xec, 0xba, 0xa9, 0x81, 0x13, 0x53, 0x53, 0x33, 0x21,
+	0x19, 0x9c, 0xdc, 0xbb, 0xba, 0xaa, 0xaa, 0xbc, 0xb9, 0x91, 0x26, 0x45, 0x44, 0x34, 0x21, 0x08,
+	0xab, 0xdc, 0xbb, 0xb9, 0x91, 0x13, 0x12, 0x12, 0x54, 0x42, 0x21, 0x09, 0x88, 0x00, 0x8b, 0xcc,
+	0xa0, 0x25, 0x44, 0x33, 0x53, 0x44, 0x34, 0x23, 0x33, 0x33, 0x10, 0x9b, 0xdb, 0xcb, 0xab, 0xbd,
+	0xbd, 0xaa, 0xa0, 0x12, 0x44, 0x35, 0x42, 0x33, 0x22, 0x33, 0x34, 0x21, 0x9c, 0xdc, 0xba, 0xaa,
+	0xaa, 0xaa, 0x03, 0x54, 0x32, 0x11, 0x12, 0x54, 0x33, 0x42, 0x22, 0x19, 0xbf, 0xcc, 0xca, 0x99,
+	0x81, 0x13, 0x35, 0x43, 0x33, 0x22, 0x08, 0x80, 0x01, 0x08, 0xad, 0xec, 0xbc, 0xbc, 0xbb, 0xba,
+	0xa9, 0x80, 0x12, 0x43, 0x55, 0x34, 0x33, 0x23, 0x23, 0x23, 0x32, 0x22, 0x10, 0x9d, 0xdd, 0xcc,
+	0xab, 0xab, 0xaa, 0xcb, 0xcb, 0xcb, 0xcb, 0xba, 0x90, 0x26, 0x44, 0x23, 0x21, 0x00, 0x00, 0x11,
+	0x22, 0x34, 0x33, 0x18, 0xee, 0xdb, 0xda, 0xa9, 0x81, 0x11, 0x18, 0x8b, 0xcb, 0xca, 0x81, 0x45,
+	0x54, 0x34, 0x22, 0x10, 0x09, 0xa9, 0xa9, 0xaa, 0xcb, 0xcd, 0xbd, 0xac, 0xa9, 0x80, 0x24, 0x43,
+	0x41, 0x10, 0x8a, 0xaa, 0xaa, 0x98, 0x12, 0x20, 0x8d, 0xdc, 0xbb, 0x80, 0x45, 0x43, 0x33, 0x10,
+	0x9b, 0xcb, 0xb9, 0x03, 0x63, 0x41, 0x09, 0xdd, 0xcb, 0xba, 0x81, 0x55, 0x43, 0x42, 0x18, 0xab,
+	0xec, 0xba, 0xba, 0x90, 0x13, 0x53, 0x33, 0x32, 0x10, 0x88, 0xab, 0xcb, 0xca, 0xba, 0xbb, 0xba,
+	0x82, 0x75, 0x44, 0x34, 0x23, 0x10, 0x89, 0xcc, 0xcb, 0xbb, 0xba, 0x90, 0x02, 0x34, 0x44, 0x33,
+	0x32, 0x31, 0x10, 0x99, 0xab, 0xcb, 0xbd, 0xbc, 0xcb, 0xdb, 0xcb, 0xca, 0xa9, 0x02, 0x54, 0x44,
+	0x32, 0x32, 0x10, 0x8a, 0xab, 0xbb, 0xa8, 0x11, 0x34, 0x22, 0x09, 0xbd, 0xcc, 0xbb, 0xab, 0x99,
+	0x02, 0x65, 0x45, 0x35, 0x32, 0x31, 0x89, 0xcd, 0xcb, 0xbb, 0xa9, 0x81, 0x12, 0x21, 0x8c, 0xcd,
+	0xba, 0x90, 0x47, 0x44, 0x33, 0x22, 0x8a, 0xcd, 0xbc, 0xbb, 0xba, 0xa9, 0x89, 0x99, 0xaa, 0x98,
+	0x27, 0x54, 0x53, 0x42, 0x21, 0x08, 0x9a, 0xbb, 0xa9, 0x82, 0x35, 0x22, 0x8b, 0xfc, 0xcb, 0xca,
+	0x98, 0x02, 0x43, 0x34, 0x22, 0x00, 0x99, 0x99, 0x81, 0x23, 0x31, 0x8c, 0xed, 0xcb, 0xbb, 0xa0,
+	0x25, 0x45, 0x33, 0x33, 0x10, 0x9a, 0xbd, 0xba, 0xaa, 0x88, 0x10, 0x10, 0x9b, 0xcd, 0xcc, 0xaa,
+	0x80, 0x26, 0x44, 0x34, 0x23, 0x10, 0x8a, 0xcd, 0xbc, 0xbb, 0xaa, 0x98, 0x02, 0x36, 0x33, 0x52,
+	0x33, 0x22, 0x20, 0x89, 0xcc, 0xcb, 0xcc, 0xaa, 0x99, 0x81, 0x13, 0x35, 0x23, 0x32, 0x22, 0x00,
+	0x88, 0x99, 0xaa, 0xac, 0xbc, 0xaa, 0x98, 0x8a, 0xcc, 0xca, 0xa8, 0x81, 0x88, 0x98, 0x37, 0x75,
+	0x42, 0x20, 0x8a, 0xcb, 0xcb, 0xbb, 0xa9, 0x90, 0x24, 0x53, 0x43, 0x23, 0x11, 0x8a, 0xbe, 0xbb,
+	0xa9, 0x12, 0x34, 0x33, 0x43, 0x42, 0x0a, 0xdd, 0xcb, 0xbb, 0x99, 0x80, 0x12, 0x23, 0x54, 0x34,
+	0x33, 0x31, 0x19, 0xbd, 0xdb, 0xbb, 0xaa, 0x98, 0x12, 0x64, 0x53, 0x33, 0x18, 0xab, 0xcb, 0xa9,
+	0xa8, 0x90, 0x02, 0x42, 0x18, 0xbe, 0xcb, 0xaa, 0x99, 0x01, 0x34, 0x44, 0x33, 0x22, 0x22, 0x42,
+	0x30, 0x8d, 0xec, 0xbb, 0xb9, 0xa8, 0x99, 0x81, 0x26, 0x44, 0x34, 0x34, 0x21, 0x0b, 0xdd, 0xca,
+	0x80, 0x22, 0x20, 0xad, 0xbb, 0x03, 0x74, 0x31, 0x89, 0xbb, 0x91, 0x35, 0x21, 0xac, 0xdb, 0xb8,
+	0x02, 0x23, 0x08, 0x9a, 0x98, 0x14, 0x32, 0x18, 0xaa, 0x90, 0x44, 0x31, 0x8c, 0xec, 0xba, 0x98,
+	0x13, 0x34, 0x31, 0x09, 0xbc, 0xb9, 0x91, 0x10, 0x09, 0x81, 0x67, 0x43, 0x31, 0x09, 0x99, 0x81,
+	0x34, 0x19, 0xcd, 0xcb, 0xa8, 0x00, 0x88, 0xbc, 0xb9, 0x03, 0x63, 0x32, 0x09, 0x99, 0x02, 0x44,
+	0x21, 0x08, 0xa8, 0x12, 0x43, 0x19, 0xcd, 0xba, 0x81, 0x22, 0x1a, 0xac, 0x99, 0x8a, 0xff, 0xcb,
+	0xb9, 0x01, 0x43, 0x32, 0x11, 0x01, 0x22, 0x18, 0xcc, 0xcb, 0x81, 0x43, 0x31, 0xbe, 0xcc, 0xa9,
+	0x01, 0x20, 0x08, 0x88, 0x23, 0x41, 0x0c, 0xcc, 0xa9, 0x80, 0x10, 0x88, 0x01, 0x18, 0xbf, 0xea,
+	0xa9, 0x13, 0x42, 0x21, 0x11, 0x33, 0x40, 0x9d, 0xdc, 0xab, 0x99, 0x00, 0x00, 0x08, 0x88, 0x00,
+	0x88, 0x88, 0x14, 0x64, 0x43, 0x41, 0x18, 0xad, 0xbc, 0xb9, 0x81, 0x34, 0x32, 0x09, 0xaa, 0x91,
+	0x34, 0x18, 0xdd, 0xca, 0x91, 0x35, 0x31, 0x19, 0xaa, 0x91, 0x33, 0x28, 0xfe, 0xcb, 0xca, 0xa9,
+	0x80, 0x14, 0x35, 0x34, 0x23, 0x11, 0x21, 0x23, 0x45, 0x43, 0x31, 0x8b, 0xfd, 0xca, 0xa9, 0x00,
+	0x11, 0x23, 0x34, 0x20, 0x8c, 0xdb, 0xc9, 0x80, 0x23, 0x33, 0x33, 0x44, 0x32, 0x19, 0xbe, 0xbb,
+	0xa0, 0x23, 0x34, 0x22, 0x12, 0x08, 0xbc, 0xda, 0x98, 0x00, 0x8c, 0xda, 0xa0, 0x35, 0x33, 0x09,
+	0xac, 0xbb, 0xdb, 0xbb, 0xa0, 0x37, 0x42, 0x31, 0x00, 0x80, 0x81, 0x08, 0x99, 0x80, 0x20, 0xcf,
+	0xff, 0xab, 0x99, 0x02, 0x42, 0x32, 0x21, 0x21, 0x21, 0x19, 0xab, 0xcb, 0xba, 0x80, 0x24, 0x44,
+	0x53, 0x53, 0x43, 0x21, 0x89, 0xbb, 0xa8, 0x35, 0x53, 0x31, 0x0a, 0xbb, 0xcb, 0xbb, 0xca, 0x90,
+	0x45, 0x32, 0x19, 0xcc, 0xab, 0xab, 0xcc, 0xba, 0x90, 0x28, 0xaf, 0xdb, 0xbb, 0x99, 0xbc, 0xdb,
+	0xb9, 0x80, 0x20, 0x08, 0x98, 0x00, 0x09, 0x88, 0x27, 0x44, 0x20, 0xae, 0xbc, 0xa9, 0x80, 0x80,
+	0x99, 0x88, 0x35, 0x43, 0x21, 0x88, 0x82, 0x55, 0x42, 0x32, 0x22, 0x43, 0x32, 0x19, 0xbe, 0xbc,
+	0x90, 0x25, 0x43, 0x32, 0x09, 0x90, 0x25, 0x42, 0x18, 0x88, 0x15, 0x42, 0x19, 0xbd, 0xaa, 0x00,
+	0x10, 0x88, 0x04, 0x54, 0x21, 0x09, 0x81, 0x45, 0x43, 0x22, 0x22, 0x34, 0x42, 0x18, 0xcc, 0xba,
+	0x90, 0x00, 0x9b, 0x90, 0x55, 0x29, 0xde, 0xca, 0x80, 0x00, 0xab, 0xca, 0x16, 0x33, 0x0a, 0xcc,
+	0x98, 0x10, 0xae, 0xcb, 0x90, 0x22, 0x8b, 0xdb, 0x81, 0x33, 0xaf, 0xcb, 0x81, 0x53, 0x19, 0xbd,
+	0xa0, 0x23, 0x28, 0xbd, 0xa0, 0x24, 0x30, 0xad, 0xb9, 0x15, 0x42, 0x19, 0xbc, 0x91, 0x44, 0x28,
+	0xad, 0xa8, 0x44, 0x31, 0x9d, 0xb9, 0x25, 0x42, 0x9b, 0xca, 0x04, 0x42, 0x8b, 0xea, 0x03, 0x43,
+	0x8b, 0xea, 0x83, 0x43, 0x0b, 0xdb, 0x82, 0x53, 0x0a, 0xcc, 0x81, 0x34, 0x19, 0xcb, 0xa0, 0x54,
+	0x28, 0xbd, 0xa8, 0x46, 0x31, 0xaf, 0xcb, 0x82, 0x64, 0x21, 0xac, 0xd9, 0x81, 0x34, 0x18, 0xab,
+	0xa8, 0x35, 0x21, 0x9c, 0xba, 0x83, 0x42, 0x1a, 0xcb, 0xb0, 0x35, 0x30, 0xac, 0xc9, 0x14, 0x42,
+	0x1a, 0xcc, 0x98, 0x24, 0x11, 0xaa, 0xb9, 0x13, 0x41, 0x8a, 0xca, 0x81, 0x43, 0x10, 0xbb, 0xb8,
+	0x12, 0x41, 0x9b, 0xcb, 0x91, 0x34, 0x31, 0x8a, 0xa8, 0x11, 0x19, 0xbc, 0xb8, 0x12, 0x10, 0x90,
+	0x56, 0x43, 0x8a, 0xdc, 0x98, 0x12, 0x20, 0xab, 0x98, 0x12, 0x19, 0xca, 0x16, 0x53, 0x19, 0xcd,
+	0xa8, 0x22, 0x30, 0xae, 0xba, 0x83, 0x53, 0x20, 0xab, 0xca, 0x02, 0x42, 0x18, 0xbc, 0xa9, 0x01,
+	0x21, 0x09, 0x98, 0x00, 0x08, 0x83, 0x65, 0x31, 0x9d, 0xcb, 0x82, 0x53, 0x30, 0xac, 0xb9, 0x13,
+	0x52, 0x09, 0xab, 0x98, 0x01, 0x21, 0x22, 0x08, 0xbe, 0xba, 0x16, 0x53, 0x21, 0x9a, 0xb9, 0x13,
+	0x53, 0x08, 0xcb, 0xb9, 0x12, 0x42, 0x09, 0xbc, 0xa8, 0x35, 0x42, 0x19, 0xbd, 0xb9, 0x84, 0x44,
+	0x33, 0x09, 0xab, 0xa1, 0x55, 0x42, 0x18, 0xaa, 0xa0, 0x24, 0x31, 0x8d, 0xdc, 0x99, 0x13, 0x43,
+	0x28, 0x9b, 0xc9, 0x80, 0x22, 0x19, 0xbd, 0xbb, 0x98, 0x10, 0x9c, 0xcc, 0xba, 0x81, 0x22, 0x19,
+	0xcd, 0xcb, 0xaa, 0x00, 0x21, 0x18, 0xbf, 0xcb, 0xb9, 0x91, 0x22, 0x19, 0xbc, 0xb1, 0x67, 0x44,
+	0x22, 0x08, 0xac, 0xa9, 0x88, 0x00, 0x9a, 0xcb, 0xcb, 0xca, 0xa0, 0x56, 0x54, 0x21, 0x8a, 0xc9,
+	0x92, 0x24, 0x10, 0x9b, 0x98, 0x23, 0x41, 0x89, 0x82, 0x43, 0x29, 0xfc, 0xca, 0x80, 0x33, 0x21,
+	0x80, 0x05, 0x43, 0x29, 0xec, 0xba, 0x03, 0x43, 0x08, 0x98, 0x37, 0x32, 0x8c, 0xdb, 0x83, 0x64,
+	0x28, 0xbe, 0xbb, 0x90, 0x34, 0x42, 0x10, 0x80, 0x98, 0x9b, 0xdb, 0xba, 0x04, 0x55, 0x32, 0x10,
+	0x9b, 0xdb, 0xbb, 0x90, 0x23, 0x28, 0xbd, 0xb9, 0x27, 0x42, 0x1a, 0xcc, 0xba, 0x82, 0x23, 0x21,
+	0x11, 0x22, 0x19, 0xed, 0xcb, 0xa8, 0x02, 0x34, 0x21, 0x00, 0x09, 0x9b, 0xcb, 0xa8, 0x13, 0x31,
+	0x8c, 0xba, 0x04, 0x42, 0x9c, 0xdb, 0x92, 0x43, 0x38, 0xac, 0x92, 0x45, 0x28, 0xac, 0xca, 0x81,
+	0x21, 0x19, 0xab, 0x81, 0x34, 0x19, 0xcd, 0xb9, 0x03, 0x42, 0x0a, 0xda, 0x82, 0x64, 0x21, 0x9a,
+	0xda, 0x80, 0x34, 0x20, 0x09, 0x04, 0x53, 0x29, 0xec, 0xb9, 0x14, 0x32, 0x9c, 0xc9, 0x14, 0x52,
+	0x1a, 0xbb, 0x93, 0x53, 0x0b, 0xeb, 0x81, 0x43, 0x29, 0xcc, 0xa0, 0x24, 0x28, 0xbc, 0xa0, 0x36,
+	0x31, 0x9a, 0xca, 0x82, 0x42, 0x0c, 0xdb, 0x91, 0x53, 0x19, 0xdc, 0x90, 0x44, 0x28, 0xcc, 0xa1,
+	0x64, 0x28, 0xdd, 0xba, 0x15, 0x52, 0x18, 0xcb, 0xb8, 0x15, 0x32, 0x0b, 0xeb, 0x90, 0x35, 0x31,
+	0x8a, 0xcb, 0x91, 0x23, 0x20, 0xaa, 0xa0, 0x34, 0x28, 0xcd, 0xba, 0x03, 0x33, 0x19, 0xba, 0x13,
+	0x72, 0x10, 0xbb, 0xba, 0x01, 0x20, 0xac, 0xca, 0x03, 0x63, 0x21, 0xab, 0xaa, 0x14, 0x31, 0x8c,
+	0xcb, 0xb8, 0x14, 0x33, 0x20, 0x9b, 0xca, 0x92, 0x54, 0x19, 0xcd, 0xb9, 0x14, 0x53, 0x18, 0xbc,
+	0xa9, 0x02, 0x31, 0x89, 0xa9, 0x02, 0x20, 0x9b, 0x91, 0x44, 0x1a, 0xfc, 0xa9, 0x15, 0x33, 0x19,
+	0xcc, 0xa0, 0x24, 0x41, 0x0b, 0xcc, 0x98, 0x24, 0x22, 0x09, 0x9a, 0x98, 0x11, 0x11, 0x80, 0x9a,
+	0xbc, 0x90, 0x56, 0x33, 0x8a, 0xeb, 0xa0, 0x24, 0x32, 0x1a, 0xa9, 0x03, 0x53, 0x30, 0xbc, 0xdb,
+	0xa8, 0x02, 0x42, 0x20, 0x88, 0x80, 0x10, 0x8d, 0xec, 0xb9, 0x82, 0x43, 0x10, 0xaa, 0xb8, 0x81,
+	0x09, 0x90, 0x24, 0x39, 0xee, 0xb9, 0x24, 0x40, 0x9e, 0xca, 0x92, 0x43, 0x28, 0xbb, 0xb8, 0x23,
+	0x2a, 0xfd, 0xb9, 0x02, 0x42, 0x09, 0xa9, 0x16, 0x42, 0x8b, 0xfb, 0x83, 0x64, 0x18, 0xdd, 0xa9,
+	0x24, 0x52, 0x09, 0xcc, 0xa8, 0x24, 0x31, 0x0a, 0xcb, 0x90, 0x34, 0x30, 0x8c, 0xbb, 0x81, 0x43,
+	0x30, 0xab, 0xc9, 0x13, 0x41, 0x0b, 0xdb, 0xb0, 0x26, 0x42, 0x18, 0xbd, 0xbb, 0x83, 0x54, 0x20,
+	0xbd, 0xb9, 0x03, 0x43, 0x19, 0xdb, 0xa0, 0x35, 0x20, 0x9b, 0xba, 0x02, 0x32, 0x9a, 0xba, 0x25,
+	0x52, 0x0a, 0xbb, 0x91, 0x44, 0x29, 0xdc, 0xb9, 0x15, 0x33, 0x0b, 0xcb, 0x81, 0x44, 0x18, 0xbb,
+	0xb8, 0x14, 0x20, 0x9a, 0x02, 0x33, 0xaf, 0xdb, 0x82, 0x63, 0x38, 0xbd, 0xba, 0x13, 0x43, 0x0a,
+	0xcb, 0xa0, 0x24, 0x31, 0x8a, 0xba, 0x81, 0x30, 0x8c, 0xb8, 0x27, 0x41, 0x8b, 0xea, 0x91, 0x34,
+	0x19, 0xbc, 0xa1, 0x34, 0x38, 0xac, 0xb8, 0x13, 0x41, 0x8a, 0xb9, 0x13, 0x32, 0xac, 0xca, 0x81,
+	0x20, 0x9d, 0xba, 0x05, 0x53, 0x20, 0xaa, 0xb9, 0x01, 0x28, 0xce, 0xb9, 0x24, 0x52, 0x09, 0xcb,
+	0x90, 0x44, 0x20, 0x9a, 0xba, 0x01, 0x08, 0xbd, 0xa8, 0x34, 0x42, 0x88, 0xa9, 0x00, 0x08, 0xce,
+	0xba, 0x91, 0x35, 0x32, 0x10, 0x88, 0x00, 0x00, 0x9a, 0x90, 0x43, 0x29, 0xec, 0xa1, 0x57, 0x22,
+	0x8a, 0xca, 0x81, 0x43, 0x19, 0xcb, 0xb1, 0x44, 0x30, 0xbd, 0xc9, 0x91, 0x23, 0x33, 0x31, 0x18,
+	0xbe, 0xcb, 0x99, 0x00, 0x08, 0x98, 0x36, 0x53, 0x18, 0xbe, 0xba, 0x81, 0x22, 0x19, 0xbb, 0x91,
+	0x55, 0x43, 0x18, 0xbe, 0xbb, 0x80, 0x44, 0x32, 0x0a, 0xbd, 0xa9, 0x00, 0x00, 0x88, 0x12, 0x73,
+	0x42, 0x19, 0xbc, 0xca, 0xa8, 0x80, 0x00, 0x08, 0x00, 0x80, 0x98, 0x90, 0x22, 0x18, 0xdc, 0x90,
+	0x55, 0x29, 0xde, 0xca, 0x91, 0x35, 0x22, 0x09, 0x99, 0x80, 0x11, 0x08, 0x99, 0x80, 0x21, 0x08,
+	0xaa, 0x91, 0x23, 0x2a, 0xcb, 0xa1, 0x54, 0x19, 0xcb, 0xa1, 0x64, 0x18, 0xdd, 0xa1, 0x56, 0x42,
+	0x19, 0xbd, 0xaa, 0x81, 0x11, 0x09, 0x81, 0x56, 0x41, 0x8d, 0xcc, 0x91, 0x46, 0x33, 0x09, 0xbe,
+	0xaa, 0x81, 0x12, 0x11, 0x99, 0x99, 0x99, 0x80, 0x13, 0x35, 0x19, 0xde, 0xbb, 0x81, 0x34, 0x29,
+	0xdd, 0xa8, 0x36, 0x42, 0x20, 0x98, 0x13, 0x33, 0x9f, 0xfb, 0xb9, 0x82, 0x43, 0x21, 0x89, 0xa9,
+	0x80, 0x18, 0x9a, 0xa9, 0x12, 0x53, 0x22, 0x25, 0x43, 0x29, 0xee, 0xbb, 0xa0, 0x34, 0x32, 0x8a,
+	0xbb, 0x90, 0x80, 0x98, 0x16, 0x54, 0x32, 0x08, 0xbb, 0xba, 0x98, 0x8b, 0xcb, 0x91, 0x54, 0x30,
+	0xad, 0xca, 0x02, 0x31, 0x9f, 0xcb, 0xa8, 0x12, 0x55, 0x36, 0x33, 0x19, 0xdd, 0xca, 0x92, 0x54,
+	0x21, 0x9c, 0xcc, 0xa0, 0x13, 0x33, 0x0a, 0xca, 0x91, 0x54, 0x31, 0x9c, 0xcb, 0xa0, 0x25, 0x23,
+	0x08, 0xaa, 0xaa, 0x88, 0x8a, 0xbb, 0xa0, 0x47, 0x34, 0x10, 0xaa, 0xa9, 0x81, 0x12, 0x89, 0xbb,
+	0xa0, 0x46, 0x32, 0x19, 0xbe, 0xca, 0xa8, 0x02, 0x43, 0x32, 0x09, 0xaa, 0xb8, 0x81, 0x08, 0x90,
+	0x15, 0x53, 0x20, 0xbe, 0xcb, 0x99, 0x02, 0x22, 0x21, 0x11, 0x21, 0x19, 0xae, 0xbc, 0xa9, 0x03,
+	0x64, 0x34, 0x11, 0x9c, 0xcc, 0xba, 0x00, 0x32, 0x21, 0x02, 0x25, 0x21, 0x9f, 0xcb, 0xa8, 0x25,
+	0x33, 0x28, 0xaa, 0xbb, 0x88, 0x08, 0x88, 0x88, 0x23, 0x44, 0x20, 0x08, 0x98, 0x00, 0x8a, 0xfc,
+	0xbc, 0x91, 0x45, 0x34, 0x20, 0x8b, 0xdb, 0xa9, 0x02, 0x32, 0x21, 0x88, 0x8a, 0xbf, 0xdb, 0xba,
+	0x14, 0x63, 0x18, 0xae, 0xba, 0x02, 0x65, 0x33, 0x22, 0x09, 0x9c, 0xcd, 0xbb, 0xba, 0x91, 0x24,
+	0x33, 0x10, 0x98, 0x90, 0x21, 0x29, 0xbf, 0xca, 0x81, 0x55, 0x44, 0x20, 0x8a, 0xbd, 0xaa, 0x02,
+	0x24, 0x20, 0x89, 0x99, 0x00, 0x8c, 0xfd, 0xaa, 0x05, 0x54, 0x21, 0x8c, 0xdb, 0xa9, 0x13, 0x52,
+	0x08, 0xaa, 0x98, 0x23, 0x41, 0x9b, 0xcb, 0x82, 0x44, 0x32, 0x89, 0xaa, 0xaa, 0xaa, 0xbc, 0xc9,
+	0x81, 0x44, 0x22, 0x8a, 0xbb, 0xa1, 0x56, 0x34, 0x20, 0x8b, 0xdb, 0xa9, 0x11, 0x18, 0xcc, 0xa9,
+	0x27, 0x52, 0x28, 0xab, 0xc9, 0x82, 0x43, 0x10, 0xac, 0xba, 0x90, 0x08, 0x89, 0xa9, 0x14, 0x54,
+	0x21, 0x88, 0x98, 0x00, 0x89, 0xbd, 0xaa, 0x80, 0x22, 0x22, 0x24, 0x23, 0x18, 0xcc, 0xb9, 0x81,
+	0x18, 0xcd, 0xc9, 0x04, 0x63, 0x21, 0xad, 0xcb, 0xa8, 0x12, 0x23, 0x34, 0x43, 0x40, 0xad, 0xeb,
+	0xb9, 0x82, 0x35, 0x33, 0x21, 0x19, 0xab, 0xdb, 0xb9, 0x80, 0x11, 0x08, 0x91, 0x47, 0x43, 0x10,
+	0xab, 0xda, 0x02, 0x34, 0x1a, 0xec, 0xca, 0x81, 0x23, 0x41, 0x10, 0x08, 0x80, 0x9a, 0xbd, 0xca,
+	0x80, 0x34, 0x42, 0x11, 0x88, 0xaa, 0xba, 0x91, 0x44, 0x41, 0x8d, 0xdb, 0xc9, 0x80, 0x22, 0x33,
+	0x43, 0x42, 0x20, 0x8b, 0xdd, 0xcb, 0xcb, 0x91, 0x45, 0x43, 0x20, 0x89, 0xa9, 0xa9, 0xab, 0xbb,
+	0x90, 0x33, 0x1b, 0xff, 0xa8, 0x36, 0x53, 0x31, 0x0a, 0xdb, 0xbb, 0x99, 0x00, 0x00, 0x11, 0x22,
+	0x23, 0x23, 0x43, 0x31, 0x9d, 0xdb, 0xc8, 0x02, 0x33, 0x21, 0x9c, 0xbc, 0xb8, 0x04, 0x43, 0x30,
+	0xad, 0xcc, 0xa9, 0x12, 0x33, 0x21, 0x8a, 0xab, 0xbb, 0xcb, 0xa8, 0x17, 0x44, 0x33, 0x20, 0x22,
+	0x34, 0x28, 0xee, 0xdb, 0xba, 0xa8, 0x88, 0x01, 0x37, 0x44, 0x33, 0x10, 0x9a, 0xab, 0xa9, 0x98,
+	0xaa, 0xcb, 0xb9, 0x14, 0x42, 0x29, 0xdc, 0xcb, 0x90, 0x26, 0x43, 0x22, 0x09, 0x9b, 0xba, 0xa9,
+	0x01, 0x44, 0x43, 0x18, 0xdd, 0xbc, 0x98, 0x01, 0x21, 0x01, 0x23, 0x64, 0x20, 0x8c, 0xcc, 0xba,
+	0x98, 0x13, 0x43, 0x33, 0x22, 0x88, 0x9a, 0x9a, 0xbd, 0xcb, 0xca, 0x03, 0x73, 0x32, 0x8b, 0xcb,
+	0x80, 0x32, 0x0a, 0xec, 0x98, 0x12, 0x21, 0x09, 0x81, 0x24, 0x42, 0x22, 0x33, 0x39, 0xfd, 0xca,
+	0x81, 0x22, 0x0b, 0xeb, 0x90, 0x35, 0x31, 0x8b, 0xda, 0x81, 0x23, 0x09, 0xbb, 0x06, 0x63, 0x0b,
+	0xfc, 0xa8, 0x25, 0x31, 0x8b, 0xbb, 0x16, 0x42, 0x0a, 0xcb, 0x92, 0x33, 0x8d, 0xdb, 0x82, 0x72,
+	0x28, 0xbe, 0xa9, 0x25, 0x53, 0x32, 0x32, 0x22, 0x0c, 0xfd, 0xcb, 0x90, 0x36, 0x32, 0x0a, 0xcc,
+	0xb9, 0x80, 0x00, 0xaa, 0xa2, 0x77, 0x42, 0x28, 0xac, 0xdb, 0x98, 0x23, 0x43, 0x18, 0xab, 0xbc,
+	0x98, 0x11, 0x22, 0x18, 0x89, 0x82, 0x34, 0x31, 0x8d, 0xcb, 0xb8, 0x14, 0x42, 0x08, 0xab, 0x90,
+	0x24, 0x19, 0xdd, 0xca, 0x90, 0x24, 0x22, 0x33, 0x53, 0x18, 0xde, 0xca, 0x80, 0x24, 0x21, 0x99,
+	0xa8, 0x14, 0x42, 0x0a, 0xeb, 0xba, 0x91, 0x23, 0x11, 0x24, 0x43, 0x30, 0xaf, 0xbb, 0x91, 0x24,
+	0x18, 0xab, 0x81, 0x53, 0x38, 0xbd, 0xb8, 0x23, 0x38, 0xed, 0xb9, 0x04, 0x53, 0x18, 0xbd, 0xaa,
+	0x13, 0x42, 0x09, 0xca, 0x91, 0x34, 0x10, 0xbb, 0xb8, 0x55, 0x32, 0x8b, 0xea, 0x98, 0x12, 0x18,
+	0xbd, 0xa8, 0x25, 0x43, 0x19, 0xbc, 0xb9, 0x12, 0x43, 0x19, 0xab, 0xba, 0xa8, 0x02, 0x35, 0x43,
+	0x20, 0x9c, 0xbb, 0x98, 0x20, 0x9d, 0xdb, 0xa0, 0x65, 0x33, 0x28, 0xac, 0xbb, 0xa9, 0x98, 0x81,
+	0x44, 0x43, 0x09, 0xbc, 0xa0, 0x34, 0x30, 0xad, 0xd9, 0x82, 0x44, 0x18, 0xad, 0xc9, 0x82, 0x35,
+	0x21, 0x8a, 0xab, 0x99, 0x08, 0x8a, 0x99, 0x13, 0x73, 0x33, 0x00, 0x99, 0xaa, 0xcc, 0xcc, 0xa8,
+	0x14, 0x53, 0x30, 0x8c, 0xba, 0xa0, 0x12, 0x1a, 0xcc, 0xa0, 0x37, 0x42, 0x18, 0xab, 0xb9, 0x12,
+	0x31, 0x8a, 0xbd, 0xa8, 0x88, 0x10, 0x22, 0x32, 0x1a, 0xcc, 0x90, 0x44, 0x30, 0xae, 0xcb, 0x92,
+	0x54, 0x32, 0x89, 0xaa, 0x81, 0x31, 0xae, 0xdb, 0xb8, 0x24, 0x33, 0x20, 0x88, 0x99, 0xbd, 0xbc,
+	0x91, 0x24, 0x32, 0x11, 0x14, 0x43, 0x19, 0xdd, 0xca, 0x90, 0x13, 0x20, 0x8b, 0xa9, 0x24, 0x42,
+	0x0a, 0xdb, 0xa0, 0x25, 0x31, 0x8b, 0xcb, 0xa0, 0x24, 0x42, 0x21, 0x10, 0x88, 0x8a, 0x9b, 0xdc,
+	0xcc, 0xaa, 0x81, 0x44, 0x34, 0x11, 0x8a, 0xac, 0xab, 0x98, 0x03, 0x34, 0x21, 0x02, 0x24, 0x31,
+	0x8d, 0xdc, 0xb9, 0x80, 0x21, 0x19, 0xaa, 0x91, 0x35, 0x32, 0x09, 0x90, 0x36, 0x42, 0x8c, 0xec,
+	0xbb, 0x81, 0x34, 0x43, 0x31, 0x20, 0x18, 0x9a, 0xdd, 0xca, 0xb9, 0x91, 0x23, 0x43, 0x22, 0x08,
+	0xab, 0xca, 0x99, 0x00, 0x00, 0x88, 0x00, 0x18, 0x9b, 0xa0, 0x66, 0x44, 0x21, 0x08, 0xaa, 0xcc,
+	0xdb, 0xba, 0x81, 0x43, 0x42, 0x23, 0x45, 0x22, 0x0a, 0xec, 0xbb, 0xa9, 0x00, 0x23, 0x45, 0x43,
+	0x10, 0xae, 0xcb, 0xb9, 0x82, 0x34, 0x22, 0x11, 0x22, 0x33, 0x09, 0xfc, 0xcb, 0x98, 0x02, 0x21,
+	0x18, 0x80, 0x03, 0x44, 0x21, 0x08, 0xaa, 0xcc, 0xdb, 0xba, 0x81, 0x35, 0x33, 0x33, 0x44, 0x42,
+	0x09, 0xec, 0xca, 0xa8, 0x02, 0x22, 0x08, 0x88, 0x14, 0x43, 0x0a, 0xed, 0xba, 0x04, 0x43, 0x30,
+	0xbc, 0xca, 0x82, 0x22, 0x8c, 0xcb, 0xa2, 0x64, 0x31, 0x08, 0xa9, 0x81, 0x10, 0x9c, 0xcb, 0xb8,
+	0x81, 0x18, 0xab, 0xa1, 0x56, 0x43, 0x31, 0x88, 0x99, 0xac, 0xcb, 0xc9, 0x03, 0x63, 0x31, 0x9b,
+	0xeb, 0x99, 0x00, 0x08, 0x99, 0x80, 0x25, 0x42, 0x10, 0x88, 0x03, 0x54, 0x21, 0xad, 0xeb, 0xca,
+	0x98, 0x13, 0x35, 0x33, 0x32, 0x09, 0xab, 0xbb, 0xbb, 0xcd, 0xbb, 0xa1, 0x65, 0x34, 0x18, 0x9b,
+	0xa8, 0x24, 0x41, 0x8c, 0xdc, 0xb9, 0x81, 0x42, 0x32, 0x20, 0x12, 0x08, 0xae, 0xcb, 0xb9, 0x81,
+	0x10, 0x08, 0x80, 0x44, 0x53, 0x22, 0x19, 0xad, 0xcb, 0xb9, 0x81, 0x43, 0x31, 0x09, 0x98, 0x80,
+	0x00, 0x88, 0x02, 0x10, 0xdf, 0xdb, 0xba, 0x80, 0x34, 0x44, 0x34, 0x33, 0x18, 0xbe, 0xcb, 0xb9,
+	0x91, 0x35, 0x33, 0x42, 0x10, 0x08, 0x99, 0xcd, 0xcb, 0xbb, 0x03, 0x74, 0x33, 0x19, 0xcc, 0xca,
+	0x80, 0x12, 0x21, 0x88, 0x80, 0x34, 0x52, 0x19, 0xbe, 0xca, 0xb9, 0x80, 0x23, 0x33, 0x10, 0x88,
+	0x03, 0x64, 0x31, 0xae, 0xcc, 0xa9, 0x14, 0x34, 0x10, 0x9b, 0xb9, 0x80, 0x21, 0x08, 0xa9, 0x80,
+	0x22, 0x09, 0xaa, 0x91, 0x34, 0x19, 0xcc, 0x91, 0x45, 0x29, 0xdf, 0xbb, 0x90, 0x44, 0x41, 0x19,
+	0xaa, 0xa1, 0x45, 0x32, 0x19, 0xbd, 0xca, 0xba, 0xa0, 0x16, 0x44, 0x30, 0x8c, 0xcb, 0xa0, 0x13,
+	0x32, 0x09, 0x90, 0x37, 0x22, 0x9c, 0xeb, 0xa9, 0x23, 0x53, 0x11, 0x88, 0x80, 0x10, 0xae, 0xcc,
+	0xa9, 0x13, 0x43, 0x09, 0xbc, 0x91, 0x46, 0x32, 0x09, 0xcb, 0xb9, 0x00, 0x00, 0x88, 0x13, 0x62,
+	0x19, 0xcb, 0xa0, 0x36, 0x20, 0x9d, 0xba, 0x91, 0x35, 0x22, 0x08, 0x08, 0x08, 0xbe, 0xdb, 0xc9,
+	0x13, 0x53, 0x31, 0x09, 0x98, 0x81, 0x09, 0xcd, 0xbb, 0x91, 0x44, 0x32, 0x18, 0x80, 0x02, 0x18,
+	0xcd, 0xda, 0x98, 0x00, 0x99, 0xa0, 0x47, 0x63, 0x11, 0x9b, 0xcb, 0xa9, 0x80, 0x08, 0x80, 0x36,
+	0x44, 0x30, 0x8b, 0xdc, 0xaa, 0x00, 0x11, 0x08, 0x9a, 0x80, 0x25, 0x42, 0x22, 0x08, 0xac, 0xbd,
+	0xbc, 0xbb, 0x98, 0x26, 0x54, 0x33, 0x10, 0x9b, 0xda, 0xaa, 0x80, 0x08, 0x88, 0x88, 0x14, 0x53,
+	0x33, 0x08, 0xcc, 0xca, 0xa9, 0x00, 0x01, 0x08, 0x99, 0x80, 0x21, 0x18, 0xbc, 0xa0, 0x67, 0x43,
+	0x42, 0x09, 0xac, 0xcb, 0xaa, 0x81, 0x12, 0x18, 0xbd, 0x90, 0x55, 0x42, 0x19, 0xbd, 0xb9, 0x80,
+	0x21, 0x08, 0x9a, 0x80, 0x22, 0x18, 0xcb, 0xa0, 0x66, 0x44, 0x22, 0x09, 0xac, 0xbc, 0xbb, 0x80,
+	0x44, 0x43, 0x18, 0xbe, 0xbb, 0x91, 0x44, 0x32, 0x0a, 0xcb, 0xa8, 0x36, 0x42, 0x09, 0xac, 0xba,
+	0x80, 0x00, 0x9a, 0xa0, 0x55, 0x42, 0x0a, 0xbc, 0xa0, 0x35, 0x33, 0x09, 0xac, 0xbc, 0xba, 0x80,
+	0x44, 0x42, 0x1a, 0xcb, 0xa8, 0x44, 0x42, 0x09, 0xac, 0xab, 0x99, 0x80, 0x13, 0x63, 0x42, 0x09,
+	0xad, 0xbb, 0x99, 0x00, 0x08, 0x88, 0x15, 0x54, 0x41, 0x08, 0xaa, 0x90, 0x43, 0x28, 0xfd, 0xca,
+	0xa8, 0x13, 0x43, 0x21, 0x00, 0x08, 0x80, 0x88, 0x01, 0x10, 0xbf, 0xdb, 0xa0, 0x26, 0x42, 0x19,
+	0xbd, 0xb9, 0x03, 0x42, 0x0a, 0xbc, 0xa1, 0x35, 0x31, 0x09, 0x98, 0x81, 0x8b, 0xec, 0xc9, 0x80,
+	0x21, 0x08, 0xa0, 0x37, 0x73, 0x20, 0x8a, 0xba, 0x90, 0x10, 0xad, 0xca, 0x92, 0x43, 0x28, 0xcd,
+	0xa8, 0x24, 0x42, 0x08, 0xba, 0x91, 0x34, 0x29, 0xdd, 0xb9, 0x03, 0x42, 0x0a, 0xcb, 0x91, 0x43,
+	0x31, 0x89, 0x04, 0x44, 0x28, 0xcb, 0xc9, 0x81, 0x08, 0xcd, 0xa9, 0x15, 0x44, 0x20, 0x8a, 0xaa,
+	0x90, 0x00, 0xab, 0xeb, 0x91, 0x35, 0x32, 0x09, 0xaa, 0x80, 0x32, 0x18, 0xcb, 0xa1, 0x54, 0x29,
+	0xde, 0xba, 0x82, 0x43, 0x21, 0x89, 0x00, 0x28, 0xbf, 0xda, 0x91, 0x35, 0x21, 0x88, 0x90, 0x10,
+	0xac, 0xeb, 0x90, 0x36, 0x22, 0x09, 0xa9, 0x81, 0x11, 0x08, 0x9a, 0x00, 0x21, 0x19, 0xaa, 0x91,
+	0x34, 0x18, 0xdb, 0x91, 0x54, 0x18, 0xdc, 0x90, 0x54, 0x29, 0xde, 0xc9, 0x81, 0x42, 0x29, 0xbd,
+	0xa8, 0x25, 0x33, 0x09, 0xbd, 0xaa, 0x90, 0x80, 0x88, 0x80, 0x02, 0x08, 0xac, 0xa1, 0x57, 0x33,
+	0x31, 0x88, 0x90, 0x10, 0xae, 0xdc, 0xaa, 0x00, 0x11, 0x09, 0x82, 0x57, 0x33, 0x19, 0xcd, 0xaa,
+	0x02, 0x42, 0x19, 0xcb, 0xa0, 0x35, 0x41, 0x19, 0xab, 0xca, 0xaa, 0x80, 0x34, 0x53, 0x18, 0xbd,
+	0xca, 0x91, 0x34, 0x42, 0x09, 0xbc, 0xba, 0x81, 0x22, 0x08, 0xbc, 0xa1, 0x56, 0x32, 0x19, 0xcc,
+	0xaa, 0x00, 0x11, 0x08, 0x99, 0x80, 0x11, 0x08, 0x99, 0x80, 0x11, 0x19, 0x99, 0x80, 0x21, 0x08,
+	0x99, 0x00, 0x10, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x08, 0x90, 0x11, 0x18, 0xaa, 0x80, 0x14, 0x19, 0xad, 0x90, 0x44, 0x29, 0xdc, 0x90, 0x54, 0x29,
+	0xdd, 0xa1, 0x56, 0x32, 0x0a, 0xda, 0x91, 0x34, 0x38, 0xbd, 0xca, 0x81, 0x23, 0x42, 0x21, 0x18,
+	0xbc, 0xda, 0xb8, 0x81, 0x08, 0x88, 0x15, 0x63, 0x20, 0xae, 0xcb, 0x80, 0x44, 0x21, 0x8a, 0xca,
+	0x82, 0x42, 0x19, 0xbd, 0x98, 0x34, 0x32, 0x09, 0x99, 0x81, 0x0a, 0xed, 0xba, 0x91, 0x35, 0x32,
+	0x21, 0x08, 0x9c, 0xcc, 0xbb, 0x80, 0x44, 0x33, 0x21, 0x88, 0x80, 0x10, 0xae, 0xdc, 0xaa, 0x91,
+	0x34, 0x43, 0x22, 0x09, 0xaa, 0x91, 0x35, 0x29, 0xde, 0xbb, 0x82, 0x43, 0x32, 0x89, 0x80, 0x10,
+	0xaf, 0xcb, 0xb9, 0x00, 0x18, 0x98, 0x26, 0x53, 0x31, 0x09, 0x88, 0x00, 0x9d, 0xdc, 0xba, 0x81,
+	0x11, 0x08, 0x91, 0x66, 0x42, 0x19, 0xbe, 0xa9, 0x02, 0x42, 0x0a, 0xca, 0x91, 0x34, 0x28, 0xbd,
+	0xb9, 0x35, 0x42, 0x19, 0xbd, 0xa9, 0x81, 0x33, 0x41, 0x19, 0xac, 0xca, 0xaa, 0x81, 0x14, 0x43,
+	0x42, 0x19, 0xbe, 0xba, 0x91, 0x44, 0x22, 0x09, 0x9a, 0x80, 0x22, 0x08, 0xac, 0x91, 0x43, 0x28,
+	0xfd, 0xca, 0x91, 0x34, 0x42, 0x09, 0xaa, 0x80, 0x34, 0x19, 0xce, 0xba, 0x91, 0x44, 0x22, 0x09,
+	0x9a, 0x81, 0x12, 0x19, 0xbe, 0xdb, 0xca, 0x91, 0x35, 0x42, 0x10, 0x88, 0x01, 0x00, 0xbe, 0xcb,
+	0xa9, 0x00, 0x09, 0x98, 0x37, 0x53, 0x19, 0xbd, 0xb9, 0x81, 0x10, 0x09, 0x02, 0x64, 0x42, 0x19,
+	0xbc, 0xca, 0x98, 0x00, 0x88, 0x80, 0x11, 0x18, 0xbc, 0xa0, 0x75, 0x42, 0x19, 0xbd, 0xb9, 0x80,
+	0x21, 0x08, 0x9a, 0x81, 0x11, 0x08, 0xa9, 0x00, 0x11, 0x08, 0x99, 0x91, 0x12, 0x08, 0x99, 0x80,
+	0x01, 0x00, 0x88, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x89, 0x80, 0x10, 0x00, 0x89, 0x90, 0x12, 0x18, 0xab, 0x90,
+	0x43, 0x29, 0xdc, 0x90, 0x53, 0x28, 0xfc, 0xa1, 0x57, 0x42, 0x18, 0xbd, 0xba, 0x80, 0x32, 0x19,
+	0xa0,
+};
+
+static const unsigned char sndbank_door[4097] = {
+	0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x00, 0x88, 0x80,
+	0x00, 0x08, 0x99, 0x90, 0x22, 0x19, 0xaa, 0xa0, 0x44, 0x19, 0xcc, 0xa1, 0x55, 0x28, 0xef, 0xbc,
+	0xa9, 0x80, 0x10, 0x08, 0x88, 0x00, 0x89, 0x98, 0x35, 0x28, 0xef, 0xca, 0xa9, 0x81, 0x08, 0x80,
+	0x02, 0x10, 0xde, 0xda, 0xa8, 0x10, 0x9a, 0xeb, 0xaa, 0x00, 0x10, 0x09, 0x01, 0x10, 0xce, 0xdb,
+	0xb9, 0x00, 0x10, 0x88, 0x01, 0x28, 0xcf, 0xdb, 0xa8, 0x81, 0x8a, 0xdc, 0xc9, 0x91, 0x22, 0x19,
+	0xbe, 0xbb, 0xb9, 0x00, 0x11, 0x88, 0x98, 0x90, 0x22, 0x19, 0xbc, 0x91, 0x46, 0x18, 0xde, 0xda,
+	0xb9, 0x00, 0x10, 0x08, 0x89, 0x00, 0x00, 0x88, 0x00, 0x08, 0x8a, 0xa0, 0x44, 0x29, 0xde, 0xa0,
+	0x66, 0x43, 0x21, 0x08, 0x98, 0x00, 0x88, 0x88, 0x12, 0x28, 0xdc, 0xb1, 0x67, 0x33, 0x28, 0x98,
+	0x24, 0x62, 0x20, 0x89, 0x13, 0x63, 0x20, 0x88, 0x03, 0x64, 0x20, 0x88, 0x82, 0x54, 0x21, 0x09,
+	0x80, 0x37, 0x34, 0x21, 0x12, 0x23, 0x53, 0x33, 0x10, 0x88, 0x02, 0x55, 0x43, 0x32, 0x00, 0x88,
+	0x03, 0x54, 0x42, 0x32, 0x33, 0x43, 0x42, 0x33, 0x53, 0x33, 0x21, 0x89, 0x02, 0x64, 0x43, 0x33,
+	0x12, 0x35, 0x44, 0x22, 0x08, 0x80, 0x03, 0x44, 0x33, 0x34, 0x35, 0x32, 0x10, 0x89, 0x14, 0x44,
+	0x21, 0x88, 0x81, 0x54, 0x33, 0x09, 0xbb, 0x91, 0x54, 0x42, 0x20, 0x09, 0x00, 0x80, 0x8a, 0x90,
+	0x37, 0x63, 0x22, 0x09, 0x99, 0x80, 0x11, 0x08, 0x99, 0x80, 0x11, 0x00, 0xa9, 0x90, 0x22, 0x29,
+	0xab, 0x90, 0x42, 0x29, 0xcc, 0xa1, 0x55, 0x28, 0xef, 0xcc, 0xa9, 0x80, 0x21, 0x18, 0xbe, 0xcb,
+	0xb9, 0x91, 0x23, 0x19, 0xce, 0xca, 0xa9, 0x00, 0x09, 0xdc, 0xda, 0xba, 0x88, 0x08, 0x89, 0xcd,
+	0xcb, 0xba, 0x88, 0x00, 0x8b, 0xdc, 0xca, 0xba, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbc, 0xbc, 0xba,
+	0xca, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xcb, 0xbb, 0xca, 0xbc, 0xcb, 0xbb, 0xab, 0xbd, 0xcd, 0xcb,
+	0xba, 0xa9, 0xaa, 0xac, 0xab, 0xbc, 0xac, 0xab, 0xba, 0xcb, 0xcc, 0xba, 0x98, 0x00, 0x8b, 0xdc,
+	0xbc, 0xab, 0xbc, 0xbb, 0xa9, 0x01, 0x8a, 0xec, 0xcb, 0xbb, 0x99, 0x80, 0x12, 0x18, 0xcd, 0xdb,
+	0xa8, 0x81, 0x00, 0x88, 0x01, 0x10, 0xce, 0xdb, 0xb9, 0x80, 0x21, 0x09, 0x98, 0x80, 0x01, 0x88,
+	0x80, 0x00, 0x8a, 0x91, 0x26, 0x29, 0xdc, 0xb0, 0x77, 0x34, 0x22, 0x88, 0x99, 0x00, 0x00, 0x08,
+	0x81, 0x08, 0x9b, 0xb0, 0x77, 0x53, 0x32, 0x08, 0xab, 0x80, 0x44, 0x54, 0x22, 0x09, 0xaa, 0xa1,
+	0x54, 0x43, 0x18, 0x88, 0x14, 0x44, 0x21, 0x89, 0x00, 0x54, 0x43, 0x22, 0x20, 0x08, 0x99, 0x90,
+	0x36, 0x44, 0x21, 0x88, 0x91, 0x37, 0x43, 0x32, 0x08, 0x90, 0x14, 0x43, 0x22, 0x89, 0x80, 0x55,
+	0x53, 0x21, 0x08, 0x80, 0x13, 0x53, 0x30, 0x09, 0x82, 0x46, 0x43, 0x32, 0x10, 0x88, 0x02, 0x54,
+	0x43, 0x33, 0x10, 0x88, 0x02, 0x46, 0x43, 0x32, 0x18, 0x88, 0x12, 0x54, 0x43, 0x32, 0x22, 0x35,
+	0x43, 0x32, 0x20, 0x98, 0x12, 0x64, 0x33, 0x42, 0x22, 0x43, 0x34, 0x33, 0x33, 0x44, 0x33, 0x42,
+	0x33, 0x35, 0x34, 0x32, 0x21, 0x88, 0x81, 0x46, 0x53, 0x21, 0x08, 0x88, 0x24, 0x43, 0x10, 0x98,
+	0x13, 0x64, 0x20, 0x09, 0x80, 0x00, 0x9c, 0xdc, 0xaa, 0x00, 0x11, 0x09, 0x80, 0x00, 0x9d, 0xec,
+	0xcb, 0xab, 0xab, 0xbd, 0xbb, 0xcb, 0xac, 0xab, 0xcb, 0xbb, 0xcb, 0xca, 0xbc, 0xab, 0xcb, 0xbc,
+	0xaa, 0xbc, 0xcc, 0xcc, 0xbc, 0xba, 0xba, 0xa9, 0xa9, 0xac, 0xbe, 0xbc, 0xba, 0xa9, 0x89, 0xab,
+	0xdd, 0xbb, 0xba, 0xaa, 0xaa, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xbd, 0xcc, 0xaa, 0x98, 0x00,
+	0x8b, 0xcd, 0xba, 0xbb, 0xdb, 0xbb, 0xa8, 0x01, 0x9c, 0xeb, 0xa9, 0x81, 0x09, 0xce, 0xbd, 0xa9,
+	0x88, 0x08, 0x0a, 0xae, 0xcb, 0xaa, 0x80, 0x00, 0xac, 0xcb, 0xa8, 0x00, 0x8b, 0xfb, 0xb9, 0x81,
+	0x11, 0x88, 0x88, 0x01, 0xad, 0xfc, 0xba, 0x91, 0x35, 0x33, 0x21, 0x08, 0x98, 0x80, 0x01, 0x00,
+	0xaa, 0xa0, 0x66, 0x54, 0x34, 0x32, 0x32, 0x43, 0x44, 0x22, 0x22, 0x25, 0x44, 0x43, 0x22, 0x21,
+	0x33, 0x64, 0x32, 0x21, 0x00, 0x04, 0x45, 0x43, 0x33, 0x23, 0x24, 0x33, 0x33, 0x12, 0x23, 0x64,
+	0x43, 0x33, 0x11, 0x21, 0x43, 0x53, 0x33, 0x43, 0x43, 0x42, 0x21, 0x12, 0x25, 0x34, 0x31, 0x09,
+	0x99, 0x91, 0x23, 0x43, 0x34, 0x33, 0x53, 0x33, 0x21, 0x08, 0xa9, 0x80, 0x23, 0x29, 0xdf, 0xcb,
+	0xb9, 0x81, 0x11, 0x08, 0xa9, 0x80, 0x22, 0x18, 0xcb, 0xb1, 0x65, 0x28, 0xee, 0xdc, 0xba, 0xa9,
+	0x80, 0x08, 0x80, 0x80, 0x00, 0x80, 0x98, 0x80, 0x02, 0x10, 0xcf, 0xdc, 0xca, 0xba, 0xbb, 0xcb,
+	0xca, 0x91, 0x36, 0x32, 0x10, 0x88, 0x02, 0x18, 0xcd, 0xda, 0x98, 0x00, 0x9b, 0xdc, 0xa8, 0x00,
+	0x8a, 0xdc, 0xb9, 0x81, 0x11, 0x88, 0x80, 0x00, 0x9f, 0xcc, 0xbb, 0xbc, 0xcc, 0xdb, 0xbb, 0xa9,
+	0x98, 0x80, 0x12, 0x44, 0x33, 0x19, 0xcc, 0xbb, 0xab, 0xbd, 0xcd, 0xcb, 0xba, 0xaa, 0x98, 0x80,
+	0x11, 0x18, 0xbe, 0xca, 0xa9, 0x00, 0x08, 0x88, 0x13, 0x39, 0xee, 0xca, 0x91, 0x35, 0x23, 0x23,
+	0x44, 0x32, 0x10, 0x15, 0x65, 0x42, 0x10, 0xac, 0xaa, 0x81, 0x10, 0x9b, 0xc0, 0x77, 0x43, 0x20,
+	0xac, 0xca, 0x01, 0x23, 0x0a, 0xdc, 0x98, 0x34, 0x42, 0x08, 0x98, 0x13, 0x42, 0x8c, 0xdc, 0x98,
+	0x35, 0x34, 0x18, 0xab, 0xb9, 0x81, 0x18, 0x9c, 0xab, 0x02, 0x44, 0x22, 0x88, 0x99, 0x81, 0x11,
+	0x20, 0x08, 0x9a, 0xac, 0xac, 0xab, 0x99, 0x80, 0x18, 0xbf, 0xeb, 0xcb, 0x98, 0x13, 0x44, 0x33,
+	0x32, 0x08, 0xbd, 0xcb, 0xcb, 0xdb, 0xdb, 0xa9, 0x82, 0x24, 0x21, 0x88, 0x81, 0x45, 0x32, 0x8b,
+	0xfb, 0xbb, 0x98, 0x8a, 0xbe, 0xbc, 0x99, 0x00, 0x09, 0x9b, 0x90, 0x24, 0x32, 0x09, 0xaa, 0x81,
+	0x21, 0x08, 0xa9, 0x81, 0x0a, 0xff, 0xdc, 0xbb, 0xbb, 0xaa, 0x98, 0x80, 0x10, 0x08, 0x99, 0x80,
+	0x23, 0x28, 0xee, 0xcc, 0xaa, 0xbb, 0xdd, 0xcb, 0xba, 0xaa, 0x89, 0x88, 0x25, 0x54, 0x42, 0x21,
+	0x9a, 0xcb, 0xcb, 0xa9, 0x08, 0x9c, 0xcc, 0xca, 0x90, 0x12, 0x31, 0x08, 0xab, 0xbc, 0xbd, 0xba,
+	0x90, 0x35, 0x43, 0x32, 0x10, 0x00, 0x9b, 0xcd, 0xcb, 0xc9, 0x90, 0x24, 0x53, 0x43, 0x43, 0x33,
+	0x42, 0x22, 0x08, 0x80, 0x00, 0x18, 0xaa, 0x90, 0x55, 0x43, 0x18, 0x98, 0x27, 0x74, 0x32, 0x10,
+	0x89, 0x80, 0x13, 0x32, 0x09, 0x88, 0x25, 0x43, 0x09, 0xcc, 0x98, 0x24, 0x43, 0x22, 0x12, 0x34,
+	0x33, 0x34, 0x36, 0x43, 0x42, 0x19, 0xbd, 0xbb, 0xa9, 0x80, 0x11, 0x24, 0x54, 0x34, 0x21, 0x08,
+	0x9a, 0xba, 0xcb, 0xbb, 0xaa, 0xbd, 0xdd, 0xbc, 0x98, 0x35, 0x44, 0x32, 0x21, 0x01, 0x11, 0x22,
+	0x21, 0x09, 0x99, 0x91, 0x21, 0x9f, 0xfe, 0xbc, 0xaa, 0x88, 0x00, 0x02, 0x13, 0x21, 0x09, 0xac,
+	0xa9, 0x81, 0x00, 0x88, 0x04, 0x54, 0x21, 0x9e, 0xcc, 0xbb, 0xa8, 0x80, 0x11, 0x23, 0x63, 0x53,
+	0x33, 0x21, 0x10, 0x08, 0x9a, 0xbe, 0xbd, 0xcb, 0xcc, 0xcb, 0xbb, 0xa8, 0x03, 0x44, 0x22, 0x21,
+	0x11, 0x23, 0x32, 0x18, 0xcd, 0xcd, 0xbc, 0xbd, 0xbb, 0xbc, 0xa9, 0x91, 0x22, 0x31, 0x88, 0x90,
+	0x25, 0x42, 0x8b, 0xec, 0xa9, 0x00, 0x19, 0xbf, 0xbd, 0xab, 0xaa, 0xba, 0xa9, 0x13, 0x54, 0x33,
+	0x08, 0x88, 0x23, 0x63, 0x32, 0x09, 0x9b, 0xab, 0xcb, 0x90, 0x65, 0x53, 0x32, 0x08, 0xaa, 0x90,
+	0x43, 0x53, 0x32, 0x43, 0x44, 0x32, 0x11, 0x80, 0x98, 0x9b, 0xfc, 0xcb, 0xba, 0x99, 0x88, 0xab,
+	0xa8, 0x37, 0x73, 0x42, 0x21, 0x11, 0x23, 0x33, 0x08, 0xaa, 0xa9, 0x01, 0x89, 0xa0, 0x47, 0x44,
+	0x10, 0x9b, 0xa9, 0x14, 0x43, 0x08, 0xcc, 0xbb, 0xba, 0x9a, 0xbb, 0xca, 0xa8, 0x80, 0x10, 0x88,
+	0x02, 0x66, 0x34, 0x32, 0x08, 0x88, 0x16, 0x45, 0x33, 0x08, 0xcc, 0xbb, 0x90, 0x23, 0x20, 0xad,
+	0xcb, 0xa9, 0x88, 0x08, 0x80, 0x88, 0x10, 0x00, 0xad, 0xdd, 0xbb, 0x81, 0x35, 0x29, 0xdf, 0xbc,
+	0xba, 0x98, 0x89, 0xaa, 0xa9, 0x81, 0x10, 0x08, 0x9a, 0xce, 0xcc, 0xcb, 0xab, 0x9a, 0xaa, 0xca,
+	0x99, 0x00, 0x08, 0x90, 0x15, 0x44, 0x32, 0x09, 0xab, 0xcd, 0xcb, 0xbb, 0x88, 0x18, 0x9c, 0xdb,
+	0xb9, 0x00, 0x18, 0x80, 0x01, 0x20, 0xdf, 0xcb, 0x90, 0x36, 0x32, 0x09, 0xaa, 0x91, 0x33, 0x18,
+	0xec, 0xcb, 0x90, 0x36, 0x33, 0x33, 0x12, 0x25, 0x53, 0x53, 0x32, 0x22, 0x10, 0x08, 0x9a, 0xcc,
+	0xbb, 0x91, 0x46, 0x43, 0x42, 0x21, 0x01, 0x13, 0x54, 0x42, 0x21, 0x08, 0x99, 0x80, 0x11, 0x19,
+	0x9a, 0x91, 0x35, 0x18, 0xde, 0xbb, 0x81, 0x44, 0x21, 0x09, 0x80, 0x37, 0x35, 0x34, 0x32, 0x31,
+	0x89, 0xca, 0x90, 0x47, 0x43, 0x33, 0x31, 0x88, 0x99, 0x90, 0x35, 0x44, 0x21, 0x08, 0xa9, 0x80,
+	0x24, 0x33, 0x10, 0x88, 0x02, 0x64, 0x34, 0x32, 0x11, 0x08, 0x9b, 0xdc, 0xcc, 0xbd, 0xbc, 0xba,
+	0xba, 0x9a, 0xaa, 0xbb, 0xbc, 0xbb, 0xcc, 0xab, 0xba, 0xad, 0xcd, 0xdb, 0xdb, 0xcb, 0xbb, 0xda,
+	0xba, 0xa9, 0x99, 0x8a, 0xaa, 0xaa, 0x88, 0x18, 0x9b, 0xea, 0xa0, 0x35, 0x33, 0x19, 0xca, 0x90,
+	0x54, 0x32, 0x89, 0xcb, 0xa8, 0x35, 0x53, 0x21, 0x18, 0x08, 0x08, 0x88, 0x03, 0x56, 0x34, 0x22,
+	0x11, 0x24, 0x54, 0x42, 0x22, 0x11, 0x34, 0x44, 0x21, 0x08, 0xa8, 0x91, 0x11, 0x18, 0xbd, 0xca,
+	0xa0, 0x26, 0x43, 0x31, 0x8a, 0xcb, 0x92, 0x56, 0x42, 0x20, 0x99, 0x80, 0x24, 0x31, 0x9c, 0xdb,
+	0x99, 0x10, 0x9b, 0xec, 0xa0, 0x25, 0x42, 0x28, 0x8a, 0x80, 0x25, 0x33, 0x20, 0x88, 0x02, 0x55,
+	0x42, 0x32, 0x22, 0x34, 0x43, 0x33, 0x33, 0x43, 0x53, 0x42, 0x11, 0x11, 0x34, 0x43, 0x31, 0x21,
+	0x36, 0x44, 0x42, 0x21, 0x10, 0x88, 0x01, 0x36, 0x34, 0x20, 0x9c, 0xda, 0xa9, 0x00, 0x08, 0xbd,
+	0xbc, 0xb9, 0x99, 0x9a, 0xab, 0xab, 0x9b, 0xad, 0xbc, 0xaa, 0xab, 0xed, 0xcb, 0xba, 0x91, 0x32,
+	0x19, 0xbc, 0xa0, 0x25, 0x32, 0x09, 0xa9, 0x81, 0x18, 0xbf, 0xfb, 0xbb, 0xb9, 0x00, 0x11, 0x18,
+	0xbc, 0xcb, 0xa9, 0x01, 0x8a, 0xdd, 0xca, 0xba, 0xaa, 0xad, 0xbc, 0xab, 0x9a, 0xad, 0xcb, 0xba,
+	0x82, 0x43, 0x31, 0x89, 0x02, 0x55, 0x34, 0x22, 0x32, 0x43, 0x31, 0x19, 0xaa, 0x91, 0x36, 0x53,
+	0x32, 0x19, 0xbe, 0xbb, 0xb9, 0x00, 0x10, 0x08, 0x80, 0x00, 0x9f, 0xdd, 0xbc, 0xba, 0x9a, 0xbc,
+	0xdb, 0xab, 0x88, 0x00, 0x9b, 0xdc, 0xba, 0x80, 0x34, 0x35, 0x33, 0x42, 0x33, 0x43, 0x44, 0x23,
+	0x10, 0x88, 0x01, 0x54, 0x53, 0x44, 0x33, 0x21, 0x0a, 0xbb, 0xb9, 0x00, 0x10, 0x88, 0x00, 0x18,
+	0xac, 0xa0, 0x67, 0x42, 0x10, 0x88, 0x04, 0x43, 0x31, 0x88, 0x90, 0x00, 0x9b, 0xb0, 0x77, 0x54,
+	0x21, 0x88, 0x99, 0x00, 0x10, 0x08, 0x98, 0x80, 0x09, 0xed, 0xcc, 0xa9, 0x80, 0x18, 0xac, 0xec,
+	0xbb, 0xbb, 0xcb, 0xcb, 0xab, 0x9a, 0x9a, 0xbb, 0xcb, 0xbb, 0xcc, 0xdc, 0xcb, 0xba, 0xa9, 0xa9,
+	0xbc, 0xba, 0x81, 0x35, 0x31, 0x19, 0xac, 0xbc, 0xaa, 0x91, 0x24, 0x18, 0xdd, 0xba, 0x83, 0x43,
+	0x10, 0x98, 0x26, 0x63, 0x41, 0x09, 0x99, 0x00, 0x10, 0x88, 0x81, 0x45, 0x43, 0x31, 0x22, 0x25,
+	0x35, 0x22, 0x00, 0x88, 0x02, 0x44, 0x44, 0x35, 0x34, 0x33, 0x20, 0x88, 0x00, 0x33, 0x62, 0x31,
+	0x20, 0x08, 0x99, 0x90, 0x37, 0x34, 0x10, 0x88, 0x03, 0x54, 0x22, 0x09, 0x9a, 0x81, 0x11, 0x19,
+	0x99, 0x81, 0x0a, 0xff, 0xfc, 0xab, 0xa8, 0x80, 0x10, 0x08, 0x98, 0x90, 0x24, 0x44, 0x32, 0x19,
+	0xbd, 0xca, 0xa8, 0x80, 0x00, 0x88, 0x13, 0x74, 0x43, 0x32, 0x21, 0x08, 0x9a, 0x90, 0x44, 0x63,
+	0x21, 0x08, 0xa9, 0x90, 0x36, 0x43, 0x42, 0x19, 0xbd, 0xca, 0x90, 0x35, 0x33, 0x09, 0xbc, 0xca,
+	0xaa, 0xad, 0xbd, 0xaa, 0x80, 0x00, 0xad, 0xdc, 0xbb, 0xa9, 0x89, 0xab, 0xdc, 0xcb, 0xbb, 0xcb,
+	0xcb, 0xbb, 0xca, 0x9a, 0x98, 0x80, 0x01, 0x18, 0xad, 0xcb, 0xaa, 0x81, 0x11, 0x08, 0x99, 0x90,
+	0x22, 0x19, 0xbc, 0xa0, 0x67, 0x44, 0x34, 0x32, 0x22, 0x09, 0x9a, 0x90, 0x45, 0x53, 0x20, 0x09,
+	0x81, 0x37, 0x54, 0x33, 0x32, 0x22, 0x22, 0x24, 0x43, 0x32, 0x20, 0x09, 0x80, 0x00, 0x9c, 0xec,
+	0xca, 0x80, 0x33, 0x29, 0xde, 0xaa, 0x02, 0x43, 0x0b, 0xec, 0xba, 0xa9, 0x8a, 0xab, 0xb9, 0x00,
+	0x19, 0xce, 0xca, 0x81, 0x23, 0x29, 0xde, 0xbc, 0x99, 0x00, 0x00, 0x88, 0x00, 0x00, 0x9c, 0xdb,
+	0xa0, 0x26, 0x43, 0x21, 0x00, 0x08, 0x80, 0x08, 0x08, 0x00, 0x98, 0x90, 0x27, 0x55, 0x34, 0x32,
+	0x11, 0x88, 0x88, 0x80, 0x00, 0x08, 0x89, 0x80, 0x11, 0x18, 0xbb, 0xa1, 0x64, 0x38, 0xfe, 0xdb,
+	0xba, 0x81, 0x21, 0x19, 0xab, 0x91, 0x45, 0x18, 0xdd, 0xca, 0xa8, 0x00, 0x8a, 0xdc, 0xcb, 0xab,
+	0xac, 0xbb, 0xba, 0x81, 0x22, 0x19, 0xbb, 0x91, 0x54, 0x18, 0xde, 0xbc, 0x98, 0x00, 0x8a, 0xcd,
+	0xbc, 0xaa, 0xac, 0xab, 0xb9, 0x81, 0x11, 0x08, 0xa8, 0x91, 0x11, 0x19, 0xa9, 0x91, 0x23, 0x29,
+	0xdc, 0x91, 0x45, 0x20, 0xfe, 0xcc, 0xa9, 0x80, 0x21, 0x08, 0xaa, 0x91, 0x35, 0x29, 0xde, 0xbc,
+	0x98, 0x00, 0x8a, 0xdc, 0xbb, 0xac, 0xbb, 0xcb, 0xa8, 0x01, 0x9b, 0xec, 0xb9, 0x80, 0x22, 0x19,
+	0xbd, 0xcc, 0xbb, 0xcb, 0xa9, 0x91, 0x21, 0x19, 0xac, 0x90, 0x55, 0x43, 0x21, 0x89, 0x02, 0x55,
+	0x42, 0x32, 0x22, 0x34, 0x43, 0x23, 0x34, 0x33, 0x52, 0x33, 0x34, 0x33, 0x44, 0x23, 0x33, 0x35,
+	0x33, 0x42, 0x33, 0x43, 0x43, 0x42, 0x20, 0x08, 0x98, 0x80, 0x10, 0x08, 0x89, 0x80, 0x10, 0x08,
+	0x90, 0x01, 0xaf, 0xff, 0xfb, 0x9a, 0x00, 0x08, 0x9b, 0xcb, 0xa8, 0x10, 0x9c, 0xdb, 0xb9, 0x01,
+	0x8a, 0xec, 0xbb, 0xbb, 0xcc, 0xba, 0xa8, 0x00, 0x8b, 0xfb, 0xb9, 0x81, 0x11, 0x09, 0x89, 0x00,
+	0x08, 0x88, 0x02, 0x28, 0xdc, 0xb0, 0x77, 0x34, 0x11, 0x89, 0x02, 0x45, 0x34, 0x22, 0x33, 0x42,
+	0x31, 0x88, 0x91, 0x55, 0x44, 0x21, 0x08, 0x80, 0x03, 0x44, 0x22, 0x88, 0x9a, 0x81, 0x12, 0x08,
+	0xbb, 0xb1, 0x75, 0x53, 0x21, 0x88, 0x99, 0x00, 0x01, 0x08, 0x99, 0x00, 0x11, 0x08, 0xaa, 0x90,
+	0x42, 0x18, 0xdb, 0xa1, 0x63, 0x3a, 0xed, 0xa1, 0x57, 0x43, 0x11, 0x88, 0x82, 0x46, 0x34, 0x21,
+	0x22, 0x33, 0x54, 0x22, 0x11, 0x88, 0x89, 0x80, 0x14, 0x54, 0x43, 0x32, 0x20, 0x08, 0x90, 0x80,
+	0x08, 0x80, 0x80, 0x00, 0x99, 0x90, 0x35, 0x38, 0xff, 0xcc, 0xbc, 0xab, 0xbb, 0xda, 0xa9, 0x80,
+	0x12, 0x08, 0xbd, 0xdb, 0xca, 0x80, 0x33, 0x18, 0xec, 0xca, 0x82, 0x34, 0x20, 0xbe, 0xba, 0x91,
+	0x35, 0x22, 0x10, 0x88, 0x01, 0x08, 0x9a, 0xa0, 0x56, 0x42, 0x21, 0x89, 0x02, 0x46, 0x33, 0x33,
+	0x23, 0x44, 0x34, 0x23, 0x33, 0x35, 0x33, 0x42, 0x33, 0x43, 0x43, 0x33, 0x42, 0x43, 0x34, 0x32,
+	0x34, 0x33, 0x53, 0x33, 0x21, 0x88, 0x88, 0x80, 0x88, 0x98, 0x37, 0x64, 0x32, 0x19, 0xbd, 0xca,
+	0x99, 0x00, 0x00, 0x08, 0x80, 0x80, 0x88, 0x90, 0x14, 0x10, 0xee, 0xcc, 0xba, 0x81, 0x22, 0x08,
+	0xbc, 0x91, 0x46, 0x42, 0x21, 0x89, 0x02, 0x45, 0x52, 0x31, 0x20, 0x88, 0x88, 0x80, 0x01, 0x08,
+	0x99, 0x90, 0x35, 0x28, 0xef, 0xbc, 0x90, 0x25, 0x43, 0x22, 0x10, 0x88, 0x89, 0xbe, 0xdc, 0xca,
+	0xaa, 0x81, 0x13, 0x23, 0x21, 0x19, 0x9c, 0xbe, 0xbc, 0xba, 0x98, 0x81, 0x89, 0xbf, 0xdc, 0xcc,
+	0xca, 0xa9, 0x90, 0x80, 0x88, 0x90, 0x24, 0x44, 0x32, 0x21, 0x11, 0x08, 0x9c, 0xbc, 0x98, 0x00,
+	0x8b, 0xdc, 0xaa, 0x81, 0x13, 0x44, 0x46, 0x33, 0x32, 0x09, 0xa9, 0x91, 0x24, 0x43, 0x24, 0x23,
+	0x43, 0x42, 0x23, 0x34, 0x43, 0x33, 0x20, 0x88, 0x00, 0x00, 0xad, 0xdd, 0xbc, 0xaa, 0xa9, 0x80,
+	0x12, 0x29, 0xcd, 0xcb, 0xa8, 0x00, 0x8b, 0xdd, 0xbb, 0xbb, 0xcd, 0xcc, 0xbc, 0xba, 0xba, 0xa9,
+	0xa9, 0xac, 0xbd, 0xaa, 0x81, 0x34, 0x31, 0x08, 0xa9, 0x91, 0x22, 0x08, 0xcd, 0xdb, 0xca, 0x91,
+	0x35, 0x33, 0x21, 0x88, 0x80, 0x10, 0xaf, 0xcb, 0xcb, 0xac, 0xbc, 0xbb, 0x98, 0x10, 0x9c, 0xcd,
+	0xa9, 0x81, 0x10, 0x08, 0x90, 0x80, 0x09, 0x98, 0x37, 0x73, 0x30, 0x9f, 0xcb, 0xa9, 0x12, 0x33,
+	0x09, 0xcc, 0xa9, 0x00, 0x18, 0x88, 0x14, 0x54, 0x20, 0xae, 0xbc, 0xa9, 0x88, 0x00, 0x89, 0x88,
+	0x24, 0x44, 0x32, 0x09, 0xab, 0x91, 0x47, 0x32, 0x10, 0x88, 0x13, 0x63, 0x31, 0x09, 0x80, 0x55,
+	0x44, 0x21, 0x01, 0x13, 0x64, 0x34, 0x11, 0x88, 0x80, 0x14, 0x43, 0x21, 0x09, 0xac, 0xbc, 0xab,
+	0x99, 0x80, 0x12, 0x08, 0xbd, 0xdb, 0xcb, 0xac, 0xbc, 0xab, 0xaa, 0xbd, 0xcd, 0xbc, 0xaa, 0xa9,
+	0x9b, 0xbb, 0xa0, 0x44, 0x43, 0x08, 0xcb, 0xca, 0x81, 0x00, 0xac, 0xcb, 0x98, 0x10, 0x9c, 0xdb,
+	0xa8, 0x81, 0x88, 0x98, 0x37, 0x43, 0x18, 0xcc, 0xb9, 0x81, 0x10, 0x88, 0x02, 0x74, 0x22, 0x19,
+	0xad, 0xab, 0xb9, 0x90, 0x35, 0x43, 0x22, 0x88, 0x98, 0x80, 0x00, 0x88, 0x05, 0x74, 0x44, 0x22,
+	0x00, 0x80, 0x80, 0x18, 0x9c, 0xdc, 0xaa, 0x80, 0x23, 0x19, 0xcc, 0xda, 0xba, 0xbc, 0xca, 0x90,
+	0x45, 0x32, 0x8d, 0xeb, 0xca, 0x98, 0x00, 0x80, 0x88, 0x13, 0x55, 0x32, 0x10, 0x9b, 0xca, 0x81,
+	0x23, 0x29, 0xdd, 0xb9, 0x15, 0x53, 0x32, 0x09, 0x98, 0x04, 0x43, 0x21, 0x99, 0xbb, 0xa8, 0x80,
+	0x10, 0x88, 0x08, 0x00, 0x89, 0x88, 0x22, 0x29, 0xcc, 0x91, 0x40, 0xff, 0xfc, 0xa9, 0x14, 0x34,
+	0x08, 0xbd, 0xaa, 0x00, 0x11, 0x08, 0x98, 0x81, 0x89, 0xcc, 0xcb, 0xab, 0xae, 0xcb, 0xca, 0x91,
+	0x34, 0x22, 0x9a, 0xca, 0x81, 0x34, 0x21, 0x88, 0x82, 0x54, 0x31, 0x09, 0x90, 0x45, 0x53, 0x21,
+	0x10, 0x24, 0x44, 0x21, 0x00, 0x04, 0x56, 0x33, 0x20, 0x9b, 0xa9, 0x14, 0x43, 0x21, 0x89, 0x90,
+	0x35, 0x44, 0x32, 0x21, 0x10, 0x08, 0x88, 0x80, 0x08, 0xce, 0xdc, 0xa9, 0x13, 0x53, 0x32, 0x12,
+	0x23, 0x18, 0xed, 0xca, 0x81, 0x43, 0x20, 0x9b, 0xb9, 0x24, 0x43, 0x09, 0xba, 0x91, 0x43, 0x42,
+	0x20, 0x80, 0x9a, 0xce, 0xbb, 0x91, 0x45, 0x31, 0x09, 0x98, 0x45, 0x53, 0x20, 0x09, 0x80, 0x10,
+	0xac, 0xcb, 0x82, 0x44, 0x19, 0xcb, 0x91, 0x64, 0x42, 0x09, 0xab, 0xaa, 0x03, 0x33, 0x19, 0xfd,
+	0xbb, 0x94, 0x65, 0x33, 0x19, 0xcc, 0xbb, 0x80, 0x44, 0x32, 0x28, 0x8b, 0xbc, 0xbc, 0xba, 0xaa,
+	0x81, 0x11, 0x21, 0x12, 0x36, 0x34, 0x11, 0x09, 0x80, 0x00, 0x9d, 0xed, 0xbb, 0xaa, 0x81, 0x24,
+	0x44, 0x43, 0x32, 0x08, 0xbb, 0xb9, 0x26, 0x43, 0x20, 0x9a, 0xaa, 0xa9, 0xab, 0xeb, 0xba, 0x91,
+	0x33, 0x23, 0x33, 0x44, 0x33, 0x33, 0x55, 0x44, 0x21, 0x8b, 0xdd, 0xa9, 0x80, 0x21, 0x18, 0x80,
+	0x02, 0x18, 0xcf, 0xca, 0x81, 0x45, 0x33, 0x18, 0x89, 0x99, 0xab, 0xcc, 0xba, 0x81, 0x22, 0x19,
+	0xbe, 0xcb, 0xcb, 0xcb, 0x98, 0x16, 0x53, 0x41, 0x09, 0xbc, 0xa9, 0x02, 0x42, 0x19, 0xbe, 0xba,
+	0xa8, 0x00, 0x80, 0x88, 0x11, 0x33, 0x32, 0x24, 0x65, 0x33, 0x10, 0xab, 0xb9, 0x81, 0x0a, 0xfe,
+	0xbb, 0xc9, 0x98, 0x12, 0x42, 0x31, 0x9a, 0xbb, 0x83, 0x74, 0x32, 0x09, 0x9a, 0x81, 0x10, 0xde,
+	0xec, 0xba, 0x98, 0x13, 0x43, 0x33, 0x32, 0x11, 0x00, 0x80, 0x00, 0x08, 0x99, 0x90, 0x34, 0x39,
+	0xfd, 0xba, 0x14, 0x53, 0x30, 0xab, 0xcb, 0x9a, 0xab, 0xda, 0x80, 0x43, 0x20, 0xae, 0xbc, 0xa9,
+	0x88, 0x88, 0x13, 0x44, 0x20, 0xae, 0xbd, 0xa8, 0x82, 0x22, 0x31, 0x88, 0x99, 0x80, 0x12, 0x00,
+	0xbf, 0xcc, 0xbc, 0xab, 0xbc, 0xdd, 0xbc, 0xa8, 0x13, 0x43, 0x20, 0x9c, 0xba, 0xaa, 0xaa, 0xca,
+	0xa8, 0x36, 0x34, 0x08, 0xcc, 0xca, 0xa9, 0x80, 0x12, 0x23, 0x45, 0x34, 0x42, 0x11, 0x00, 0x80,
+	0x80, 0x88, 0x01, 0x45, 0x44, 0x22, 0x8b, 0xdd, 0xaa, 0x80, 0x24, 0x21, 0x0a, 0xab, 0xb9, 0x81,
+	0x13, 0x45, 0x42, 0x9c, 0xfd, 0xba, 0x80, 0x43, 0x42, 0x10, 0x88, 0x80, 0x08, 0x9b, 0xcb, 0x91,
+	0x53, 0x40, 0x8b, 0xdc, 0x99, 0x80, 0x11, 0x13, 0x43, 0x41, 0x09, 0x04, 0x75, 0x32, 0x0b, 0xec,
+	0xaa, 0x12, 0x44, 0x18, 0xac, 0xca, 0x90, 0x13, 0x41, 0x10, 0x99, 0x98, 0x80, 0x80, 0x89, 0x80,
+	0x11, 0x18, 0xbc, 0xcb, 0xaa, 0xad, 0xdc, 0xa9, 0x04, 0x52, 0x29, 0xdc, 0xca, 0x83, 0x44, 0x28,
+	0xbd, 0xcb, 0x91, 0x34, 0x30, 0x9c, 0xcc, 0x99, 0x00, 0x21, 0x11, 0x01, 0x18, 0x8a, 0xcc, 0xa8,
+	0x13, 0x52, 0x28, 0xaa, 0xaa, 0xab, 0xbc, 0xa1, 0x66, 0x34, 0x10, 0x9a, 0x98, 0x22, 0x31, 0x12,
+	0x65, 0x53, 0x33, 0x18, 0x88, 0x00, 0x08, 0x80, 0x01, 0x10, 0xcf, 0xfb, 0xba, 0x82, 0x53, 0x31,
+	0x9b, 0xca, 0x02, 0x53, 0x38, 0xac, 0xba, 0x83, 0x63, 0x20, 0xac, 0xba, 0x82, 0x35, 0x20, 0x9a,
+	0xca, 0x99, 0x9b, 0xcd, 0xbb, 0x80, 0x44, 0x33, 0x11, 0x12, 0x43, 0x29, 0xdf, 0xbb, 0x90, 0x34,
+	0x21, 0x8b, 0xcb, 0x80, 0x45, 0x53, 0x22, 0x19, 0xbc, 0xca, 0x90, 0x33, 0x21, 0xbe, 0xbb, 0x91,
+	0x44, 0x32, 0x8a, 0xcb, 0x98, 0x00, 0x8a, 0xbb, 0x90, 0x10, 0xbf, 0xfd, 0x99, 0x02, 0x22, 0x19,
+	0xbc, 0xa9, 0x23, 0x52, 0x21, 0x12, 0x34, 0x41, 0x9a, 0xdc, 0xa9, 0x99, 0xaa, 0x90, 0x55, 0x42,
+	0x8b, 0xec, 0xa9, 0x02, 0x22, 0x10, 0x01, 0x25, 0x34, 0x10, 0x89, 0x9a, 0xaa, 0xdb, 0xda, 0xa8,
+	0x80, 0x9b, 0xdb, 0x84, 0x74, 0x42, 0x89, 0xbc, 0xa0, 0x25, 0x42, 0x10, 0x89, 0x80, 0x21, 0x18,
+	0xbe, 0xba, 0xa0, 0x12, 0x10, 0x9b, 0xca, 0x81, 0x24, 0x22, 0x11, 0x80, 0x9d, 0xdd, 0xbd, 0xaa,
+	0x89, 0x8a, 0xbd, 0xdb, 0xa9, 0x91, 0x22, 0x21, 0x18, 0x08, 0x08, 0x08, 0x00, 0x46, 0x53, 0x31,
+	0x8a, 0xca, 0x90, 0x35, 0x32, 0x09, 0xa9, 0x81, 0x10, 0x89, 0x16, 0x76, 0x42, 0x20, 0x9a, 0xb9,
+	0x04, 0x44, 0x10, 0xbc, 0xdb, 0xbb, 0xba, 0xa9, 0x02, 0x54, 0x21, 0x9b, 0xcb, 0x91, 0x55, 0x43,
+	0x31, 0x08, 0xab, 0xac, 0xaa, 0xa9, 0x88, 0x00, 0x8a, 0xcc, 0xa0, 0x15, 0x43, 0x19, 0xcd, 0xbb,
+	0x98, 0x00, 0x8b, 0xbc, 0x90, 0x44, 0x28, 0xce, 0xcc, 0x98, 0x23, 0x52, 0x10, 0xbd, 0xcb, 0xa9,
+	0x12, 0x34, 0x32, 0x11, 0x80, 0x12, 0x45, 0x43, 0x33, 0x20, 0x8b, 0xec, 0xbc, 0xa9, 0x80, 0x18,
+	0x9b, 0xcb, 0xa9, 0x01, 0x8b, 0xec, 0xbb, 0x98, 0x9c, 0xed, 0xcb, 0xb9, 0x02, 0x33, 0x31, 0x89,
+	0x81, 0x36, 0x43, 0x33, 0x43, 0x32, 0x18, 0xbe, 0xbc, 0xab, 0xcd, 0xcd, 0xbc, 0x99, 0x01, 0x33,
+	0x30, 0x8b, 0xcb, 0xa9, 0x01, 0x32, 0x33, 0x43, 0x31, 0x8b, 0xfc, 0xb9, 0x02, 0x53, 0x20, 0xac,
+	0xbb, 0x83, 0x75, 0x34, 0x20, 0x9b, 0xcb, 0x92, 0x74, 0x32, 0x0a, 0xec, 0xb9, 0x81, 0x35, 0x21,
+	0x09, 0xab, 0xb8, 0x81, 0x24, 0x35, 0x44, 0x43, 0x33, 0x11, 0x80, 0x98, 0x08, 0x08, 0x08, 0x99,
+	0x9a, 0x99, 0x81, 0x13, 0x32, 0x13, 0x56, 0x44, 0x32, 0x10, 0x8a, 0x9a, 0x80, 0x23, 0x43, 0x18,
+	0xdf, 0xdc, 0xbc, 0xa8, 0x24, 0x44, 0x22, 0x08, 0x89, 0x98, 0x01, 0x33, 0x53, 0x42, 0x08, 0x9b,
+	0xba, 0x15, 0x64, 0x22, 0x08, 0x80, 0x14, 0x44, 0x31, 0x00, 0x81, 0x44, 0x43, 0x31, 0x89, 0xbb,
+	0xcb, 0xac, 0xab, 0xb9, 0x98, 0x00, 0x8a, 0xca, 0x84, 0x77, 0x34, 0x23, 0x18, 0xab, 0xdb, 0xcb,
+	0xaa, 0x99, 0x08, 0x89, 0xa9, 0xa9, 0x02, 0x54, 0x53, 0x35, 0x33, 0x43, 0x43, 0x21, 0x88, 0x9b,
+	0x9a, 0x00, 0x18, 0xbf, 0xeb, 0xba, 0x81, 0x33, 0x30, 0x8b, 0xba, 0x00, 0x21, 0xac, 0xdc, 0xba,
+	0xba, 0xbd, 0xcc, 0xcb, 0xcc, 0xbc, 0xaa, 0x90, 0x02, 0x11, 0x8a, 0xbc, 0xa8, 0x25, 0x54, 0x42,
+	0x32, 0x10, 0x9c, 0xbd, 0x99, 0x25, 0x53, 0x43, 0x21, 0x11, 0x12, 0x33, 0x31, 0x10, 0x01, 0x08,
+	0x9d, 0xdc, 0xcb, 0xbc, 0xbc, 0xbb, 0xaa, 0x88, 0x88, 0xab, 0xcb, 0x81, 0x32, 0x8f, 0xed, 0xcb,
+	0xaa, 0x99, 0x88, 0x88, 0x14, 0x45, 0x34, 0x21, 0x08, 0x89, 0xab, 0xbc, 0xcb, 0xaa, 0x80, 0x09,
+	0xbe, 0xba, 0x03, 0x74, 0x33, 0x21, 0x10, 0x88, 0xbf, 0xdc, 0xca, 0xba, 0xa9, 0x99, 0xcb, 0xca,
+	0xa8, 0x13, 0x35, 0x33, 0x44, 0x33, 0x43, 0x22, 0x11, 0x10, 0x9a, 0xcc, 0xbb, 0xa9, 0x80, 0x00,
+	0x9a, 0xcb, 0xca, 0xaa, 0x99, 0x8a, 0xac, 0xcd, 0xbd, 0xab, 0xbb, 0xa9, 0x98, 0x24, 0x64, 0x53,
+	0x33, 0x31, 0x10, 0x08, 0x88, 0xab, 0xdb, 0xba, 0x02, 0x45, 0x41, 0x19, 0xac, 0xbb, 0xa0, 0x36,
+	0x45, 0x23, 0x34, 0x22, 0x43, 0x35, 0x33, 0x31, 0x08, 0x9a, 0xa9, 0x99, 0x88, 0x90, 0x14, 0x43,
+	0x31, 0x9b, 0xfb, 0xcb, 0xbb, 0xdc, 0xcb, 0xcc, 0xab, 0xbb, 0xaa, 0x98, 0x08, 0x9b, 0xec, 0xbb,
+	0xa8, 0x11, 0x22, 0x19, 0xad, 0xcb, 0xdb, 0xbc, 0xbc, 0xaa, 0xaa, 0xaa, 0xaa, 0x81, 0x22, 0x41,
+	0x08, 0x88, 0x25, 0x53, 0x43, 0x33, 0x53, 0x53, 0x33, 0x33, 0x11, 0x19, 0x9a, 0x90, 0x46, 0x43,
+	0x10, 0x9b, 0xca, 0xa9, 0xa9, 0xbc, 0xaa, 0x91, 0x35, 0x54, 0x54, 0x35, 0x23, 0x42, 0x33, 0x43,
+	0x32, 0x09, 0xab, 0xca, 0x99, 0xac, 0xde, 0xbc, 0xbb, 0xa9, 0x88, 0x03, 0x55, 0x44, 0x33, 0x23,
+	0x34, 0x33, 0x22, 0x19, 0xac, 0xba, 0x91, 0x23, 0x33, 0x11, 0x00, 0x9b, 0xfc, 0xdb, 0xbb, 0xb9,
+	0x88, 0x12, 0x34, 0x21, 0x8b, 0xdc, 0xaa, 0x99, 0xad, 0xdd, 0xcb, 0xbb, 0xba, 0x98, 0x01, 0x21,
+	0x01, 0x03, 0x44, 0x32, 0xaf, 0xdc, 0xbb, 0xb9, 0x98, 0x9b, 0xbd, 0xcb, 0xbc, 0xbd, 0xbc, 0xbb,
+	0xbb, 0x98, 0x23, 0x53, 0x32, 0x10, 0x88, 0x08, 0x12, 0x44, 0x43, 0x21, 0xad, 0xdc, 0xbb, 0xaa,
+	0xaa, 0x99, 0x01, 0x54, 0x53, 0x43, 0x33, 0x32, 0x21, 0x10, 0x11, 0x12, 0x32, 0x32, 0x33, 0x52,
+	0x30, 0xae, 0xdb, 0xa9, 0x02, 0x28, 0xde, 0xdb, 0xbb, 0x88, 0x80, 0x80, 0x82, 0x65, 0x35, 0x32,
+	0x20, 0x08, 0x98, 0x90, 0x25, 0x54, 0x32, 0x0a, 0xdd, 0xbb, 0xa8, 0x01, 0x10, 0x8a, 0xa9, 0x81,
+	0x10, 0xaf, 0xdc, 0xdb, 0xbc, 0xa9, 0x81, 0x22, 0x20, 0xae, 0xdb, 0xaa, 0x80, 0x11, 0x8a, 0xca,
+	0xa0, 0x21, 0x0a, 0xcd, 0xb8, 0x02, 0x31, 0x9e, 0xcc, 0xbb, 0xca, 0xbb, 0xaa, 0x03, 0x34, 0x19,
+	0xcd, 0xca, 0x98, 0x01, 0x21, 0x13, 0x47, 0x43, 0x52, 0x20, 0x00, 0x89, 0x89, 0x98, 0x81, 0x25,
+	0x53, 0x43, 0x22, 0x22, 0x22, 0x20, 0x8a, 0x90, 0x46, 0x43, 0x31, 0x10, 0x02, 0x31, 0x8e, 0xfc,
+	0xbb, 0xba, 0x9a, 0x99, 0x9a, 0x00, 0x12, 0x08, 0xbd, 0xca, 0x98, 0x00, 0x8b, 0xeb, 0xa9, 0x36,
+	0x44, 0x31, 0x11, 0x01, 0x24, 0x35, 0x22, 0x08, 0xab, 0xb9, 0x13, 0x54, 0x22, 0x09, 0x9b, 0xab,
+	0x99, 0x80, 0x13, 0x54, 0x42, 0x33, 0x21, 0x18, 0xbf, 0xdb, 0xda, 0xa9, 0x02, 0x44, 0x35, 0x35,
+	0x43, 0x43, 0x21, 0x09, 0x99, 0x90, 0x34, 0x43, 0x31, 0x9a, 0xcc, 0xca, 0xba, 0xba, 0xab, 0xcb,
+	0xb9, 0x26, 0x65, 0x33, 0x21, 0x18, 0x01, 0x34, 0x34, 0x21, 0x00, 0x01, 0x33, 0x43, 0x23, 0x34,
+	0x54, 0x33, 0x32, 0x11, 0x11, 0x08, 0xac, 0xdc, 0xaa, 0xa9, 0x99, 0xab, 0xbb, 0xca, 0xbb, 0x91,
+	0x47, 0x43, 0x32, 0x21, 0x22, 0x33, 0x33, 0x43, 0x64, 0x35, 0x22, 0x12, 0x01, 0x18, 0xad, 0xcc,
+	0xbb, 0xa9, 0x88, 0x88, 0x13, 0x44, 0x20, 0xbd, 0xcb, 0x91, 0x44, 0x31, 0x8c, 0xdb, 0xa9, 0x00,
+	0x08, 0xac, 0xbb, 0xbb, 0xbb, 0xea, 0xa0, 0x25, 0x43, 0x31, 0x11, 0x24, 0x54, 0x42, 0x21, 0x08,
+	0x99, 0x80, 0x12, 0x08, 0xae, 0xbb, 0xb9, 0x81, 0x10, 0x08, 0x98, 0x80, 0x10, 0x88, 0x01, 0x20,
+	0xcf, 0xff, 0xab, 0xba, 0x98, 0x80, 0x08, 0x90, 0x15, 0x45, 0x32, 0x08, 0xbd, 0xbb, 0xba, 0xcc,
+	0xbd, 0xaa, 0x98, 0x00, 0x8b, 0xdc, 0xaa, 0x81, 0x11, 0x19, 0x99, 0x90, 0x23, 0x29, 0xde, 0xdc,
+	0xaa, 0x91, 0x35, 0x33, 0x21, 0x89, 0x02, 0x64, 0x44, 0x21, 0x10, 0x08, 0x88, 0x80, 0x01, 0x08,
+	0x9a, 0x90, 0x47, 0x53, 0x32, 0x08, 0xba, 0x90, 0x46, 0x42, 0x21, 0x08, 0x99, 0x80, 0x12, 0x08,
+	0xab, 0x90, 0x57, 0x53, 0x32, 0x19, 0xbb, 0xa1, 0x64, 0x43, 0x10, 0x98, 0x13, 0x63, 0x32, 0x09,
+	0x99, 0x80, 0x11, 0x08, 0x99, 0x00, 0x00, 0x88, 0x01, 0x10, 0xcd, 0xa8, 0x77, 0x54, 0x22, 0x19,
+	0xad, 0xbb, 0xb9, 0x80, 0x21, 0x18, 0xbe, 0xdc, 0xaa, 0x91, 0x34, 0x43, 0x21, 0x88, 0x88, 0x08,
+	0x88, 0x90, 0x23, 0x38, 0xff, 0xca, 0xa9, 0x80, 0x10, 0x88, 0x00, 0x18, 0x9c, 0xb1, 0x66, 0x43,
+	0x19, 0xbd, 0xc9, 0x81, 0x11, 0x08, 0xa9, 0x91, 0x23, 0x29, 0xed, 0xcb, 0xa9, 0x80, 0x11, 0x08,
+	0x99, 0x00, 0x01, 0x08, 0x99, 0x80, 0x12, 0x09, 0xa9, 0x90, 0x22, 0x29, 0xac, 0x91, 0x34, 0x29,
+	0xdc, 0x90, 0x55, 0x29, 0xee, 0xcc, 0xa9, 0x81, 0x10, 0x08, 0x89, 0x80, 0x10, 0x08, 0x89, 0x80,
+	0x11, 0x08, 0x99, 0x00, 0x11, 0x00, 0x89, 0x00, 0x01, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x80, 0x08, 0x89, 0x00, 0x01, 0x00, 0x89, 0x90, 0x12, 0x18, 0xab, 0x90, 0x43, 0x29, 0xdc, 0x90,
+	0x53, 0x29, 0xec, 0xa1, 0x55, 0x29, 0xde, 0xbb, 0x82, 0x53, 0x18, 0xbe, 0xa8, 0x14, 0x52, 0x19,
+	0xa0,
+};
+
+static const unsigned char sndbank_explosion[4097] = {
+	0x0d, 0xff, 0xfc, 0x57, 0x72, 0x19, 0xbb, 0x07, 0x75, 0x29, 0xcf, 0xcb, 0xba, 0x81, 0x22, 0x10,
+	0x89, 0x88, 0x22, 0x21, 0x9a, 0xbb, 0x90, 0x8a, 0xde, 0xca, 0x90, 0x11, 0x08, 0x03, 0x77, 0x53,
+	0x42, 0x12, 0x13, 0x23, 0x32, 0x10, 0x88, 0x80, 0x01, 0x80, 0x89, 0x00, 0x00, 0x08, 0x89, 0x00,
+	0x00, 0x08, 0x89, 0x08, 0x11, 0x08, 0x9a, 0x80, 0x23, 0x19, 0xcc, 0x91, 0x45, 0x29, 0xde, 0xbb,
+	0xdd, 0xee, 0xcd, 0xcb, 0xbb, 0xcc, 0xbd, 0xcc, 0xab, 0xba, 0x90, 0x88, 0x08, 0x08, 0x80, 0x88,
+	0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x80, 0x88,
+	0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x88, 0x19, 0x80, 0x08, 0x80, 0x00, 0x80, 0x00, 0x2a,
+	0x08, 0x88, 0x08, 0x00, 0x02, 0x09, 0x90, 0x88, 0x01, 0x29, 0xa0, 0x01, 0x92, 0x00, 0xa8, 0x81,
+	0x05, 0x38, 0xe9, 0x08, 0x57, 0x77, 0x77, 0x77, 0x72, 0x23, 0x23, 0x33, 0x22, 0x32, 0x34, 0x32,
+	0x20, 0x00, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80,
+	0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x80, 0x00, 0x09, 0x01, 0x91, 0xa0, 0x18, 0x1a,
+	0x81, 0x18, 0x00, 0x1a, 0x00, 0x80, 0x18, 0x01, 0xc0, 0x92, 0x19, 0x0a, 0x40, 0x8b, 0x20, 0x01,
+	0xaa, 0x30, 0x80, 0x19, 0x1a, 0x90, 0x29, 0x01, 0x00, 0xa1, 0x10, 0x09, 0x1a, 0x91, 0x23, 0x49,
+	0xcb, 0xd2, 0x34, 0x4a, 0xcc, 0xa1, 0x54, 0x29, 0xeb, 0xa1, 0x63, 0x39, 0xfb, 0xb1, 0x74, 0x18,
+	0xdf, 0xfe, 0xbd, 0xbd, 0xbc, 0xba, 0xaa, 0x98, 0x9a, 0xac, 0xba, 0xa8, 0x00, 0xbf, 0xfc, 0xbc,
+	0xa9, 0x88, 0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x80, 0x88, 0x08, 0x08,
+	0x80, 0x88, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x88, 0x08, 0x08, 0x08, 0x80, 0x80, 0x88, 0x19,
+	0x08, 0x80, 0x08, 0x00, 0x01, 0x98, 0x80, 0x2a, 0x80, 0x00, 0x82, 0x08, 0xa0, 0x88, 0x00, 0x82,
+	0x99, 0x88, 0x81, 0x98, 0x83, 0x99, 0x98, 0x18, 0x09, 0x88, 0x83, 0x71, 0xe8, 0x80, 0x77, 0x77,
+	0x77, 0x71, 0x09, 0x9b, 0xaa, 0x88, 0x13, 0x64, 0x54, 0x44, 0x34, 0x32, 0x12, 0x00, 0x80, 0x08,
+	0x08, 0x08, 0x08, 0x00, 0x88, 0x88, 0x11, 0x80, 0x9f, 0xfb, 0xbb, 0xca, 0xaa, 0xa9, 0x80, 0x11,
+	0x22, 0x23, 0x64, 0x32, 0x18, 0x99, 0x82, 0x43, 0x21, 0xab, 0xb0, 0x36, 0x38, 0xee, 0xeb, 0xca,
+	0xa9, 0x08, 0x01, 0x80, 0x99, 0x99, 0xa8, 0x88, 0x10, 0x08, 0x98, 0x27, 0x75, 0x34, 0x21, 0x88,
+	0x89, 0x02, 0x23, 0x20, 0xad, 0xcc, 0xaa, 0x81, 0x13, 0x21, 0x9c, 0xdb, 0xb8, 0x26, 0x44, 0x21,
+	0x0a, 0xbc, 0xc9, 0x90, 0x08, 0x8b, 0xdd, 0xcb, 0xbc, 0xbc, 0xbb, 0xaa, 0x90, 0x10, 0x09, 0xce,
+	0xbb, 0xba, 0x98, 0x08, 0x08, 0x80, 0x81, 0x10, 0x98, 0x82, 0x77, 0x32, 0x20, 0xab, 0xb9, 0x17,
+	0x45, 0x32, 0x31, 0x00, 0x08, 0x00, 0x12, 0x35, 0x45, 0x34, 0x43, 0x54, 0x34, 0x33, 0x21, 0x80,
+	0x88, 0x80, 0x10, 0x08, 0x88, 0x80, 0x10, 0x08, 0x98, 0x80, 0x10, 0xbf, 0xfd, 0xca, 0xaa, 0x80,
+	0x21, 0x11, 0x89, 0x81, 0x13, 0x29, 0xdf, 0xcb, 0xca, 0xab, 0xcd, 0xcb, 0xda, 0xbb, 0xbb, 0xbb,
+	0xca, 0xa8, 0x80, 0x80, 0x88, 0x08, 0x14, 0x32, 0x18, 0xcb, 0xca, 0x80, 0x80, 0x08, 0x88, 0x08,
+	0x08, 0x08, 0x37, 0x77, 0x33, 0x22, 0x00, 0x99, 0xa9, 0x03, 0x64, 0x44, 0x33, 0x34, 0x42, 0x21,
+	0x89, 0xcb, 0xc9, 0x80, 0x01, 0x89, 0xab, 0xba, 0x90, 0x11, 0x00, 0x13, 0x56, 0x32, 0x21, 0x10,
+	0x25, 0x44, 0x32, 0x10, 0x99, 0x9c, 0xce, 0xcc, 0xbb, 0xa9, 0x88, 0x08, 0x9a, 0xba, 0x92, 0x64,
+	0x33, 0x28, 0x99, 0x81, 0x57, 0x44, 0x34, 0x23, 0x22, 0x11, 0x12, 0x11, 0x21, 0x08, 0xbe, 0xcd,
+	0xbb, 0xca, 0xbc, 0xbc, 0xbc, 0xaa, 0xa9, 0xab, 0xdd, 0xbb, 0xa9, 0x08, 0x00, 0x88, 0x80, 0x88,
+	0x08, 0x08, 0x80, 0x80, 0x88, 0x08, 0x02, 0x29, 0xc8, 0x80, 0x77, 0x77, 0x41, 0x21, 0x32, 0x43,
+	0x33, 0x33, 0x34, 0x34, 0x34, 0x23, 0x33, 0x52, 0x23, 0x12, 0x22, 0x33, 0x32, 0x22, 0x45, 0x34,
+	0x20, 0x00, 0x98, 0x80, 0x10, 0x08, 0x98, 0x80, 0x10, 0x08, 0x98, 0x80, 0x10, 0x08, 0x89, 0x08,
+	0x10, 0x08, 0x89, 0x00, 0x08, 0x18, 0x89, 0x80, 0x03, 0x90, 0x88, 0x90, 0x18, 0x28, 0x99, 0x1a,
+	0x88, 0x49, 0xa9, 0xa2, 0x06, 0x00, 0xac, 0x98, 0x37, 0x29, 0xcc, 0x91, 0x45, 0x19, 0xcb, 0x93,
+	0x2e, 0xff, 0xff, 0xfa, 0xaa, 0xbc, 0xdc, 0xbc, 0xca, 0xbb, 0xba, 0xbb, 0xaa, 0x9a, 0xac, 0xbc,
+	0xbb, 0xbc, 0xcc, 0xbc, 0xbb, 0xb9, 0x90, 0x88, 0x08, 0x80, 0x80, 0x80, 0x88, 0x08, 0x00, 0x18,
+	0xa8, 0x07, 0x77, 0x74, 0x22, 0x31, 0x21, 0x11, 0x01, 0x12, 0x22, 0x20, 0x10, 0x14, 0x44, 0x20,
+	0xbf, 0xcc, 0xaa, 0x80, 0x00, 0x08, 0x80, 0x11, 0x08, 0xbe, 0xcb, 0xcb, 0xbc, 0xbd, 0xbc, 0xba,
+	0xa8, 0x80, 0x80, 0x08, 0x88, 0x14, 0x65, 0x34, 0x22, 0x00, 0x99, 0x99, 0x88, 0x89, 0xad, 0xcc,
+	0xba, 0xb8, 0x81, 0x22, 0x34, 0x34, 0x43, 0x43, 0x23, 0x23, 0x54, 0x43, 0x32, 0x11, 0x01, 0x37,
+	0x44, 0x34, 0x11, 0x08, 0x99, 0xa8, 0x98, 0xab, 0xdc, 0xcb, 0xb9, 0x02, 0x33, 0x30, 0x09, 0x83,
+	0x65, 0x32, 0x09, 0xbc, 0xa9, 0x12, 0x33, 0x22, 0x54, 0x54, 0x21, 0x8a, 0xcc, 0xb9, 0x98, 0x09,
+	0x9a, 0x91, 0x47, 0x34, 0x22, 0x34, 0x54, 0x53, 0x34, 0x22, 0x22, 0x21, 0x18, 0x9a, 0xbb, 0xb9,
+	0x89, 0x89, 0x89, 0x80, 0x10, 0x8b, 0xed, 0xdc, 0xcc, 0xbd, 0xbb, 0xab, 0x9a, 0x9a, 0xbc, 0xaa,
+	0x02, 0x43, 0x32, 0x8a, 0xce, 0xbd, 0xbc, 0xba, 0x88, 0x00, 0x09, 0x99, 0x04, 0x55, 0x22, 0x18,
+	0x9a, 0x88, 0x80, 0x9b, 0xbc, 0xa0, 0x34, 0x33, 0x08, 0x06, 0x64, 0x33, 0x09, 0xcb, 0x98, 0x34,
+	0x33, 0x00, 0x80, 0x13, 0x30, 0xbf, 0xdb, 0xab, 0xbc, 0xcc, 0xcb, 0xaa, 0x98, 0x99, 0xac, 0xcb,
+	0xbb, 0xcb, 0xcb, 0xa9, 0x82, 0x22, 0x11, 0x81, 0x47, 0x44, 0x23, 0x21, 0x12, 0x34, 0x44, 0x53,
+	0x54, 0x33, 0x33, 0x21, 0x11, 0x23, 0x42, 0x33, 0x22, 0x22, 0x21, 0x20, 0x88, 0x12, 0x45, 0x43,
+	0x23, 0x22, 0x43, 0x43, 0x21, 0x80, 0x01, 0x34, 0x21, 0x09, 0x98, 0x81, 0x00, 0x88, 0x08, 0x8f,
+	0xee, 0xdc, 0xbd, 0xbb, 0xcb, 0xbc, 0x99, 0x80, 0x00, 0x8a, 0xbc, 0xab, 0xab, 0xed, 0xcc, 0xbb,
+	0xa8, 0x00, 0x88, 0x9a, 0x98, 0x00, 0xae, 0xdc, 0xca, 0xa9, 0x99, 0xab, 0xca, 0x82, 0x64, 0x43,
+	0x32, 0x11, 0x22, 0x32, 0x20, 0x8a, 0xcb, 0xbb, 0xdd, 0xcb, 0xdb, 0xcb, 0xbb, 0xcb, 0xbb, 0xa9,
+	0x99, 0x00, 0x11, 0x08, 0x88, 0xaa, 0xcb, 0xeb, 0xda, 0x91, 0x55, 0x43, 0x41, 0x11, 0x01, 0x24,
+	0x23, 0x09, 0xdc, 0xca, 0xa8, 0x00, 0x00, 0x9a, 0x90, 0x15, 0x33, 0x18, 0xbd, 0xdb, 0xba, 0x90,
+	0x13, 0x53, 0x42, 0x00, 0xab, 0xcb, 0xbb, 0xb9, 0xa8, 0x81, 0x65, 0x64, 0x35, 0x23, 0x11, 0x18,
+	0x89, 0x8a, 0xbb, 0xbb, 0xa0, 0x26, 0x35, 0x22, 0x11, 0x11, 0x10, 0x89, 0xbd, 0xdb, 0xba, 0x98,
+	0x23, 0x64, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x24, 0x24, 0x34, 0x23, 0x21, 0x21, 0x24, 0x23,
+	0x08, 0xbc, 0xbb, 0x98, 0x00, 0x99, 0xa8, 0x15, 0x53, 0x20, 0x9a, 0xa9, 0x13, 0x1a, 0xff, 0xbb,
+	0xba, 0x9b, 0xde, 0xcc, 0xba, 0xba, 0xab, 0xbd, 0xba, 0x99, 0x98, 0xaa, 0xcb, 0xcc, 0xac, 0xbd,
+	0xba, 0xb9, 0x80, 0x11, 0x08, 0x9a, 0xa9, 0x00, 0x18, 0x9d, 0xcc, 0xba, 0x90, 0x23, 0x44, 0x23,
+	0x37, 0x45, 0x43, 0x52, 0x32, 0x34, 0x44, 0x35, 0x23, 0x22, 0x20, 0x10, 0x10, 0x89, 0x9a, 0xca,
+	0xba, 0x99, 0x98, 0x9a, 0xac, 0xcb, 0xcb, 0xbb, 0xcb, 0xcc, 0xba, 0xa9, 0x81, 0x89, 0xcd, 0xcc,
+	0xba, 0xaa, 0xcc, 0xbc, 0xbb, 0x99, 0x00, 0x01, 0x22, 0x42, 0x21, 0x9a, 0xb0, 0x57, 0x73, 0x43,
+	0x21, 0x12, 0x13, 0x43, 0x43, 0x22, 0x21, 0x00, 0x8a, 0xab, 0xa8, 0x02, 0x33, 0x10, 0xaa, 0xaa,
+	0xbd, 0xec, 0xdb, 0xa8, 0x02, 0x43, 0x22, 0x09, 0x99, 0xa9, 0xbe, 0xce, 0xbd, 0xbc, 0xcb, 0xbc,
+	0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbc, 0xcb, 0xbb, 0xaa, 0xa8, 0x98, 0xaa, 0xbb, 0xa9, 0x13, 0x73,
+	0x43, 0x43, 0x44, 0x35, 0x33, 0x43, 0x21, 0x18, 0x99, 0xa9, 0x98, 0x10, 0x89, 0xbe, 0xaa, 0x81,
+	0x43, 0x31, 0x0a, 0xcd, 0xbb, 0xaa, 0x80, 0x14, 0x44, 0x44, 0x34, 0x33, 0x23, 0x08, 0xcd, 0xdc,
+	0xcb, 0xbc, 0xab, 0xab, 0xaa, 0xbb, 0xbc, 0xbc, 0xab, 0xbc, 0xab, 0xaa, 0x90, 0x24, 0x45, 0x43,
+	0x33, 0x22, 0x28, 0x8a, 0xbc, 0xbb, 0xa8, 0x05, 0x45, 0x44, 0x33, 0x33, 0x42, 0x33, 0x32, 0x11,
+	0x88, 0x02, 0x56, 0x43, 0x32, 0x32, 0x22, 0x43, 0x32, 0x10, 0x88, 0x02, 0x34, 0x33, 0x21, 0x81,
+	0x13, 0x54, 0x32, 0x21, 0x08, 0x99, 0xad, 0xdc, 0xcd, 0xbc, 0xca, 0xbb, 0xbc, 0xbc, 0xcc, 0xbd,
+	0xbc, 0xba, 0xba, 0xbb, 0xbb, 0xbb, 0xaa, 0x88, 0x80, 0x8a, 0xbc, 0xb9, 0x37, 0x55, 0x33, 0x33,
+	0x33, 0x43, 0x43, 0x22, 0x20, 0x88, 0x81, 0x13, 0x23, 0x22, 0x47, 0x74, 0x53, 0x53, 0x23, 0x32,
+	0x34, 0x23, 0x21, 0x21, 0x01, 0x22, 0x23, 0x33, 0x54, 0x53, 0x43, 0x21, 0x18, 0x99, 0xaa, 0xdc,
+	0xcd, 0xbb, 0xba, 0xa9, 0x9a, 0xaa, 0xa8, 0x13, 0x52, 0x0a, 0xdc, 0xca, 0xa8, 0x00, 0x08, 0x90,
+	0x36, 0x54, 0x42, 0x11, 0x00, 0x80, 0x88, 0x9c, 0xcc, 0xbc, 0xaa, 0xaa, 0xbc, 0xca, 0xa9, 0x01,
+	0x22, 0x33, 0x33, 0x42, 0x00, 0x9a, 0xa9, 0x9b, 0xee, 0xdb, 0xcb, 0xa9, 0xaa, 0xcc, 0xdb, 0xbb,
+	0xba, 0x9a, 0xbb, 0xca, 0xb9, 0x98, 0xaa, 0xda, 0xb8, 0x25, 0x43, 0x32, 0x00, 0x13, 0x64, 0x53,
+	0x32, 0x21, 0x21, 0x32, 0x42, 0x32, 0x13, 0x35, 0x45, 0x34, 0x33, 0x21, 0x88, 0x99, 0x80, 0x08,
+	0x89, 0xa0, 0x45, 0x43, 0x28, 0xad, 0xcb, 0xcc, 0xcc, 0xbb, 0xc9, 0x99, 0x9a, 0xcd, 0xbb, 0xb9,
+	0x01, 0x08, 0xbf, 0xcb, 0xbb, 0xbc, 0xcc, 0xcb, 0xba, 0xaa, 0x99, 0xab, 0xbb, 0xa8, 0x23, 0x63,
+	0x52, 0x32, 0x32, 0x32, 0x43, 0x35, 0x32, 0x31, 0x23, 0x54, 0x54, 0x32, 0x21, 0x89, 0xbb, 0xca,
+	0xbb, 0xab, 0xcb, 0xbb, 0xa8, 0x13, 0x63, 0x28, 0xcd, 0xbc, 0x80, 0x14, 0x33, 0x34, 0x45, 0x33,
+	0x32, 0x08, 0x98, 0x01, 0x18, 0xdd, 0xcc, 0xaa, 0x80, 0x01, 0x00, 0x11, 0x34, 0x33, 0x10, 0x04,
+	0x75, 0x44, 0x32, 0x23, 0x24, 0x44, 0x33, 0x11, 0x00, 0x81, 0x23, 0x34, 0x33, 0x34, 0x54, 0x34,
+	0x31, 0x18, 0x9a, 0xbb, 0xa8, 0x14, 0x53, 0x52, 0x33, 0x43, 0x53, 0x34, 0x21, 0x89, 0xab, 0xba,
+	0xbb, 0xab, 0xbc, 0xbc, 0xcb, 0xcc, 0xbb, 0xcc, 0xbc, 0xcc, 0xbc, 0xba, 0x99, 0x80, 0x00, 0x01,
+	0x13, 0x44, 0x21, 0x08, 0xaa, 0xac, 0xbd, 0xdb, 0xcb, 0xcb, 0xbb, 0xdb, 0xbc, 0xa9, 0x80, 0x11,
+	0x23, 0x34, 0x34, 0x32, 0x00, 0x98, 0x80, 0x18, 0x9c, 0xa9, 0x04, 0x30, 0xcf, 0xca, 0x81, 0x53,
+	0x19, 0xed, 0xc9, 0x92, 0x34, 0x28, 0xad, 0xa9, 0x24, 0x52, 0x09, 0xdb, 0xa9, 0x03, 0x43, 0x31,
+	0x23, 0x64, 0x43, 0x11, 0x8a, 0xa9, 0x00, 0x11, 0x9d, 0xcb, 0xb9, 0x90, 0x8a, 0xdd, 0xcb, 0xa9,
+	0x80, 0x01, 0x08, 0x08, 0x00, 0x23, 0x53, 0x42, 0x20, 0x00, 0x80, 0x0a, 0xee, 0xcd, 0xbc, 0xbb,
+	0xbc, 0xbc, 0xcb, 0xba, 0xb9, 0x99, 0x98, 0x80, 0x23, 0x54, 0x32, 0x22, 0x33, 0x44, 0x33, 0x32,
+	0x22, 0x12, 0x11, 0x01, 0x11, 0x8a, 0xef, 0xcc, 0xbc, 0xaa, 0x9a, 0xab, 0xcb, 0x90, 0x55, 0x44,
+	0x32, 0x32, 0x23, 0x43, 0x43, 0x35, 0x34, 0x44, 0x23, 0x22, 0x01, 0x01, 0x23, 0x33, 0x21, 0x08,
+	0x88, 0x10, 0x20, 0x08, 0x98, 0x12, 0x42, 0x1a, 0xed, 0xbc, 0xa9, 0x99, 0x98, 0x98, 0x01, 0x18,
+	0xbf, 0xfd, 0xbc, 0xbb, 0xbb, 0xca, 0xcb, 0xbb, 0xca, 0x9a, 0xaa, 0xdc, 0xdb, 0xdc, 0xba, 0xca,
+	0xa9, 0x99, 0x00, 0x12, 0x34, 0x31, 0x19, 0xbd, 0xdb, 0xcb, 0xbb, 0xa9, 0x80, 0x35, 0x45, 0x34,
+	0x33, 0x21, 0x09, 0xbd, 0xcc, 0xbc, 0xbb, 0xa9, 0x81, 0x25, 0x44, 0x44, 0x33, 0x33, 0x34, 0x23,
+	0x44, 0x22, 0x20, 0x80, 0x88, 0x80, 0x18, 0x08, 0x88, 0x08, 0x10, 0x80, 0x98, 0x08, 0x10, 0x88,
+	0x88, 0x00, 0x00, 0x80, 0x98, 0x08, 0x10, 0x88, 0x80, 0x80, 0x00, 0x88, 0x08, 0x00, 0x80, 0x09,
+	0x98, 0x29, 0x09, 0x93, 0xa2, 0x09, 0x18, 0x98, 0x90, 0x18, 0x08, 0x11, 0xb1, 0x08, 0x02, 0x91,
+	0x9a, 0xc2, 0x24, 0x49, 0xea, 0xb1, 0x64, 0x29, 0xeb, 0xa1, 0x64, 0x29, 0xdd, 0x91, 0x44, 0x29,
+	0xdc, 0xa1, 0x54, 0x80, 0xbf, 0xa0, 0x61, 0x80, 0xaf, 0xff, 0xc9, 0x99, 0x99, 0xab, 0xcb, 0xcb,
+	0xcb, 0xcb, 0xaa, 0x98, 0x80, 0x80, 0x88, 0x08, 0x80, 0x80, 0x88, 0x08, 0x08, 0x08, 0x80, 0x88,
+	0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x90,
+	0x08, 0x08, 0x09, 0x08, 0x00, 0x00, 0x88, 0x00, 0x88, 0x08, 0x19, 0x10, 0x90, 0x88, 0x88, 0x00,
+	0x81, 0x19, 0x98, 0x88, 0x85, 0x2b, 0x9a, 0x19, 0x07, 0x4a, 0xc8, 0x08, 0x17, 0x49, 0xd8, 0x08,
+	0x17, 0x3a, 0xd8, 0x80, 0x17, 0x69, 0xc8, 0x08, 0x27, 0x77, 0x75, 0x11, 0x01, 0x11, 0x22, 0x22,
+	0x33, 0x33, 0x23, 0x34, 0x43, 0x43, 0x43, 0x54, 0x35, 0x32, 0x20, 0x80, 0x88, 0x80, 0x01, 0x08,
+	0x88, 0x80, 0x01, 0x88, 0x88, 0x80, 0x01, 0x88, 0x88, 0x80, 0x10, 0x80, 0x98, 0x00, 0x00, 0x09,
+	0x88, 0x00, 0x80, 0x00, 0x90, 0x08, 0x00, 0x89, 0x80, 0x19, 0x18, 0x02, 0xa0, 0x19, 0x01, 0xa2,
+	0x91, 0xa2, 0x89, 0x18, 0x92, 0x99, 0x08, 0x09, 0x80, 0x10, 0x19, 0x10, 0xa2, 0xb1, 0x10, 0x1a,
+	0x02, 0x29, 0x89, 0x0a, 0x21, 0x11, 0xac, 0xa3, 0x96, 0x11, 0xdd, 0x90, 0x63, 0x19, 0xdc, 0x91,
+	0x44, 0x39, 0xec, 0x90, 0x54, 0x19, 0xcd, 0x91, 0x44, 0x8f, 0xfe, 0xbc, 0xa9, 0x99, 0x9b, 0xcd,
+	0xbb, 0xba, 0xab, 0xbc, 0xcb, 0xcb, 0xbb, 0xaa, 0xaa, 0xaa, 0xcd, 0xcb, 0xcb, 0xba, 0x99, 0xac,
+	0xcd, 0xcb, 0xca, 0x99, 0x98, 0x88, 0x88, 0x08, 0x80, 0x80, 0x88, 0x08, 0x80, 0x80, 0x88, 0x08,
+	0x80, 0x80, 0x88, 0x08, 0x80, 0x80, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x09,
+	0x00, 0x91, 0x2b, 0x01, 0x90, 0x01, 0x91, 0x19, 0x19, 0x90, 0x21, 0x19, 0xa9, 0x00, 0x15, 0x5b,
+	0xb0, 0x80, 0x17, 0x39, 0xe8, 0x08, 0x07, 0x4a, 0xc8, 0x08, 0x17, 0x69, 0xc8, 0x08, 0x27, 0x77,
+	0x77, 0x31, 0x11, 0x11, 0x12, 0x21, 0x32, 0x33, 0x54, 0x33, 0x42, 0x32, 0x22, 0x22, 0x33, 0x34,
+	0x34, 0x35, 0x33, 0x43, 0x33, 0x32, 0x20, 0x08, 0x98, 0x00, 0x00, 0x80, 0x90, 0x80, 0x00, 0x88,
+	0x80, 0x80, 0x08, 0x08, 0x80, 0x80, 0x08, 0x88, 0x00, 0x18, 0x8a, 0x90, 0x25, 0x19, 0xcc, 0x90,
+	0x55, 0x29, 0xdc, 0xa0, 0x65, 0x38, 0xff, 0xdd, 0xbd, 0xbb, 0xcb, 0xba, 0xbb, 0xaa, 0xbc, 0xab,
+	0xab, 0xaa, 0xbd, 0xbc, 0xca, 0xbc, 0xbb, 0xbc, 0xba, 0xa8, 0x90, 0x89, 0xbd, 0xcc, 0xbb, 0xcb,
+	0xbd, 0xcb, 0xda, 0xba, 0x90, 0x02, 0x23, 0x32, 0x09, 0xcb, 0xdc, 0xab, 0xab, 0xbc, 0xcd, 0xcb,
+	0xdb, 0xbb, 0xcc, 0xbd, 0xbc, 0xba, 0xa0, 0x88, 0x00, 0x88, 0x80, 0x88, 0x08, 0x08, 0x80, 0x88,
+	0x08, 0x08, 0x80, 0x88, 0x08, 0x08, 0x08, 0x18, 0x90, 0x88, 0x05, 0x29, 0xc9, 0x08, 0x27, 0x77,
+	0x77, 0x41, 0x23, 0x23, 0x42, 0x33, 0x43, 0x34, 0x33, 0x34, 0x34, 0x42, 0x32, 0x22, 0x23, 0x23,
+	0x21, 0x9b, 0xed, 0xbb, 0xbb, 0xcb, 0xab, 0xba, 0x80, 0x01, 0x8a, 0xac, 0xba, 0xac, 0xed, 0xcd,
+	0xbb, 0xbb, 0xbb, 0xcb, 0xdc, 0xaa, 0xa9, 0x00, 0x01, 0x12, 0x12, 0x43, 0x53, 0x34, 0x23, 0x34,
+	0x35, 0x35, 0x32, 0x42, 0x21, 0x11, 0x10, 0x18, 0x01, 0x13, 0x33, 0x20, 0xad, 0xcb, 0xb9, 0x99,
+	0xae, 0xcb, 0xca, 0xba, 0xac, 0xdc, 0xbc, 0xca, 0xab, 0xaa, 0xaa, 0xa8, 0x80, 0x10, 0x12, 0x12,
+	0x35, 0x34, 0x22, 0x10, 0x12, 0x24, 0x35, 0x45, 0x35, 0x34, 0x34, 0x34, 0x34, 0x42, 0x32, 0x22,
+	0x22, 0x24, 0x33, 0x54, 0x35, 0x33, 0x43, 0x34, 0x43, 0x35, 0x33, 0x33, 0x32, 0x32, 0x11, 0x88,
+	0x88, 0x08, 0x00, 0x08, 0x80, 0x80, 0x08, 0x08, 0x80, 0x80, 0x00, 0x80, 0x89, 0x08, 0x01, 0x08,
+	0x99, 0x90, 0x36, 0x30, 0xff, 0xff, 0xbd, 0xcb, 0xdc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbc, 0xbb, 0xcb,
+	0xbb, 0xbb, 0xaa, 0xab, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xcb, 0xba, 0xab, 0xab, 0xcb, 0xa9, 0x82,
+	0x36, 0x23, 0x10, 0x9a, 0xba, 0x98, 0x25, 0x43, 0x22, 0x10, 0x12, 0x45, 0x32, 0x0b, 0xed, 0xbb,
+	0xb9, 0xab, 0xcc, 0xca, 0xa8, 0x02, 0x11, 0x09, 0x8a, 0xad, 0xec, 0xcc, 0x98, 0x80, 0x81, 0x08,
+	0x98, 0x80, 0x84, 0x32, 0x09, 0xcb, 0xb8, 0x08, 0x00, 0x88, 0x83, 0x76, 0x44, 0x34, 0x42, 0x34,
+	0x43, 0x34, 0x23, 0x42, 0x23, 0x34, 0x23, 0x42, 0x11, 0x00, 0x88, 0x02, 0x44, 0x32, 0x21, 0x25,
+	0x55, 0x43, 0x33, 0x22, 0x22, 0x32, 0x33, 0x54, 0x63, 0x52, 0x32, 0x11, 0x12, 0x34, 0x21, 0x08,
+	0x88, 0x03, 0x63, 0x42, 0x33, 0x43, 0x52, 0x31, 0x18, 0x80, 0x13, 0x22, 0x0a, 0xbb, 0x86, 0x55,
+	0x33, 0x32, 0x23, 0x53, 0x33, 0x11, 0x08, 0x80, 0x00, 0x08, 0x98, 0x80, 0x11, 0x18, 0xbf, 0xfe,
+	0xdb, 0xeb, 0xbb, 0xba, 0xa9, 0xaa, 0xbc, 0xcb, 0xcb, 0xbb, 0xcc, 0xbc, 0xab, 0xaa, 0x9a, 0x88,
+	0x01, 0x10, 0x9d, 0xec, 0xcb, 0xcc, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xca, 0xaa, 0x98, 0x02, 0x33,
+	0x43, 0x33, 0x43, 0x33, 0x22, 0x11, 0x36, 0x44, 0x34, 0x32, 0x33, 0x33, 0x10, 0x89, 0xbb, 0xcb,
+	0xdb, 0xbc, 0xa9, 0x90, 0x02, 0x36, 0x46, 0x35, 0x33, 0x33, 0x23, 0x33, 0x34, 0x22, 0x10, 0x00,
+	0x11, 0x32, 0x19, 0xcc, 0xca, 0xa9, 0x9a, 0x88, 0x46, 0x54, 0x34, 0x11, 0x88, 0x99, 0x08, 0x89,
+	0xbd, 0xca, 0xa8, 0x02, 0x34, 0x43, 0x35, 0x33, 0x33, 0x10, 0x89, 0x9a, 0xac, 0xcb, 0xdb, 0xaa,
+	0x80, 0x89, 0xbf, 0xdc, 0xbc, 0xbb, 0xcc, 0xbc, 0xbc, 0xa9, 0x98, 0x88, 0x9b, 0xcc, 0xbb, 0xa9,
+	0x98, 0x9b, 0xdc, 0xaa, 0x01, 0x33, 0x19, 0xce, 0xbc, 0xab, 0xaa, 0xcb, 0xdc, 0xbb, 0xca, 0xb9,
+	0x99, 0x88, 0x9b, 0xbe, 0xcb, 0xbb, 0xbb, 0xbb, 0xca, 0xba, 0x98, 0x13, 0x43, 0x33, 0x10, 0x88,
+	0x02, 0x44, 0x33, 0x44, 0x53, 0x53, 0x22, 0x10, 0x9a, 0xaa, 0xa9, 0x03, 0x64, 0x53, 0x42, 0x32,
+	0x22, 0x22, 0x10, 0x88, 0x02, 0x76, 0x45, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x43, 0x53,
+	0x33, 0x43, 0x34, 0x33, 0x42, 0x32, 0x22, 0x23, 0x34, 0x42, 0x33, 0x34, 0x43, 0x23, 0x18, 0x89,
+	0xaa, 0xab, 0xdb, 0xdb, 0x98, 0x14, 0x44, 0x43, 0x33, 0x42, 0x31, 0x00, 0xaa, 0xac, 0xba, 0xb9,
+	0x82, 0x64, 0x44, 0x22, 0x11, 0x88, 0x88, 0x00, 0x88, 0x08, 0x00, 0x00, 0x99, 0x90, 0x34, 0x38,
+	0xff, 0xcc, 0xbc, 0xab, 0xbb, 0xba, 0x82, 0x54, 0x32, 0x08, 0x9b, 0xba, 0xbc, 0xbc, 0xaa, 0x98,
+	0x13, 0x34, 0x10, 0xbf, 0xfc, 0xcb, 0xdb, 0xcb, 0xbc, 0xbb, 0xba, 0xb9, 0x99, 0x08, 0x80, 0x00,
+	0x02, 0x22, 0x08, 0xad, 0xcc, 0xbc, 0xbc, 0xcc, 0xbc, 0xbc, 0xbc, 0xbb, 0xca, 0x99, 0x80, 0x08,
+	0x8a, 0xbc, 0xca, 0xba, 0xab, 0xbc, 0xcb, 0xbc, 0xba, 0xba, 0x98, 0x80, 0x08, 0x9a, 0xdc, 0xbc,
+	0xbc, 0xbc, 0xba, 0xa9, 0x12, 0x53, 0x52, 0x22, 0x11, 0x12, 0x12, 0x23, 0x12, 0x12, 0x12, 0x23,
+	0x22, 0x09, 0xac, 0xed, 0xdc, 0xdc, 0xbb, 0xca, 0x90, 0x02, 0x33, 0x42, 0x43, 0x55, 0x43, 0x43,
+	0x33, 0x12, 0x01, 0x01, 0x12, 0x22, 0x22, 0x19, 0xac, 0xa9, 0x25, 0x53, 0x31, 0x8a, 0xba, 0x83,
+	0x74, 0x43, 0x23, 0x34, 0x45, 0x43, 0x43, 0x42, 0x34, 0x23, 0x43, 0x33, 0x42, 0x32, 0x11, 0x88,
+	0x8a, 0x99, 0x90, 0x13, 0x54, 0x43, 0x53, 0x43, 0x53, 0x34, 0x33, 0x43, 0x43, 0x33, 0x43, 0x34,
+	0x33, 0x33, 0x21, 0x01, 0x02, 0x24, 0x43, 0x53, 0x53, 0x34, 0x22, 0x22, 0x24, 0x33, 0x34, 0x24,
+	0x43, 0x52, 0x21, 0x08, 0x98, 0x80, 0x01, 0x08, 0x98, 0x80, 0x01, 0x08, 0x99, 0x81, 0x11, 0x08,
+	0xab, 0xa1, 0x55, 0x28, 0xef, 0xdd, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xab, 0xca, 0xcc, 0xbc, 0xcc,
+	0xbb, 0xda, 0xca, 0xba, 0xbb, 0xbb, 0xba, 0xb9, 0xaa, 0xaa, 0xbc, 0xab, 0x98, 0x13, 0x42, 0x10,
+	0x89, 0xa9, 0x9a, 0xdd, 0xdc, 0xcb, 0xaa, 0xaa, 0xcb, 0xdc, 0xab, 0xb9, 0xaa, 0xab, 0xcc, 0xcc,
+	0xab, 0xba, 0xbb, 0xba, 0xbb, 0xbd, 0xcb, 0xec, 0xcb, 0xcc, 0xbb, 0xdb, 0xbc, 0xbb, 0xca, 0xbb,
+	0xcb, 0xcb, 0xab, 0x99, 0x88, 0x08, 0x80, 0x88, 0x08, 0x08, 0x80, 0x80, 0x88, 0x08, 0x80, 0x88,
+	0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x80, 0x89, 0x80, 0x03, 0x1c, 0x90, 0x88, 0x37, 0x28,
+	0xe9, 0x08, 0x27, 0x77, 0x77, 0x33, 0x24, 0x33, 0x23, 0x22, 0x10, 0x10, 0x00, 0x9b, 0xec, 0xba,
+	0x98, 0x11, 0x11, 0x88, 0x80, 0x22, 0x41, 0x12, 0x47, 0x55, 0x44, 0x33, 0x44, 0x35, 0x43, 0x43,
+	0x42, 0x33, 0x33, 0x42, 0x33, 0x32, 0x34, 0x34, 0x34, 0x43, 0x33, 0x34, 0x33, 0x43, 0x34, 0x33,
+	0x34, 0x33, 0x43, 0x43, 0x33, 0x43, 0x34, 0x23, 0x32, 0x23, 0x22, 0x22, 0x11, 0x08, 0x99, 0x80,
+	0x12, 0x08, 0xab, 0x91, 0x44, 0x39, 0xfe, 0xcb, 0xba, 0x00, 0x11, 0x9b, 0xec, 0xba, 0xbb, 0xbc,
+	0xbb, 0xba, 0xaa, 0x99, 0x99, 0xad, 0xde, 0xcd, 0xcc, 0xbc, 0xbc, 0xab, 0xbb, 0xbc, 0xaa, 0x99,
+	0x89, 0x89, 0xac, 0xbd, 0xbb, 0xcb, 0xaa, 0xaa, 0xb9, 0x90, 0x37, 0x44, 0x33, 0x32, 0x20, 0x11,
+	0x00, 0x08, 0x81, 0x46, 0x44, 0x33, 0x22, 0x12, 0x34, 0x32, 0x08, 0xaa, 0x90, 0x23, 0x44, 0x36,
+	0x55, 0x43, 0x22, 0x11, 0x01, 0x12, 0x18, 0xac, 0xdb, 0xab, 0xba, 0xcc, 0xbc, 0xcb, 0xcb, 0xcb,
+	0xdb, 0xcb, 0xcc, 0xab, 0xba, 0xa9, 0x89, 0x9a, 0xac, 0xab, 0xa8, 0x98, 0x9b, 0xcd, 0xba, 0xba,
+	0xac, 0xbd, 0xcb, 0xcb, 0xbc, 0xbb, 0xbb, 0xbc, 0xab, 0xbb, 0xbc, 0xa9, 0x80, 0x11, 0x08, 0x88,
+	0x14, 0x44, 0x23, 0x12, 0x34, 0x43, 0x31, 0x8b, 0xdc, 0xdc, 0xcd, 0xcb, 0xda, 0xbb, 0xa9, 0xa9,
+	0xa9, 0xaa, 0xab, 0xbd, 0xbc, 0xca, 0xbb, 0xbb, 0xcc, 0xcb, 0xaa, 0x98, 0x00, 0x08, 0x90, 0x88,
+	0x01, 0x19, 0xa8, 0x08, 0x17, 0x2a, 0xc8, 0x80, 0x17, 0x77, 0x18, 0xaa, 0xa8, 0x24, 0x44, 0x33,
+	0x36, 0x36, 0x33, 0x42, 0x12, 0x11, 0x33, 0x42, 0x21, 0x00, 0x12, 0x35, 0x42, 0x21, 0x11, 0x34,
+	0x53, 0x43, 0x33, 0x22, 0x22, 0x34, 0x33, 0x33, 0x21, 0x22, 0x24, 0x21, 0x0a, 0xed, 0xcb, 0xcc,
+	0xbc, 0xbd, 0xbb, 0xcb, 0xaa, 0xa9, 0xa9, 0x99, 0x81, 0x11, 0x10, 0x08, 0x88, 0x13, 0x34, 0x32,
+	0x32, 0x23, 0x34, 0x33, 0x34, 0x22, 0x9d, 0xdd, 0xca, 0xa8, 0x01, 0x10, 0x02, 0x57, 0x54, 0x44,
+	0x23, 0x23, 0x24, 0x34, 0x43, 0x34, 0x44, 0x34, 0x23, 0x22, 0x10, 0x00, 0x80, 0x80, 0x80, 0x08,
+	0x80, 0x88, 0x00, 0x08, 0x88, 0x88, 0x21, 0x8e, 0xfd, 0xcb, 0xca, 0xa9, 0xaa, 0x9b, 0xaa, 0xbb,
+	0xdc, 0xcc, 0xcb, 0xbc, 0xaa, 0xbc, 0xbc, 0xbc, 0xba, 0xba, 0xbb, 0xbd, 0xbc, 0xbc, 0xbb, 0xbc,
+	0xab, 0xab, 0xca, 0xaa, 0x9a, 0x99, 0x9a, 0xaa, 0xbb, 0xaa, 0x98, 0x99, 0xcc, 0xcc, 0xab, 0xa9,
+	0xba, 0xca, 0xb9, 0x80, 0x23, 0x23, 0x23, 0x34, 0x54, 0x34, 0x54, 0x54, 0x34, 0x43, 0x34, 0x36,
+	0x34, 0x34, 0x21, 0x10, 0x01, 0x01, 0x00, 0x9a, 0xdb, 0xca, 0x9a, 0x9a, 0xcc, 0xcb, 0xbc, 0xaa,
+	0xcc, 0xcb, 0xcb, 0xab, 0xbc, 0xcb, 0xca, 0xba, 0xa8, 0x80, 0x11, 0x12, 0x11, 0x89, 0xcb, 0xda,
+	0xbb, 0xdc, 0xcc, 0xcc, 0xab, 0xa9, 0xab, 0xbc, 0xca, 0xba, 0x9a, 0xac, 0xdc, 0xbb, 0xa9, 0x08,
+	0x00, 0x88, 0x80, 0x88, 0x00, 0x08, 0x90, 0x88, 0x01, 0x09, 0x90, 0x77, 0x65, 0x34, 0x22, 0x00,
+	0x98, 0x80, 0x10, 0x10, 0x81, 0x37, 0x63, 0x43, 0x10, 0x80, 0x04, 0x45, 0x32, 0x21, 0x00, 0x12,
+	0x44, 0x43, 0x23, 0x34, 0x36, 0x23, 0x32, 0x32, 0x35, 0x43, 0x33, 0x34, 0x34, 0x34, 0x33, 0x21,
+	0x11, 0x11, 0x11, 0x10, 0x11, 0x24, 0x44, 0x35, 0x33, 0x42, 0x31, 0x00, 0x98, 0x02, 0x54, 0x34,
+	0x22, 0x23, 0x35, 0x33, 0x22, 0x11, 0x11, 0x32, 0x1a, 0xec, 0xca, 0x99, 0x08, 0x9c, 0xdd, 0xcb,
+	0xcb, 0xbc, 0xbb, 0xbb, 0xa9, 0x88, 0x00, 0x08, 0x8a, 0xbc, 0xca, 0x82, 0x65, 0x34, 0x10, 0x89,
+	0x88, 0x22, 0x10, 0xce, 0xcc, 0xba, 0xa9, 0x99, 0x9b, 0xab, 0xba, 0xaa, 0xaa, 0xdb, 0xcb, 0xbb,
+	0xbb, 0xdb, 0xbc, 0xbb, 0xbc, 0xaa, 0x99, 0x80, 0x12, 0x37, 0x44, 0x34, 0x23, 0x23, 0x34, 0x22,
+	0x08, 0xbc, 0xca, 0xaa, 0xbb, 0xb9, 0x04, 0x53, 0x20, 0xce, 0xdc, 0xbd, 0xbc, 0xbc, 0xbc, 0xaa,
+	0x98, 0x98, 0x89, 0x9a, 0xab, 0xcb, 0xdc, 0xab, 0xa9, 0x88, 0x80, 0x01, 0x24, 0x42, 0x18, 0xae,
+	0xbb, 0xa8, 0x81, 0x22, 0x54, 0x54, 0x34, 0x22, 0x10, 0x00, 0x11, 0x22, 0x10, 0x13, 0x75, 0x53,
+	0x43, 0x43, 0x43, 0x33, 0x21, 0x09, 0x89, 0x00, 0x08, 0x88, 0x14, 0x74, 0x42, 0x32, 0x08, 0x99,
+	0x99, 0x88, 0x8a, 0xad, 0xbc, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcb, 0xca, 0xaa, 0x9a, 0x9a, 0xaa,
+	0xa9, 0xa8, 0xa9, 0xbc, 0xcc, 0xca, 0xba, 0x98, 0x13, 0x43, 0x11, 0x9a, 0xb9, 0x26, 0x54, 0x32,
+	0x20, 0x80, 0x37, 0x55, 0x34, 0x42, 0x22, 0x21, 0x20, 0x18, 0x88, 0x90, 0x13, 0x53, 0x32, 0x10,
+	0x9b, 0xbe, 0xcc, 0xcd, 0xbb, 0xaa, 0x90, 0x12, 0x23, 0x33, 0x63, 0x32, 0x18, 0xbe, 0xbc, 0xba,
+	0xab, 0xac, 0xbb, 0xba, 0xa9, 0x80, 0x14, 0x34, 0x32, 0x09, 0xab, 0xcb, 0xac, 0xdc, 0xeb, 0xcb,
+	0xaa, 0xa9, 0x9a, 0xcb, 0xb9, 0x04, 0x54, 0x33, 0x21, 0x00, 0x08, 0x00, 0x89, 0x88, 0x26, 0x64,
+	0x53, 0x33, 0x33, 0x22, 0x11, 0x09, 0xcd, 0xdb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x81, 0x13, 0x43,
+	0x33, 0x20, 0x8b, 0xdd, 0xcb, 0xbc, 0xaa, 0xaa, 0x98, 0x90, 0x23, 0x64, 0x33, 0x31, 0x10, 0x12,
+	0x34, 0x31, 0x8d, 0xdc, 0xbb, 0xaa, 0x98, 0x83, 0x66, 0x45, 0x43, 0x34, 0x33, 0x43, 0x22, 0x10,
+	0x9a, 0xcc, 0xbb, 0xab, 0xba, 0xaa, 0x90, 0x13, 0x45, 0x43, 0x53, 0x52, 0x42, 0x22, 0x22, 0x12,
+	0x21, 0x11, 0x10, 0x08, 0x8a, 0xcc, 0xdc, 0xbd, 0xbc, 0xba, 0xba, 0xba, 0x99, 0x80, 0x13, 0x43,
+	0x31, 0x8a, 0xdd, 0xcb, 0xbc, 0xbc, 0xab, 0xab, 0xbb, 0xbb, 0xbb, 0xcb, 0xeb, 0xdb, 0xdb, 0xcc,
+	0xbb, 0xcb, 0xaa, 0xa9, 0x89, 0x80, 0x11, 0x10, 0x0a, 0xbe, 0xbc, 0xbb, 0xbc, 0xab, 0xa8, 0x02,
+	0x43, 0x21, 0xad, 0xdc, 0xbb, 0xcb, 0xcc, 0xba, 0xa9, 0x80, 0x13, 0x44, 0x43, 0x52, 0x33, 0x12,
+	0x10, 0x08, 0x9b, 0xdc, 0xca, 0xb9, 0x99, 0x89, 0x98, 0x02, 0x54, 0x42, 0x12, 0x12, 0x46, 0x43,
+	0x34, 0x12, 0x22, 0x43, 0x44, 0x23, 0x34, 0x35, 0x33, 0x34, 0x22, 0x11, 0x10, 0x10, 0x08, 0x89,
+	0xaa, 0x90, 0x44, 0x63, 0x43, 0x33, 0x33, 0x34, 0x22, 0x11, 0x08, 0x12, 0x54, 0x53, 0x53, 0x54,
+	0x44, 0x34, 0x33, 0x43, 0x23, 0x32, 0x22, 0x22, 0x34, 0x34, 0x42, 0x23, 0x33, 0x43, 0x32, 0x22,
+	0x11, 0x13, 0x33, 0x53, 0x34, 0x43, 0x44, 0x43, 0x34, 0x22, 0x10, 0x08, 0x99, 0xac, 0xdc, 0xbc,
+	0xbb, 0xac, 0xac, 0xbd, 0xbb, 0xbc, 0xcb, 0xbd, 0xbb, 0xcb, 0xca, 0xab, 0xbb, 0xab, 0xca, 0xbc,
+	0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xab, 0xca, 0xba, 0xba, 0xaa, 0xab, 0xdb, 0xbc, 0xaa, 0xa9, 0x9b,
+	0xbd, 0xca, 0xa9, 0x88, 0xab, 0xec, 0xcc, 0xbb, 0xcb, 0xcb, 0xcb, 0xba, 0xba, 0xa9, 0xaa, 0xa9,
+	0xaa, 0xbb, 0xcd, 0xbb, 0xbc, 0xaa, 0xa9, 0xa9, 0x99, 0x9b, 0xce, 0xcb, 0xdb, 0xbc, 0xcb, 0xdb,
+	0xbc, 0xaa, 0x98, 0x80, 0x11, 0x13, 0x34, 0x43, 0x33, 0x32, 0x23, 0x43, 0x44, 0x35, 0x33, 0x54,
+	0x43, 0x52, 0x33, 0x22, 0x32, 0x33, 0x43, 0x34, 0x24, 0x23, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34,
+	0x33, 0x53, 0x42, 0x32, 0x23, 0x43, 0x43, 0x42, 0x20, 0x08, 0x9a, 0xac, 0xbc, 0xbc, 0xba, 0xa9,
+	0x90, 0x24, 0x44, 0x42, 0x31, 0x10, 0x08, 0x99, 0xbd, 0xbd, 0xba, 0xca, 0xbb, 0xba, 0x98, 0x00,
+	0x88, 0x90, 0x16, 0x44, 0x23, 0x24, 0x36, 0x43, 0x33, 0x33, 0x34, 0x34, 0x33, 0x22, 0x21, 0x21,
+	0x21, 0x19, 0x9a, 0x91, 0x24, 0x28, 0xed, 0xcc, 0xaa, 0x99, 0x9c, 0xbd, 0xba, 0xbc, 0xbc, 0xcb,
+	0xcb, 0xbc, 0xbb, 0xcb, 0xab, 0x99, 0x00, 0x08, 0x89, 0x80, 0x13, 0x53, 0x31, 0x08, 0xa9, 0x90,
+	0x35, 0x54, 0x43, 0x54, 0x34, 0x33, 0x22, 0x12, 0x21, 0x19, 0xac, 0xcb, 0x98, 0x00, 0x89, 0x98,
+	0x46, 0x64, 0x33, 0x34, 0x23, 0x43, 0x23, 0x21, 0x12, 0x24, 0x33, 0x19, 0xcd, 0xb9, 0x90, 0x10,
+	0xad, 0xbc, 0x98, 0x10, 0x9c, 0xcb, 0xb8, 0x10, 0x8f, 0xdc, 0xba, 0xa9, 0x88, 0xab, 0xda, 0xb9,
+	0xa9, 0xac, 0xcc, 0xaa, 0x80, 0x08, 0x9b, 0xcc, 0xb9, 0x00, 0x10, 0x88, 0x03, 0x75, 0x32, 0x19,
+	0xa0,
+};
+
+static const unsigned char sndbank_monster[4097] = {
+	0x06, 0x60, 0xef, 0xda, 0x82, 0x42, 0x19, 0xcb, 0xa1, 0x44, 0x28, 0xbd, 0xa8, 0x25, 0x22, 0x09,
+	0x9a, 0x00, 0x11, 0x08, 0x99, 0x00, 0x00, 0x88, 0x02, 0x29, 0xcc, 0xa0, 0x74, 0x29, 0xed, 0xca,
+	0x82, 0x43, 0x18, 0xcc, 0xa8, 0x24, 0x52, 0x08, 0xbc, 0xb9, 0x82, 0x33, 0x41, 0x09, 0x99, 0x80,
+	0x22, 0x08, 0xbc, 0x91, 0x44, 0x28, 0xee, 0xba, 0x91, 0x44, 0x21, 0x08, 0x99, 0x80, 0x10, 0x88,
+	0x00, 0x10, 0xaf, 0xfb, 0xba, 0x91, 0x35, 0x34, 0x21, 0x08, 0xa9, 0x90, 0x35, 0x18, 0xdd, 0xca,
+	0x81, 0x43, 0x21, 0x88, 0x90, 0x10, 0xad, 0xdb, 0xb9, 0x00, 0x18, 0x88, 0x15, 0x63, 0x32, 0x09,
+	0x99, 0x80, 0x10, 0x08, 0x80, 0x10, 0xab, 0xb1, 0x66, 0x28, 0xee, 0xbb, 0x91, 0x44, 0x32, 0x09,
+	0xa8, 0x81, 0x0a, 0xde, 0xcc, 0xa9, 0x80, 0x24, 0x35, 0x43, 0x33, 0x21, 0x09, 0xac, 0xbc, 0xaa,
+	0xab, 0xbc, 0xcb, 0xbb, 0xa0, 0x36, 0x54, 0x33, 0x31, 0x08, 0xab, 0xbb, 0xcb, 0xca, 0xba, 0x91,
+	0x35, 0x43, 0x21, 0x09, 0x88, 0x80, 0x0a, 0xee, 0xdb, 0xda, 0xb9, 0x80, 0x24, 0x43, 0x44, 0x34,
+	0x43, 0x42, 0x11, 0x8a, 0xcb, 0xcb, 0xac, 0xbd, 0xcc, 0xab, 0xa9, 0x02, 0x23, 0x42, 0x33, 0x34,
+	0x43, 0x33, 0x32, 0x11, 0x00, 0x88, 0x00, 0x08, 0x89, 0x80, 0x13, 0x30, 0xff, 0xfc, 0xcb, 0xcb,
+	0xbb, 0xba, 0xb9, 0x80, 0x24, 0x44, 0x43, 0x53, 0x44, 0x33, 0x22, 0x10, 0x09, 0x99, 0xac, 0xbc,
+	0xbc, 0xba, 0xba, 0xa9, 0xaa, 0xac, 0xbc, 0xcb, 0xbb, 0x99, 0x13, 0x55, 0x34, 0x42, 0x34, 0x34,
+	0x33, 0x10, 0xae, 0xcc, 0xab, 0x99, 0x00, 0x02, 0x23, 0x33, 0x32, 0x09, 0x99, 0x04, 0x55, 0x32,
+	0x31, 0x11, 0x12, 0x18, 0xcf, 0xfc, 0xcb, 0xbb, 0xa9, 0x80, 0x13, 0x45, 0x34, 0x34, 0x22, 0x11,
+	0x10, 0x00, 0x9a, 0xbc, 0xca, 0xbb, 0xab, 0xcd, 0xcc, 0xcc, 0xbb, 0xa9, 0x03, 0x73, 0x53, 0x33,
+	0x22, 0x10, 0x09, 0x9a, 0xcb, 0xca, 0xb9, 0x90, 0x11, 0x23, 0x11, 0x19, 0x9c, 0xdc, 0xdb, 0xcb,
+	0xba, 0x90, 0x24, 0x55, 0x34, 0x33, 0x23, 0x10, 0x8b, 0xcc, 0xcc, 0xca, 0xbb, 0xa9, 0x80, 0x23,
+	0x44, 0x23, 0x42, 0x34, 0x32, 0x10, 0xab, 0xbc, 0xa9, 0x80, 0x10, 0x08, 0x89, 0x9b, 0xfd, 0xcc,
+	0xba, 0xa9, 0x88, 0x9a, 0x98, 0x25, 0x73, 0x43, 0x33, 0x23, 0x34, 0x22, 0x1a, 0xcd, 0xcc, 0xaa,
+	0xaa, 0xba, 0x98, 0x24, 0x64, 0x42, 0x20, 0x0a, 0xac, 0xcb, 0xbc, 0xba, 0x98, 0x03, 0x44, 0x43,
+	0x33, 0x42, 0x22, 0x08, 0x9b, 0xeb, 0xda, 0xbb, 0xa9, 0x81, 0x25, 0x34, 0x42, 0x22, 0x00, 0x9b,
+	0xeb, 0xca, 0xba, 0x99, 0x89, 0x80, 0x14, 0x45, 0x33, 0x42, 0x22, 0x21, 0x10, 0x8b, 0xcd, 0xbb,
+	0xca, 0x99, 0x98, 0x01, 0x13, 0x34, 0x31, 0x19, 0xab, 0xbb, 0x99, 0x9a, 0xcc, 0xcb, 0x90, 0x46,
+	0x44, 0x32, 0x10, 0x88, 0x81, 0x11, 0x10, 0x9a, 0xdc, 0xbc, 0xcb, 0xbb, 0xb9, 0x80, 0x21, 0x22,
+	0x34, 0x53, 0x43, 0x21, 0x89, 0xab, 0xba, 0x81, 0x24, 0x43, 0x42, 0x34, 0x34, 0x33, 0x19, 0xee,
+	0xcc, 0xca, 0xb9, 0xa8, 0x02, 0x35, 0x54, 0x33, 0x21, 0x08, 0xaa, 0xab, 0xa9, 0xa9, 0xaa, 0xab,
+	0xbe, 0xaa, 0x81, 0x64, 0x42, 0x19, 0xbe, 0xbb, 0xa8, 0x80, 0x00, 0x12, 0x55, 0x43, 0x20, 0x88,
+	0x01, 0x36, 0x21, 0x9d, 0xdc, 0xbb, 0xa9, 0x80, 0x22, 0x23, 0x22, 0x11, 0x22, 0x18, 0xce, 0xdb,
+	0xba, 0x83, 0x65, 0x33, 0x42, 0x12, 0x23, 0x22, 0x0a, 0xfd, 0xdb, 0xca, 0xa8, 0x81, 0x22, 0x33,
+	0x32, 0x32, 0x20, 0x9c, 0xdb, 0xb8, 0x04, 0x53, 0x42, 0x21, 0x21, 0x22, 0x18, 0xae, 0xdb, 0xcb,
+	0xbb, 0xab, 0xba, 0xa8, 0x14, 0x53, 0x42, 0x10, 0x9b, 0xdd, 0xbc, 0xbb, 0xa8, 0x14, 0x65, 0x43,
+	0x52, 0x31, 0x10, 0x9b, 0xbc, 0xbc, 0xaa, 0xa9, 0x00, 0x34, 0x42, 0x28, 0xad, 0xdc, 0xbb, 0xbb,
+	0x99, 0x01, 0x25, 0x33, 0x43, 0x34, 0x42, 0x33, 0x20, 0x89, 0x89, 0x00, 0x0a, 0xcf, 0xbc, 0xba,
+	0x98, 0x00, 0x80, 0x89, 0x99, 0x9a, 0xa9, 0x17, 0x55, 0x43, 0x22, 0x09, 0xbd, 0xbc, 0xaa, 0x98,
+	0x13, 0x53, 0x43, 0x21, 0x08, 0xaa, 0xcc, 0xca, 0xbb, 0xa9, 0x90, 0x11, 0x35, 0x44, 0x42, 0x31,
+	0x08, 0xba, 0xca, 0xa9, 0x9a, 0x98, 0x02, 0x54, 0x43, 0x33, 0x21, 0x08, 0xaa, 0xca, 0xa9, 0x89,
+	0xcc, 0xdc, 0xcb, 0xab, 0xba, 0xca, 0xa9, 0x81, 0x11, 0x21, 0x11, 0x22, 0x54, 0x44, 0x54, 0x53,
+	0x53, 0x42, 0x10, 0x88, 0x80, 0x88, 0x9c, 0xed, 0xcb, 0xdb, 0xba, 0xa0, 0x25, 0x53, 0x33, 0x21,
+	0x89, 0xab, 0xa9, 0x81, 0x33, 0x41, 0x9b, 0xfc, 0xbb, 0x99, 0x11, 0x33, 0x11, 0x8a, 0xcb, 0xca,
+	0x90, 0x46, 0x53, 0x43, 0x11, 0x99, 0xbc, 0xaa, 0xaa, 0x9a, 0x90, 0x03, 0x54, 0x33, 0x32, 0x20,
+	0x8b, 0xec, 0xcb, 0xa9, 0x02, 0x22, 0x0a, 0xdc, 0xc9, 0x90, 0x12, 0x23, 0x32, 0x31, 0x0c, 0xdc,
+	0xba, 0x83, 0x64, 0x31, 0x0a, 0xcc, 0x98, 0x24, 0x53, 0x42, 0x21, 0x18, 0x08, 0x99, 0x9a, 0x9b,
+	0xbc, 0xcd, 0xbc, 0xba, 0xa9, 0x89, 0xac, 0xcc, 0xba, 0x90, 0x24, 0x44, 0x33, 0x23, 0x23, 0x44,
+	0x43, 0x22, 0x8b, 0xcc, 0xb9, 0x02, 0x52, 0x28, 0xbe, 0xdc, 0xaa, 0xa8, 0x11, 0x22, 0x35, 0x35,
+	0x34, 0x21, 0x0a, 0xcc, 0xca, 0xaa, 0x98, 0x80, 0x11, 0x32, 0x31, 0x09, 0x99, 0x04, 0x54, 0x42,
+	0x20, 0x89, 0x99, 0x98, 0x8b, 0xfd, 0xcc, 0xba, 0x98, 0x02, 0x12, 0x13, 0x34, 0x53, 0x33, 0x10,
+	0x8b, 0xbc, 0xb9, 0x82, 0x44, 0x32, 0x19, 0xbb, 0xa9, 0x89, 0xcd, 0xdc, 0xa8, 0x14, 0x45, 0x23,
+	0x10, 0x99, 0xbc, 0xbb, 0xca, 0xbb, 0xaa, 0x82, 0x55, 0x44, 0x22, 0x21, 0x80, 0x9a, 0xab, 0xca,
+	0xa9, 0x89, 0x9a, 0xbc, 0xb9, 0x80, 0x22, 0x22, 0x46, 0x44, 0x42, 0x08, 0xbe, 0xcb, 0xaa, 0x81,
+	0x22, 0x42, 0x32, 0x32, 0x22, 0x31, 0x08, 0xce, 0xcc, 0xca, 0xb9, 0x98, 0x81, 0x23, 0x54, 0x43,
+	0x33, 0x21, 0x11, 0x08, 0x9b, 0xdb, 0xbb, 0x81, 0x33, 0x18, 0xed, 0xbb, 0x91, 0x44, 0x32, 0x9e,
+	0xdd, 0xbb, 0xaa, 0x90, 0x02, 0x45, 0x44, 0x43, 0x22, 0x19, 0xad, 0xbd, 0xaa, 0xa8, 0x80, 0x23,
+	0x55, 0x33, 0x42, 0x20, 0x9a, 0xab, 0xa9, 0x08, 0x9c, 0xdc, 0xca, 0x90, 0x25, 0x53, 0x32, 0x28,
+	0xad, 0xcd, 0xbd, 0xab, 0xa9, 0x91, 0x14, 0x43, 0x53, 0x43, 0x34, 0x22, 0x00, 0x9b, 0xcd, 0xbc,
+	0xbb, 0xca, 0xba, 0x90, 0x12, 0x54, 0x33, 0x33, 0x33, 0x33, 0x32, 0x19, 0xbf, 0xdc, 0xcb, 0xca,
+	0xba, 0x88, 0x14, 0x35, 0x34, 0x34, 0x22, 0x12, 0x08, 0x9a, 0xcc, 0xcb, 0xca, 0xaa, 0x98, 0x00,
+	0x10, 0x10, 0x11, 0x11, 0x23, 0x23, 0x34, 0x44, 0x34, 0x23, 0x23, 0x22, 0x21, 0x9c, 0xfd, 0xcb,
+	0xca, 0xa9, 0x81, 0x23, 0x43, 0x32, 0x18, 0x8a, 0x99, 0x02, 0x34, 0x21, 0x8b, 0xdc, 0xcb, 0xab,
+	0xaa, 0x80, 0x34, 0x53, 0x32, 0x20, 0x8a, 0xbb, 0xa8, 0x37, 0x54, 0x33, 0x08, 0xaa, 0xc9, 0x98,
+	0x98, 0x99, 0x02, 0x54, 0x32, 0x10, 0x90, 0x02, 0x38, 0xef, 0xfc, 0xbd, 0xbb, 0xaa, 0x98, 0x02,
+	0x45, 0x35, 0x33, 0x43, 0x21, 0x11, 0x88, 0x98, 0x89, 0x9a, 0xdc, 0xbc, 0xca, 0xab, 0xbb, 0xca,
+	0xa8, 0x13, 0x54, 0x42, 0x42, 0x23, 0x22, 0x18, 0x99, 0xaa, 0xa9, 0xbd, 0xdc, 0xcc, 0xa9, 0x98,
+	0x88, 0x00, 0x02, 0x35, 0x44, 0x34, 0x32, 0x33, 0x31, 0x08, 0xcc, 0xdc, 0xbb, 0xaa, 0x88, 0x10,
+	0x08, 0x88, 0x82, 0x44, 0x23, 0x11, 0x01, 0x10, 0x0b, 0xfd, 0xbb, 0xb8, 0x23, 0x53, 0x10, 0x9a,
+	0xa9, 0x14, 0x65, 0x44, 0x23, 0x20, 0xab, 0xea, 0xba, 0x99, 0x9a, 0xa9, 0x82, 0x23, 0x29, 0xbe,
+	0xa8, 0x25, 0x32, 0x8c, 0xdc, 0xba, 0x80, 0x36, 0x43, 0x53, 0x32, 0x10, 0xab, 0xda, 0xa8, 0x88,
+	0x8a, 0xcb, 0xba, 0x88, 0x89, 0xbb, 0xc9, 0x25, 0x54, 0x22, 0x11, 0x08, 0x01, 0x00, 0x10, 0x01,
+	0x13, 0x42, 0x20, 0x88, 0x88, 0xbe, 0xed, 0xbb, 0xa8, 0x13, 0x31, 0x9f, 0xcc, 0xba, 0x81, 0x33,
+	0x33, 0x32, 0x34, 0x53, 0x22, 0x08, 0xbc, 0xdc, 0xbb, 0xb9, 0x81, 0x34, 0x33, 0x22, 0x13, 0x22,
+	0x9d, 0xfd, 0xab, 0x82, 0x46, 0x42, 0x21, 0x89, 0xac, 0xab, 0x99, 0x99, 0x89, 0x80, 0x13, 0x33,
+	0x09, 0xcc, 0xa8, 0x37, 0x44, 0x20, 0x09, 0x9a, 0x98, 0x98, 0xbb, 0xb9, 0x27, 0x73, 0x42, 0x00,
+	0xaa, 0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0xaa, 0xaa, 0x05, 0x66, 0x34, 0x21, 0x09, 0xa9, 0x81, 0x33,
+	0x41, 0x8a, 0xca, 0xaa, 0xac, 0xcd, 0xbc, 0xa8, 0x12, 0x43, 0x33, 0x22, 0x00, 0x8a, 0xcd, 0xbc,
+	0xa8, 0x02, 0x36, 0x34, 0x33, 0x32, 0x22, 0x88, 0x9b, 0xbd, 0xbc, 0xa9, 0x14, 0x64, 0x33, 0x30,
+	0x89, 0xbb, 0xab, 0xbf, 0xcd, 0xcb, 0xba, 0x98, 0x80, 0x08, 0x81, 0x37, 0x53, 0x53, 0x22, 0x20,
+	0x09, 0xac, 0xdb, 0xdb, 0xba, 0x88, 0x12, 0x35, 0x43, 0x43, 0x33, 0x31, 0x8a, 0xdc, 0xcb, 0xda,
+	0xbb, 0xbb, 0x99, 0x01, 0x36, 0x44, 0x43, 0x33, 0x32, 0x11, 0x08, 0xab, 0xec, 0xcc, 0xab, 0xa9,
+	0x88, 0x10, 0x22, 0x34, 0x43, 0x32, 0x18, 0x9a, 0xbb, 0xa9, 0xab, 0xaa, 0xa0, 0x03, 0x45, 0x45,
+	0x53, 0x42, 0x09, 0xcd, 0xca, 0xb9, 0x81, 0x23, 0x33, 0x08, 0xcb, 0xda, 0x82, 0x46, 0x44, 0x33,
+	0x20, 0x8a, 0xec, 0xcb, 0xba, 0x91, 0x34, 0x42, 0x21, 0x88, 0x9a, 0xab, 0xbd, 0xba, 0x82, 0x44,
+	0x43, 0x21, 0x00, 0x99, 0xcb, 0xda, 0x90, 0x35, 0x43, 0x30, 0x9b, 0xdb, 0xc9, 0x90, 0x11, 0x33,
+	0x42, 0x20, 0x8b, 0xdc, 0xca, 0x99, 0x12, 0x45, 0x34, 0x22, 0x09, 0xac, 0xcc, 0xbb, 0xca, 0x90,
+	0x24, 0x53, 0x42, 0x31, 0x20, 0x8a, 0xcc, 0xcb, 0xba, 0x98, 0x01, 0x02, 0x13, 0x34, 0x31, 0x21,
+	0x02, 0x33, 0x19, 0xfe, 0xcb, 0xca, 0xa9, 0x89, 0x81, 0x25, 0x64, 0x44, 0x32, 0x31, 0x08, 0xac,
+	0xeb, 0xdb, 0xaa, 0x80, 0x12, 0x34, 0x33, 0x32, 0x20, 0x9a, 0xbd, 0xbc, 0xaa, 0xaa, 0x88, 0x01,
+	0x13, 0x64, 0x53, 0x52, 0x21, 0x88, 0xba, 0xca, 0xbb, 0xcc, 0xcb, 0xba, 0x98, 0x13, 0x54, 0x44,
+	0x43, 0x31, 0x89, 0xdb, 0xcb, 0x90, 0x12, 0x42, 0x31, 0x09, 0xbd, 0xcb, 0xba, 0x91, 0x44, 0x53,
+	0x32, 0x18, 0xae, 0xcc, 0xab, 0x98, 0x02, 0x35, 0x32, 0x32, 0x20, 0x89, 0xac, 0xbc, 0xa9, 0x81,
+	0x22, 0x32, 0x31, 0x09, 0xbc, 0xbc, 0xa8, 0x12, 0x34, 0x32, 0x9d, 0xed, 0xcb, 0xb9, 0x04, 0x44,
+	0x42, 0x31, 0x20, 0x08, 0xab, 0xec, 0xbb, 0xa8, 0x81, 0x11, 0x10, 0x80, 0x23, 0x64, 0x42, 0x31,
+	0x10, 0x9c, 0xdd, 0xbc, 0xba, 0x90, 0x15, 0x43, 0x43, 0x31, 0x89, 0xbc, 0xdb, 0xbb, 0xba, 0x90,
+	0x24, 0x53, 0x43, 0x32, 0x11, 0x11, 0x08, 0x9c, 0xcc, 0xcb, 0xbb, 0x99, 0x80, 0x23, 0x55, 0x34,
+	0x22, 0x09, 0xac, 0xcc, 0xba, 0xb9, 0x90, 0x13, 0x35, 0x23, 0x32, 0x22, 0x33, 0x22, 0x19, 0xbf,
+	0xcc, 0xab, 0x99, 0x80, 0x12, 0x32, 0x21, 0x9d, 0xcc, 0xa9, 0x26, 0x55, 0x33, 0x20, 0x8c, 0xcd,
+	0xbb, 0xc9, 0x98, 0x13, 0x44, 0x43, 0x33, 0x18, 0x9b, 0xeb, 0xbc, 0xa9, 0x88, 0x11, 0x11, 0x21,
+	0x22, 0x23, 0x42, 0x22, 0x08, 0xbc, 0xdb, 0xba, 0x88, 0x24, 0x35, 0x35, 0x33, 0x33, 0x18, 0xce,
+	0xdc, 0xca, 0xb9, 0x98, 0x12, 0x34, 0x43, 0x33, 0x42, 0x11, 0x89, 0xbd, 0xbc, 0xaa, 0x98, 0x81,
+	0x32, 0x43, 0x24, 0x22, 0x30, 0x8b, 0xfd, 0xcb, 0xab, 0x99, 0x80, 0x01, 0x35, 0x34, 0x32, 0x21,
+	0x12, 0x34, 0x43, 0x19, 0xce, 0xbd, 0xaa, 0x98, 0x01, 0x23, 0x44, 0x35, 0x22, 0x20, 0x8b, 0xdd,
+	0xcb, 0xcb, 0xaa, 0x90, 0x14, 0x44, 0x44, 0x22, 0x20, 0x8a, 0xbd, 0xbc, 0xba, 0xb9, 0x90, 0x23,
+	0x53, 0x43, 0x32, 0x11, 0x10, 0x00, 0x00, 0x89, 0xbb, 0xeb, 0xdb, 0xcb, 0xbb, 0xba, 0x90, 0x23,
+	0x44, 0x34, 0x35, 0x33, 0x32, 0x08, 0xac, 0xbb, 0xb9, 0x99, 0xac, 0xdb, 0xa8, 0x13, 0x73, 0x43,
+	0x22, 0x18, 0x9b, 0xdc, 0xbc, 0xaa, 0x88, 0x11, 0x22, 0x35, 0x23, 0x33, 0x10, 0xab, 0xec, 0xbb,
+	0xca, 0x80, 0x23, 0x33, 0x20, 0x80, 0x26, 0x43, 0x29, 0xce, 0xcb, 0xa9, 0x00, 0x21, 0x10, 0x02,
+	0x55, 0x43, 0x32, 0x11, 0x88, 0x9a, 0xcc, 0xdc, 0xbb, 0xa9, 0x81, 0x13, 0x33, 0x22, 0x08, 0xac,
+	0xdb, 0xca, 0xa0, 0x15, 0x44, 0x33, 0x32, 0x22, 0x34, 0x22, 0x09, 0xab, 0xec, 0xec, 0xcb, 0xa0,
+	0x37, 0x45, 0x33, 0x42, 0x22, 0x11, 0x08, 0x9a, 0xab, 0xbd, 0xcd, 0xcc, 0xbb, 0xbb, 0xba, 0x9a,
+	0x88, 0x02, 0x22, 0x11, 0x08, 0x88, 0x12, 0x46, 0x44, 0x53, 0x54, 0x23, 0x21, 0x10, 0x08, 0x00,
+	0x00, 0x00, 0x08, 0x8a, 0xcc, 0xcb, 0xca, 0xbc, 0xcd, 0xbd, 0xbb, 0xca, 0xaa, 0x99, 0x80, 0x12,
+	0x34, 0x34, 0x33, 0x34, 0x43, 0x43, 0x34, 0x34, 0x33, 0x34, 0x21, 0x10, 0x88, 0xaa, 0xbc, 0xbb,
+	0xab, 0xbc, 0xdd, 0xcd, 0xcb, 0xcb, 0xba, 0xb9, 0x99, 0x88, 0x81, 0x24, 0x54, 0x43, 0x33, 0x34,
+	0x33, 0x43, 0x22, 0x20, 0x08, 0x00, 0x12, 0x23, 0x22, 0x9b, 0xfe, 0xcb, 0xda, 0xbb, 0xbc, 0xbb,
+	0xca, 0xba, 0x88, 0x12, 0x22, 0x22, 0x23, 0x53, 0x54, 0x33, 0x34, 0x34, 0x34, 0x43, 0x44, 0x22,
+	0x00, 0xab, 0xcc, 0xbb, 0xaa, 0xaa, 0xa9, 0xa8, 0x01, 0x21, 0x0b, 0xff, 0xdb, 0xcb, 0xaa, 0xa9,
+	0x88, 0x00, 0x24, 0x45, 0x43, 0x43, 0x43, 0x33, 0x33, 0x22, 0x89, 0xad, 0xbb, 0xcb, 0xbb, 0xc9,
+	0x99, 0x88, 0x9a, 0xcc, 0xbc, 0xbb, 0xcb, 0xba, 0xba, 0x81, 0x23, 0x43, 0x34, 0x45, 0x54, 0x33,
+	0x42, 0x21, 0x11, 0x01, 0x88, 0x88, 0x90, 0x02, 0x33, 0x11, 0x9b, 0xcd, 0xcc, 0xdd, 0xbd, 0xbc,
+	0xab, 0xba, 0xba, 0xba, 0x98, 0x12, 0x45, 0x34, 0x43, 0x42, 0x42, 0x23, 0x22, 0x32, 0x21, 0x22,
+	0x22, 0x33, 0x21, 0x8b, 0xed, 0xcc, 0xba, 0xbb, 0xcc, 0xbd, 0xbb, 0xcb, 0xbb, 0xbb, 0xba, 0x90,
+	0x25, 0x43, 0x43, 0x33, 0x33, 0x24, 0x33, 0x63, 0x53, 0x43, 0x33, 0x34, 0x21, 0x18, 0x8b, 0xdc,
+	0xbd, 0xbb, 0xcb, 0xba, 0xbb, 0xaa, 0xa9, 0xaa, 0xaa, 0xbb, 0xca, 0xa8, 0x14, 0x74, 0x44, 0x33,
+	0x43, 0x23, 0x33, 0x33, 0x32, 0x32, 0x32, 0x22, 0x08, 0xcd, 0xdc, 0xbd, 0xbc, 0xbc, 0xbb, 0xbc,
+	0xba, 0xab, 0x9a, 0x89, 0x80, 0x12, 0x44, 0x54, 0x43, 0x43, 0x42, 0x22, 0x11, 0x01, 0x22, 0x33,
+	0x23, 0x10, 0x09, 0xab, 0xde, 0xdc, 0xcb, 0xbc, 0xa9, 0x98, 0x98, 0x89, 0x99, 0xaa, 0xbc, 0xbb,
+	0xbb, 0xa8, 0x03, 0x66, 0x44, 0x44, 0x23, 0x23, 0x22, 0x34, 0x33, 0x42, 0x11, 0x09, 0xac, 0xcc,
+	0xcb, 0xbb, 0xbc, 0xaa, 0xba, 0xab, 0xcb, 0xcb, 0xdb, 0xbb, 0xbb, 0xa9, 0x82, 0x45, 0x54, 0x43,
+	0x53, 0x34, 0x33, 0x22, 0x21, 0x08, 0x99, 0xbb, 0xdc, 0xbb, 0xca, 0xa8, 0x98, 0x89, 0xab, 0xdc,
+	0xcd, 0xbc, 0xba, 0xba, 0x98, 0x12, 0x44, 0x43, 0x42, 0x42, 0x23, 0x32, 0x32, 0x33, 0x23, 0x11,
+	0x88, 0x80, 0x34, 0x33, 0x9e, 0xed, 0xcc, 0xab, 0xca, 0xba, 0xaa, 0x88, 0x01, 0x10, 0x9a, 0xba,
+	0x92, 0x55, 0x44, 0x23, 0x42, 0x32, 0x33, 0x33, 0x43, 0x34, 0x34, 0x23, 0x23, 0x21, 0x8c, 0xed,
+	0xcc, 0xbc, 0xba, 0x9a, 0x99, 0x9a, 0xab, 0x9a, 0x80, 0x23, 0x43, 0x63, 0x43, 0x43, 0x21, 0x08,
+	0x98, 0x02, 0x55, 0x44, 0x35, 0x23, 0x21, 0x08, 0xac, 0xcc, 0xbc, 0xab, 0xa9, 0x98, 0x08, 0x08,
+	0xab, 0xcd, 0xbb, 0xcb, 0xaa, 0x81, 0x35, 0x44, 0x23, 0x22, 0x23, 0x53, 0x43, 0x43, 0x34, 0x33,
+	0x20, 0x9b, 0xdc, 0xba, 0xa9, 0x01, 0x00, 0x8a, 0xce, 0xcc, 0xbc, 0xbb, 0xba, 0xa8, 0x00, 0x11,
+	0x12, 0x23, 0x44, 0x44, 0x42, 0x32, 0x32, 0x13, 0x35, 0x35, 0x34, 0x23, 0x31, 0x18, 0xbe, 0xcc,
+	0xbb, 0xbb, 0xaa, 0xaa, 0xbb, 0xcc, 0xab, 0xca, 0x9a, 0x88, 0x12, 0x35, 0x34, 0x34, 0x33, 0x22,
+	0x21, 0x24, 0x64, 0x53, 0x52, 0x33, 0x12, 0x08, 0x9a, 0xbe, 0xbc, 0xbc, 0xbb, 0xab, 0x9a, 0x9a,
+	0xad, 0xcc, 0xca, 0xa9, 0x91, 0x25, 0x35, 0x42, 0x32, 0x20, 0x08, 0x98, 0x80, 0x34, 0x53, 0x53,
+	0x43, 0x21, 0x8a, 0xbe, 0xcb, 0xbb, 0xba, 0x99, 0x88, 0x01, 0x80, 0xac, 0xcd, 0xcb, 0xba, 0xa8,
+	0x81, 0x35, 0x43, 0x43, 0x43, 0x33, 0x43, 0x34, 0x12, 0x00, 0x80, 0x80, 0x80, 0x99, 0xbc, 0xcb,
+	0xcb, 0xcb, 0xdc, 0xcc, 0xbc, 0xab, 0x98, 0x01, 0x11, 0x22, 0x33, 0x32, 0x10, 0x88, 0x13, 0x55,
+	0x45, 0x45, 0x43, 0x31, 0x0b, 0xeb, 0xca, 0xa8, 0x00, 0x11, 0x22, 0x34, 0x21, 0x08, 0xab, 0xcc,
+	0xbb, 0xca, 0x98, 0x13, 0x44, 0x42, 0x11, 0x08, 0xab, 0xcd, 0xab, 0x98, 0x12, 0x53, 0x42, 0x21,
+	0x88, 0xab, 0xbc, 0xba, 0xba, 0xa9, 0x89, 0x01, 0x25, 0x53, 0x53, 0x33, 0x33, 0x21, 0x8b, 0xfc,
+	0xbc, 0x98, 0x13, 0x53, 0x20, 0x8a, 0xbc, 0xa9, 0x01, 0x34, 0x33, 0x20, 0xbe, 0xdc, 0xbc, 0xaa,
+	0x98, 0x11, 0x34, 0x42, 0x10, 0x8b, 0xaa, 0x83, 0x65, 0x43, 0x32, 0x18, 0xad, 0xcc, 0xbb, 0x99,
+	0x12, 0x54, 0x33, 0x21, 0x08, 0xbd, 0xcc, 0xcb, 0xca, 0xa8, 0x01, 0x24, 0x43, 0x42, 0x22, 0x08,
+	0xaa, 0xba, 0x92, 0x45, 0x34, 0x31, 0x18, 0xbd, 0xcd, 0xbb, 0xaa, 0x00, 0x33, 0x34, 0x22, 0x22,
+	0x11, 0x8a, 0xbd, 0xca, 0x98, 0x13, 0x23, 0x21, 0x9b, 0xdd, 0xbb, 0x90, 0x45, 0x53, 0x21, 0x8a,
+	0xcc, 0xbb, 0xa9, 0x80, 0x24, 0x43, 0x32, 0x18, 0x9b, 0xaa, 0x82, 0x34, 0x20, 0x9c, 0xbb, 0xba,
+	0xaa, 0xa9, 0x27, 0x64, 0x42, 0x28, 0x9b, 0xdb, 0xbb, 0xdc, 0xcb, 0xda, 0x98, 0x14, 0x54, 0x34,
+	0x22, 0x20, 0x8a, 0xcc, 0xca, 0xa9, 0x11, 0x34, 0x34, 0x21, 0x08, 0xac, 0xdc, 0xba, 0x91, 0x24,
+	0x52, 0x21, 0x09, 0xac, 0xdb, 0xba, 0xa8, 0x14, 0x53, 0x42, 0x20, 0x00, 0x98, 0x89, 0x98, 0x98,
+	0x80, 0x00, 0x9d, 0xdd, 0xcb, 0xba, 0x80, 0x12, 0x34, 0x33, 0x43, 0x33, 0x08, 0xac, 0xcb, 0xa8,
+	0x12, 0x44, 0x33, 0x32, 0x19, 0xad, 0xdb, 0xcb, 0xaa, 0x98, 0x88, 0x89, 0x88, 0x03, 0x64, 0x43,
+	0x34, 0x22, 0x31, 0x0a, 0xec, 0xda, 0xa0, 0x13, 0x44, 0x21, 0x80, 0x89, 0xab, 0xed, 0xbc, 0xa8,
+	0x04, 0x43, 0x42, 0x20, 0x08, 0x89, 0x98, 0x98, 0x11, 0x33, 0x18, 0xbd, 0xca, 0xaa, 0xac, 0xcb,
+	0xaa, 0x98, 0x99, 0xdb, 0xda, 0x90, 0x25, 0x53, 0x34, 0x32, 0x08, 0xad, 0xcb, 0xa8, 0x15, 0x43,
+	0x20, 0x9e, 0xcc, 0xbb, 0xa8, 0x02, 0x44, 0x53, 0x53, 0x33, 0x22, 0x89, 0x9a, 0x81, 0x45, 0x43,
+	0x30, 0x8c, 0xcc, 0xcc, 0xab, 0xab, 0xaa, 0x9a, 0x99, 0xaa, 0xbc, 0xaa, 0x81, 0x24, 0x44, 0x33,
+	0x43, 0x34, 0x33, 0x34, 0x43, 0x44, 0x33, 0x33, 0x22, 0x01, 0x8a, 0xbe, 0xdc, 0xbd, 0xbc, 0xaa,
+	0xa9, 0x9a, 0x99, 0x80, 0x12, 0x21, 0x0b, 0xdc, 0xaa, 0x82, 0x25, 0x43, 0x54, 0x35, 0x33, 0x33,
+	0x33, 0x22, 0x11, 0x09, 0xab, 0xcb, 0xbb, 0xbb, 0xdb, 0xcc, 0xcb, 0xcd, 0xbc, 0xca, 0xba, 0xa9,
+	0x98, 0x01, 0x24, 0x43, 0x33, 0x21, 0x10, 0x22, 0x53, 0x54, 0x34, 0x43, 0x43, 0x22, 0x18, 0x88,
+	0xaa, 0xac, 0xbe, 0xbc, 0xca, 0xbb, 0xaa, 0xba, 0xaa, 0xa9, 0x08, 0x09, 0xab, 0xcc, 0xa9, 0x02,
+	0x54, 0x44, 0x35, 0x44, 0x35, 0x33, 0x43, 0x21, 0x10, 0x9a, 0xbe, 0xbc, 0xab, 0xb9, 0xa9, 0x89,
+	0x89, 0xab, 0xcc, 0xcb, 0xbb, 0xaa, 0x80, 0x14, 0x43, 0x53, 0x23, 0x23, 0x24, 0x43, 0x63, 0x43,
+	0x23, 0x10, 0x89, 0xab, 0xbc, 0xab, 0xab, 0xcb, 0xcc, 0xbc, 0xbb, 0xbd, 0xab, 0xaa, 0x89, 0x00,
+	0x08, 0x98, 0x81, 0x45, 0x54, 0x35, 0x35, 0x33, 0x42, 0x33, 0x23, 0x21, 0x08, 0xab, 0xcc, 0xbb,
+	0xcb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcb, 0xca, 0xaa, 0x88, 0x02, 0x34, 0x44, 0x33, 0x32,
+	0x21, 0x01, 0x12, 0x35, 0x43, 0x34, 0x23, 0x32, 0x32, 0x21, 0x08, 0x88, 0x89, 0xce, 0xfc, 0xcc,
+	0xcb, 0xbb, 0xba, 0xa9, 0x01, 0x23, 0x33, 0x31, 0x08, 0xaa, 0xbc, 0x98, 0x37, 0x73, 0x54, 0x33,
+	0x33, 0x22, 0x22, 0x08, 0x9b, 0xbd, 0xbb, 0xbb, 0xbc, 0xab, 0xcb, 0xcc, 0xcb, 0xcc, 0xbb, 0xbc,
+	0xa9, 0x98, 0x12, 0x44, 0x23, 0x33, 0x43, 0x35, 0x34, 0x33, 0x53, 0x34, 0x34, 0x22, 0x10, 0x99,
+	0xbb, 0xcc, 0xac, 0xab, 0xcb, 0xbd, 0xbb, 0xcb, 0xca, 0xba, 0x99, 0x90, 0x02, 0x34, 0x42, 0x33,
+	0x42, 0x33, 0x53, 0x53, 0x34, 0x42, 0x32, 0x32, 0x21, 0x18, 0xac, 0xcc, 0xcb, 0xcb, 0xbc, 0xaa,
+	0xaa, 0xa9, 0xbb, 0xcc, 0xbc, 0xaa, 0x98, 0x12, 0x44, 0x53, 0x53, 0x33, 0x32, 0x21, 0x11, 0x23,
+	0x44, 0x42, 0x32, 0x10, 0x8a, 0xab, 0xcb, 0xcb, 0xcb, 0xcb, 0xcc, 0xcc, 0xbc, 0xbb, 0xca, 0xaa,
+	0x88, 0x01, 0x22, 0x23, 0x43, 0x34, 0x23, 0x43, 0x54, 0x43, 0x43, 0x42, 0x42, 0x32, 0x21, 0x08,
+	0xbb, 0xeb, 0xbc, 0xbb, 0xcb, 0xcb, 0xab, 0xca, 0xab, 0xba, 0xa9, 0x90, 0x10, 0x10, 0x01, 0x37,
+	0x55, 0x34, 0x43, 0x33, 0x34, 0x33, 0x21, 0x10, 0x88, 0x88, 0x01, 0x09, 0xbd, 0xcd, 0xbc, 0xbc,
+	0xcb, 0xdb, 0xcb, 0xbb, 0xab, 0xa9, 0x88, 0x11, 0x23, 0x44, 0x43, 0x53, 0x43, 0x34, 0x23, 0x23,
+	0x34, 0x34, 0x42, 0x32, 0x22, 0x08, 0xac, 0xdc, 0xcb, 0xcb, 0xbb, 0xca, 0xaa, 0xba, 0xaa, 0x99,
+	0x80, 0x01, 0x01, 0x12, 0x35, 0x33, 0x42, 0x44, 0x54, 0x53, 0x53, 0x23, 0x33, 0x22, 0x10, 0x9a,
+	0xbd, 0xcc, 0xbc, 0xab, 0xbb, 0xba, 0xbb, 0xcb, 0xcb, 0xbb, 0xb9, 0x00, 0x22, 0x34, 0x34, 0x45,
+	0x43, 0x43, 0x43, 0x33, 0x43, 0x34, 0x21, 0x11, 0x88, 0x89, 0x99, 0xbd, 0xcb, 0xdc, 0xbc, 0xca,
+	0xab, 0xa9, 0x99, 0x99, 0x9a, 0xab, 0xbc, 0xbb, 0xaa, 0x83, 0x66, 0x44, 0x34, 0x42, 0x32, 0x33,
+	0x23, 0x22, 0x33, 0x21, 0x08, 0xaa, 0xa9, 0xbb, 0xfd, 0xdc, 0xbd, 0xba, 0xbb, 0xbb, 0xab, 0xaa,
+	0xba, 0x99, 0x90, 0x11, 0x22, 0x25, 0x55, 0x54, 0x44, 0x34, 0x33, 0x33, 0x32, 0x10, 0x89, 0xab,
+	0xcb, 0xbb, 0xcb, 0xca, 0xba, 0xca, 0xcc, 0xbb, 0xda, 0xbb, 0xbd, 0xab, 0xba, 0xa8, 0x81, 0x36,
+	0x35, 0x43, 0x34, 0x34, 0x23, 0x33, 0x32, 0x22, 0x10, 0x00, 0x8a, 0xab, 0xcb, 0xbb, 0xcc, 0xcd,
+	0xcc, 0xcb, 0xcb, 0xca, 0xba, 0xa9, 0x00, 0x23, 0x23, 0x12, 0x12, 0x23, 0x43, 0x54, 0x45, 0x35,
+	0x34, 0x33, 0x33, 0x33, 0x11, 0x08, 0xab, 0xdb, 0xdb, 0xbc, 0xbc, 0xbc, 0xcb, 0xbc, 0xbb, 0xba,
+	0xba, 0x98, 0x01, 0x21, 0x22, 0x55, 0x54, 0x34, 0x23, 0x35, 0x43, 0x31, 0x9b, 0xec, 0xa9, 0x80,
+	0x01, 0x88, 0x99, 0x90, 0x00, 0x88, 0x99, 0x02, 0x34, 0x23, 0x11, 0x23, 0x33, 0x30, 0xaf, 0xdc,
+	0xcb, 0xbb, 0xaa, 0xa9, 0x01, 0x37, 0x44, 0x34, 0x12, 0x00, 0x88, 0x00, 0x88, 0x9a, 0xbc, 0xbc,
+	0xba, 0xa9, 0x81, 0x13, 0x21, 0x89, 0xbc, 0x99, 0x80, 0x11, 0x13, 0x65, 0x64, 0x35, 0x21, 0x10,
+	0x9a, 0xcb, 0xdb, 0xdb, 0xcc, 0xaa, 0xa9, 0x00, 0x34, 0x44, 0x34, 0x22, 0x10, 0x08, 0x89, 0xa9,
+	0xbb, 0xbd, 0xba, 0x90, 0x12, 0x44, 0x33, 0x44, 0x43, 0x21, 0x8a, 0xcd, 0xbb, 0xba, 0xa9, 0x80,
+	0x44, 0x54, 0x21, 0x19, 0xab, 0xbc, 0xbb, 0xcc, 0xbb, 0xb9, 0x03, 0x54, 0x34, 0x22, 0x23, 0x22,
+	0x8b, 0xed, 0xcb, 0xb9, 0x91, 0x36, 0x44, 0x33, 0x43, 0x11, 0x89, 0xbd, 0xbd, 0xab, 0xba, 0xba,
+	0xbb, 0x99, 0x12, 0x33, 0x31, 0x00, 0x14, 0x54, 0x33, 0x22, 0x12, 0x44, 0x34, 0x33, 0x34, 0x54,
+	0x43, 0x33, 0x20, 0x8a, 0xbc, 0xdc, 0xcb, 0xdb, 0xbb, 0xba, 0x99, 0x88, 0x12, 0x43, 0x23, 0x11,
+	0x01, 0x11, 0x22, 0x11, 0x01, 0x01, 0x11, 0x23, 0x66, 0x55, 0x34, 0x33, 0x10, 0x9c, 0xcd, 0xcb,
+	0xbb, 0xb9, 0x80, 0x22, 0x33, 0x34, 0x34, 0x44, 0x22, 0x01, 0x01, 0x45, 0x44, 0x22, 0x19, 0xbd,
+	0xbd, 0xab, 0xcb, 0xcb, 0xcb, 0xa8, 0x02, 0x54, 0x42, 0x33, 0x32, 0x11, 0x8a, 0xcd, 0xbb, 0xcb,
+	0xa9, 0x80, 0x24, 0x34, 0x33, 0x00, 0x9a, 0xa9, 0x81, 0x34, 0x42, 0x22, 0x21, 0x89, 0xce, 0xcb,
+	0xbb, 0xa8, 0x81, 0x01, 0x11, 0x23, 0x33, 0x0c, 0xfc, 0xcb, 0xa9, 0x12, 0x44, 0x34, 0x23, 0x23,
+	0x21, 0x89, 0xcd, 0xcc, 0xbb, 0xca, 0xba, 0xaa, 0x82, 0x46, 0x44, 0x34, 0x23, 0x21, 0x10, 0x09,
+	0x9b, 0xdb, 0xbb, 0xba, 0xbb, 0xbc, 0xbb, 0xa9, 0x80, 0x22, 0x45, 0x54, 0x42, 0x31, 0x8a, 0xab,
+	0xb9, 0x80, 0x8a, 0xbc, 0xa8, 0x13, 0x30, 0xce, 0xcb, 0x98, 0x11, 0x8c, 0xec, 0xbb, 0x91, 0x35,
+	0x33, 0x10, 0x08, 0x13, 0x44, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x31, 0x9d, 0xec, 0xcb,
+	0xca, 0xbb, 0xab, 0xba, 0x81, 0x36, 0x44, 0x22, 0x21, 0x08, 0x9b, 0xcc, 0xbb, 0xa9, 0x13, 0x54,
+	0x33, 0x31, 0x10, 0x88, 0xab, 0xcb, 0xbb, 0xba, 0xaa, 0xcd, 0xcb, 0xcb, 0xba, 0x98, 0x24, 0x54,
+	0x43, 0x33, 0x32, 0x00, 0x99, 0x99, 0x03, 0x54, 0x32, 0x19, 0xbd, 0xca, 0x99, 0x9a, 0xb9, 0x85,
+	0x64, 0x41, 0x8b, 0xeb, 0xbb, 0x88, 0x10, 0x8a, 0xbb, 0xaa, 0x90, 0x12, 0x75, 0x45, 0x43, 0x21,
+	0x08, 0xab, 0xbc, 0xaa, 0x99, 0x88, 0x02, 0x45, 0x34, 0x22, 0x09, 0xbd, 0xbd, 0xaa, 0x80, 0x12,
+	0x22, 0x21, 0x32, 0x32, 0x8c, 0xfd, 0xbb, 0xbb, 0x89, 0x89, 0xbb, 0xa8, 0x37, 0x75, 0x32, 0x21,
+	0x88, 0x99, 0x88, 0x89, 0xab, 0xbb, 0x90, 0x23, 0x22, 0x89, 0x88, 0x9d, 0xff, 0xcc, 0xaa, 0x90,
+	0x24, 0x33, 0x43, 0x23, 0x11, 0x08, 0x99, 0x90, 0x34, 0x20, 0xbf, 0xfa, 0xb9, 0x81, 0x25, 0x33,
+	0x33, 0x23, 0x10, 0xac, 0xec, 0xcb, 0xaa, 0x90, 0x12, 0x23, 0x32, 0x21, 0x10, 0x89, 0xbb, 0xcc,
+	0xaa, 0xab, 0x99, 0x16, 0x54, 0x44, 0x22, 0x22, 0x33, 0x33, 0x29, 0xde, 0xcb, 0xcb, 0xaa, 0x9a,
+	0x80, 0x12, 0x43, 0x43, 0x32, 0x18, 0x8b, 0xdc, 0xbd, 0xbb, 0xbb, 0x98, 0x01, 0x25, 0x44, 0x43,
+	0x33, 0x31, 0x18, 0x9a, 0xbc, 0xbc, 0xaa, 0x81, 0x11, 0x9e, 0xfc, 0xcb, 0xc9, 0x91, 0x12, 0x33,
+	0x43, 0x53, 0x44, 0x42, 0x32, 0x11, 0x11, 0x21, 0x32, 0x18, 0xad, 0xec, 0xcb, 0xcb, 0xbb, 0xab,
+	0xa9, 0x98, 0x80, 0x12, 0x23, 0x34, 0x33, 0x43, 0x33, 0x21, 0x89, 0x99, 0x88, 0x13, 0x37, 0x54,
+	0x53, 0x42, 0x08, 0xbe, 0xbc, 0xbb, 0xba, 0xba, 0x81, 0x26, 0x43, 0x34, 0x21, 0x10, 0x10, 0x11,
+	0x11, 0x08, 0xaa, 0xbb, 0x90, 0x00, 0x9c, 0xec, 0xbc, 0xab, 0xa9, 0xa9, 0x02, 0x35, 0x33, 0x33,
+	0x45, 0x34, 0x30, 0xbf, 0xeb, 0xba, 0x81, 0x23, 0x31, 0x99, 0xba, 0x98, 0x89, 0xbd, 0xcb, 0xba,
+	0x98, 0x15, 0x75, 0x44, 0x33, 0x32, 0x10, 0x88, 0xab, 0xdd, 0xcb, 0xbb, 0xa8, 0x01, 0x11, 0x01,
+	0x23, 0x63, 0x32, 0x19, 0xbc, 0xca, 0xb9, 0xbb, 0xbd, 0xaa, 0x05, 0x55, 0x43, 0x42, 0x10, 0x88,
+	0x9a, 0xab, 0xbd, 0xbb, 0xaa, 0xa8, 0x89, 0x89, 0x9a, 0xbb, 0xcc, 0xab, 0xa9, 0x9a, 0xab, 0xd9,
+	0x05, 0x77, 0x35, 0x42, 0x33, 0x21, 0x20, 0x08, 0x99, 0xbb, 0xcc, 0xcb, 0xbd, 0xaa, 0xa9, 0x9a,
+	0xac, 0xbb, 0x98, 0x14, 0x43, 0x32, 0x11, 0x01, 0x01, 0x01, 0x34, 0x63, 0x54, 0x23, 0x22, 0x10,
+	0x9a, 0xcc, 0xcc, 0xbb, 0xc9, 0x90, 0x02, 0x10, 0x8a, 0xbb, 0xa8, 0x00, 0x89, 0x98, 0x47, 0x75,
+	0x32, 0x31, 0x08, 0x9a, 0xaa, 0xbc, 0xab, 0x98, 0x02, 0x31, 0x8c, 0xdc, 0xca, 0xaa, 0x88, 0x01,
+	0x55, 0x44, 0x42, 0x21, 0x8a, 0xbc, 0xcc, 0xbb, 0xba, 0xa0, 0x24, 0x43, 0x21, 0x10, 0x88, 0x89,
+	0xac, 0xa9, 0x26, 0x63, 0x43, 0x20, 0x08, 0xa9, 0xab, 0xbc, 0xba, 0xba, 0xaa, 0xaa, 0x88, 0x00,
+	0x8a, 0xcc, 0xba, 0x80, 0x36, 0x45, 0x34, 0x32, 0x11, 0x88, 0x80, 0x80, 0x89, 0x98, 0x45, 0x63,
+	0x41, 0x08, 0xac, 0xdb, 0xdb, 0xcb, 0xba, 0x98, 0x01, 0x33, 0x63, 0x53, 0x33, 0x28, 0x9c, 0xcc,
+	0xca, 0xaa, 0x98, 0x01, 0x36, 0x43, 0x42, 0x11, 0x89, 0xbb, 0xcb, 0xca, 0xa8, 0x14, 0x45, 0x33,
+	0x21, 0x8a, 0xab, 0xbc, 0xcb, 0xca, 0x98, 0x23, 0x52, 0x20, 0x9b, 0xdb, 0xca, 0x98, 0x03, 0x64,
+	0x34, 0x32, 0x20, 0x9b, 0xdc, 0xbb, 0xbb, 0x81, 0x25, 0x42, 0x32, 0x10, 0x8a, 0xbe, 0xbc, 0xba,
+	0x80, 0x43, 0x42, 0x22, 0x00, 0x00, 0x9a, 0xcc, 0xba, 0x81, 0x24, 0x21, 0x08, 0x88, 0x13, 0x18,
+	0xde, 0xcb, 0xb9, 0x00, 0x12, 0x14, 0x44, 0x43, 0x21, 0xab, 0xdb, 0xa8, 0x98, 0xab, 0xdb, 0x91,
+	0x45, 0x21, 0x8b, 0xca, 0x04, 0x44, 0x21, 0x89, 0x01, 0x33, 0x28, 0xcc, 0xb9, 0x81, 0x19, 0xcd,
+	0xba, 0x81, 0x21, 0x88, 0x91, 0x65, 0x33, 0x2a, 0xcd, 0xb9, 0x82, 0x42, 0x21, 0x88, 0x80, 0x00,
+	0x9d, 0xdb, 0xba, 0x81, 0x23, 0x45, 0x53, 0x41, 0x0b, 0xdc, 0xca, 0x99, 0x81, 0x12, 0x44, 0x43,
+	0x11, 0x9b, 0xdb, 0xca, 0xa9, 0x91, 0x14, 0x43, 0x43, 0x20, 0x08, 0xab, 0xcc, 0xaa, 0x81, 0x24,
+	0x41, 0x19, 0xac, 0xba, 0xab, 0xbd, 0xbc, 0x90, 0x55, 0x33, 0x30, 0x88, 0x81, 0x00, 0xad, 0xca,
+	0x91, 0x35, 0x31, 0x89, 0x80, 0x00, 0x9d, 0xdb, 0xa1, 0x36, 0x31, 0x09, 0x99, 0x00, 0x09, 0xcf,
+	0xbb, 0x91, 0x44, 0x32, 0x0a, 0xcb, 0xa9, 0x00, 0x00, 0x90, 0x05, 0x54, 0x22, 0x19, 0xac, 0xcb,
+	0xba, 0x91, 0x37, 0x32, 0x10, 0x08, 0x81, 0x28, 0xbf, 0xda, 0x91, 0x25, 0x22, 0x08, 0xab, 0xcb,
+	0xcc, 0xab, 0x90, 0x36, 0x33, 0x33, 0x11, 0x08, 0xab, 0xec, 0xaa, 0x91, 0x34, 0x43, 0x22, 0x09,
+	0x90,
+};
+
+static const unsigned char sndbank_noise[4097] = {
+	0xff, 0xff, 0xff, 0xfe, 0x74, 0x19, 0xbb, 0xa9, 0x23, 0x42, 0x19, 0xca, 0xba, 0x88, 0x80, 0x13,
+	0x55, 0x33, 0x09, 0xec, 0xba, 0x80, 0x23, 0x18, 0xaa, 0x81, 0x64, 0x33, 0x00, 0x90, 0x24, 0x30,
+	0xbf, 0xdb, 0x91, 0x25, 0x21, 0x99, 0xa9, 0x03, 0x42, 0x9d, 0xdb, 0xa0, 0x24, 0x31, 0x8c, 0xba,
+	0x15, 0x44, 0x19, 0xab, 0xa0, 0x44, 0x31, 0x8c, 0xdb, 0xa8, 0x02, 0x18, 0x9a, 0xb9, 0x03, 0x42,
+	0x09, 0xca, 0x02, 0x63, 0x29, 0xce, 0xbc, 0xa9, 0x00, 0x24, 0x36, 0x33, 0x32, 0x8b, 0xdc, 0xb9,
+	0x01, 0x34, 0x20, 0x9b, 0xcb, 0xaa, 0x98, 0x81, 0x26, 0x53, 0x31, 0x8d, 0xdb, 0x98, 0x44, 0x43,
+	0x20, 0x9a, 0xaa, 0xa9, 0xac, 0xbb, 0x81, 0x54, 0x22, 0x99, 0xbb, 0x80, 0x21, 0x8c, 0xbc, 0x82,
+	0x54, 0x30, 0x9b, 0xc9, 0x12, 0x38, 0xcf, 0xca, 0x81, 0x33, 0x18, 0xbb, 0x83, 0x74, 0x28, 0xac,
+	0xc9, 0x82, 0x23, 0x10, 0x89, 0x81, 0x22, 0x30, 0x09, 0x88, 0x09, 0xee, 0xda, 0xa0, 0x26, 0x32,
+	0x0a, 0xcc, 0xa9, 0x88, 0x88, 0x01, 0x45, 0x42, 0x09, 0xba, 0x83, 0x54, 0x10, 0xa9, 0x03, 0x63,
+	0x1a, 0xce, 0xa9, 0x13, 0x31, 0x8d, 0xcc, 0x98, 0x14, 0x42, 0x18, 0x8a, 0xba, 0xbc, 0xba, 0xb8,
+	0x23, 0x31, 0xad, 0xb8, 0x56, 0x43, 0x10, 0xab, 0xa9, 0x12, 0x09, 0xbc, 0x92, 0x54, 0x10, 0xcc,
+	0xba, 0x81, 0x11, 0x08, 0x15, 0x64, 0x21, 0x9c, 0xdb, 0xa0, 0x25, 0x22, 0x9a, 0xba, 0x26, 0x52,
+	0x19, 0xbd, 0xba, 0x80, 0x00, 0x89, 0x82, 0x45, 0x21, 0x8a, 0xba, 0x82, 0x53, 0x20, 0xac, 0xb8,
+	0x13, 0x32, 0xaf, 0xba, 0x03, 0x73, 0x28, 0xac, 0xba, 0x12, 0x33, 0x8b, 0xeb, 0xb8, 0x02, 0x20,
+	0xab, 0xa8, 0x56, 0x43, 0x18, 0xbf, 0xb9, 0x91, 0x35, 0x32, 0x09, 0xab, 0xb9, 0x98, 0x9a, 0xcc,
+	0xa9, 0x24, 0x53, 0x22, 0x9a, 0xbb, 0x83, 0x76, 0x32, 0x18, 0xbd, 0xca, 0x90, 0x12, 0x20, 0xab,
+	0xba, 0x26, 0x53, 0x19, 0xcd, 0xb9, 0x82, 0x43, 0x18, 0xab, 0xa8, 0x13, 0x31, 0x9a, 0x03, 0x74,
+	0x20, 0xae, 0xbc, 0x80, 0x12, 0x0a, 0xbc, 0xa2, 0x64, 0x32, 0x8b, 0xba, 0x05, 0x43, 0x0b, 0xfb,
+	0xa9, 0x23, 0x42, 0x0a, 0xaa, 0x81, 0x34, 0x20, 0x9b, 0xba, 0x82, 0x45, 0x21, 0x9c, 0xdb, 0xb9,
+	0x15, 0x54, 0x21, 0x8b, 0xcc, 0xa8, 0x12, 0x21, 0x9b, 0xda, 0x90, 0x23, 0x21, 0x12, 0x55, 0x21,
+	0x9e, 0xdb, 0xb9, 0x11, 0x21, 0x00, 0x14, 0x54, 0x10, 0xad, 0xcb, 0x90, 0x24, 0x33, 0x18, 0xac,
+	0xba, 0xa0, 0x11, 0x21, 0x00, 0x12, 0x35, 0x21, 0x09, 0xa9, 0x04, 0x53, 0x31, 0xad, 0xba, 0x03,
+	0x52, 0x8e, 0xdc, 0xb8, 0x13, 0x30, 0xcd, 0xba, 0x05, 0x43, 0x28, 0xbc, 0xa8, 0x13, 0x20, 0xbe,
+	0xa8, 0x25, 0x34, 0x08, 0xbc, 0xb9, 0x80, 0x22, 0x33, 0x53, 0x42, 0x8b, 0xfb, 0xb9, 0x26, 0x33,
+	0x09, 0xcc, 0x98, 0x13, 0x30, 0x9c, 0xbb, 0x03, 0x54, 0x20, 0x9b, 0xcb, 0xa8, 0x01, 0x23, 0x08,
+	0xcd, 0xca, 0x81, 0x54, 0x33, 0x19, 0xbd, 0xb9, 0x81, 0x32, 0x28, 0x9a, 0x82, 0x74, 0x31, 0x8c,
+	0xdc, 0xa9, 0x13, 0x53, 0x20, 0x9d, 0xcb, 0xa8, 0x24, 0x34, 0x18, 0xbc, 0xba, 0x02, 0x44, 0x20,
+	0x9b, 0xba, 0x02, 0x44, 0x28, 0x9c, 0xca, 0x81, 0x34, 0x10, 0x9c, 0xaa, 0x01, 0x33, 0x09, 0xbc,
+	0x91, 0x23, 0x1a, 0xec, 0xa0, 0x36, 0x32, 0x8b, 0xda, 0x90, 0x35, 0x31, 0x8b, 0xba, 0x83, 0x62,
+	0x20, 0x99, 0x91, 0x11, 0xbf, 0xdc, 0xba, 0x81, 0x13, 0x23, 0x44, 0x33, 0x1a, 0xce, 0xb9, 0x82,
+	0x53, 0x31, 0x9d, 0xbc, 0xb9, 0x81, 0x11, 0x11, 0x23, 0x43, 0x30, 0xaf, 0xcb, 0xb9, 0x13, 0x55,
+	0x32, 0x18, 0xbe, 0xca, 0xa9, 0x13, 0x54, 0x31, 0x09, 0xab, 0xc9, 0x80, 0x10, 0x8a, 0xab, 0x84,
+	0x55, 0x21, 0x9c, 0xcb, 0x90, 0x34, 0x41, 0x09, 0xaa, 0x98, 0x10, 0x09, 0xab, 0x90, 0x55, 0x34,
+	0x18, 0xae, 0xca, 0xb8, 0x02, 0x45, 0x22, 0x09, 0xab, 0xb8, 0x13, 0x42, 0x0b, 0xcc, 0x98, 0x00,
+	0x8a, 0xcb, 0x82, 0x54, 0x20, 0x9a, 0xa0, 0x46, 0x52, 0x20, 0x99, 0xa9, 0x9b, 0xcd, 0xcb, 0xa8,
+	0x14, 0x43, 0x18, 0x98, 0x03, 0x53, 0x19, 0xec, 0xca, 0x81, 0x22, 0x18, 0xaa, 0x83, 0x65, 0x33,
+	0x8a, 0xeb, 0xba, 0x02, 0x33, 0x18, 0xcb, 0xb0, 0x37, 0x43, 0x10, 0xac, 0xab, 0x80, 0x01, 0x18,
+	0x8a, 0x99, 0x80, 0x02, 0x46, 0x44, 0x22, 0x8b, 0xdc, 0xa9, 0x35, 0x43, 0x18, 0xbe, 0xbb, 0x90,
+	0x11, 0x22, 0x08, 0x88, 0x98, 0x88, 0x01, 0x11, 0x08, 0x9b, 0xb9, 0x14, 0x51, 0x9d, 0xfb, 0xba,
+	0x04, 0x43, 0x21, 0x8a, 0xbb, 0xbb, 0xba, 0x04, 0x76, 0x32, 0x18, 0xab, 0xa8, 0x03, 0x32, 0x89,
+	0xbb, 0xdc, 0xdc, 0xca, 0x90, 0x24, 0x23, 0x10, 0x80, 0x13, 0x53, 0x32, 0x32, 0x32, 0x1b, 0xff,
+	0xba, 0x98, 0x12, 0x1a, 0xeb, 0xb8, 0x46, 0x42, 0x18, 0x99, 0x82, 0x22, 0x9f, 0xdb, 0xb8, 0x24,
+	0x43, 0x11, 0x88, 0x98, 0x08, 0x08, 0x88, 0x9a, 0xcd, 0xca, 0xa1, 0x45, 0x33, 0x0b, 0xec, 0x99,
+	0x23, 0x42, 0x8a, 0xda, 0x81, 0x44, 0x20, 0x8b, 0xab, 0x99, 0x9a, 0xba, 0x93, 0x76, 0x22, 0x09,
+	0xcb, 0xca, 0x80, 0x23, 0x63, 0x32, 0x19, 0xbd, 0xbb, 0xa9, 0x80, 0x88, 0x88, 0x02, 0x53, 0x21,
+	0xac, 0xba, 0x04, 0x31, 0x9e, 0xcb, 0x91, 0x36, 0x22, 0x01, 0x12, 0x42, 0x0b, 0xec, 0xba, 0x03,
+	0x53, 0x20, 0x9b, 0xdc, 0xaa, 0x91, 0x25, 0x32, 0x09, 0xcb, 0x98, 0x36, 0x32, 0x9b, 0xec, 0xa8,
+	0x14, 0x33, 0x18, 0xbb, 0xb9, 0x25, 0x44, 0x21, 0x08, 0xaa, 0xab, 0xa8, 0x03, 0x22, 0xae, 0xdb,
+	0xba, 0x13, 0x53, 0x42, 0x33, 0x42, 0x19, 0xcf, 0xca, 0xa0, 0x13, 0x41, 0x9b, 0xfa, 0xa8, 0x24,
+	0x42, 0x09, 0xac, 0x90, 0x35, 0x31, 0x9c, 0xcc, 0x98, 0x22, 0x21, 0x89, 0x98, 0x13, 0x41, 0x8a,
+	0xba, 0x13, 0x72, 0x0a, 0xdc, 0xa9, 0x14, 0x32, 0x89, 0xca, 0x82, 0x44, 0x18, 0xab, 0xb9, 0x02,
+	0x18, 0xbd, 0xa8, 0x46, 0x32, 0x19, 0xad, 0xab, 0xa9, 0x88, 0x11, 0x21, 0x8a, 0xba, 0x02, 0x63,
+	0x0a, 0xed, 0xa9, 0x14, 0x32, 0x9e, 0xeb, 0x91, 0x45, 0x42, 0x09, 0xaa, 0x90, 0x23, 0x19, 0xcc,
+	0xa8, 0x34, 0x42, 0x8a, 0xbb, 0xb8, 0x12, 0x10, 0x99, 0x98, 0x11, 0x8b, 0xeb, 0x04, 0x75, 0x31,
+	0x0b, 0xdb, 0xa9, 0x00, 0x8a, 0xcb, 0xa1, 0x55, 0x42, 0x20, 0x8a, 0x9a, 0x99, 0x98, 0x80, 0x00,
+	0x08, 0x88, 0x81, 0x89, 0xbc, 0x90, 0x75, 0x33, 0x0a, 0xdb, 0xa0, 0x45, 0x41, 0x18, 0x90, 0x15,
+	0x43, 0x1a, 0xfc, 0xbb, 0x81, 0x35, 0x31, 0x0a, 0xca, 0xa8, 0x14, 0x33, 0x28, 0x9c, 0xcc, 0xba,
+	0x88, 0x13, 0x33, 0x42, 0x18, 0x9a, 0xca, 0x98, 0x21, 0x1c, 0xed, 0xca, 0xa0, 0x13, 0x34, 0x34,
+	0x43, 0x21, 0xad, 0xdb, 0xa9, 0x13, 0x42, 0x28, 0x9a, 0xa8, 0x00, 0x8b, 0xfb, 0xb8, 0x24, 0x52,
+	0x28, 0x99, 0x98, 0x0a, 0xdd, 0xb9, 0x17, 0x44, 0x20, 0x9c, 0xbb, 0x90, 0x35, 0x31, 0x09, 0xaa,
+	0x81, 0x34, 0x31, 0x8a, 0xca, 0xb9, 0x98, 0x22, 0x53, 0x18, 0xde, 0xcb, 0xb8, 0x24, 0x42, 0x18,
+	0xaa, 0x98, 0x35, 0x32, 0x09, 0xba, 0x03, 0x63, 0x1a, 0xfc, 0xca, 0x98, 0x12, 0x34, 0x33, 0x21,
+	0x8a, 0xdd, 0xca, 0xa9, 0x01, 0x33, 0x42, 0x18, 0x99, 0x98, 0x36, 0x43, 0x20, 0xbe, 0xda, 0x98,
+	0x23, 0x32, 0x9d, 0xda, 0xa0, 0x23, 0x52, 0x11, 0x80, 0x00, 0x09, 0xac, 0xba, 0x80, 0x22, 0x0a,
+	0xca, 0x93, 0x64, 0x31, 0x9c, 0xcb, 0x98, 0x11, 0x00, 0x01, 0x44, 0x31, 0xbf, 0xbb, 0x06, 0x54,
+	0x21, 0x8a, 0xca, 0x81, 0x24, 0x18, 0xcb, 0xc9, 0x04, 0x33, 0x1a, 0xfb, 0xba, 0x13, 0x43, 0x28,
+	0xab, 0xa0, 0x44, 0x40, 0x9d, 0xcb, 0xb8, 0x13, 0x41, 0x19, 0x9a, 0x82, 0x34, 0x28, 0xad, 0xbb,
+	0x80, 0x22, 0x10, 0x00, 0x44, 0x52, 0x10, 0x99, 0x14, 0x63, 0x28, 0xde, 0xcb, 0xa9, 0x81, 0x23,
+	0x41, 0x18, 0x8a, 0x99, 0x88, 0x8a, 0xbb, 0x85, 0x76, 0x32, 0x18, 0xcc, 0xba, 0x82, 0x44, 0x21,
+	0x9a, 0xc9, 0x91, 0x22, 0x19, 0x9a, 0x82, 0x22, 0x9f, 0xeb, 0xa8, 0x24, 0x42, 0x28, 0xa9, 0xa8,
+	0x01, 0x18, 0x9b, 0xa8, 0x01, 0x0a, 0xfc, 0xb9, 0x15, 0x54, 0x22, 0x88, 0xaa, 0xab, 0xcb, 0xba,
+	0x84, 0x64, 0x32, 0x19, 0xaa, 0xa0, 0x23, 0x30, 0xaf, 0xeb, 0xa9, 0x02, 0x35, 0x32, 0x08, 0x9a,
+	0xab, 0xba, 0xa0, 0x26, 0x34, 0x19, 0xbc, 0xb8, 0x44, 0x42, 0x8a, 0xba, 0x06, 0x53, 0x28, 0xac,
+	0xba, 0x01, 0x28, 0xcf, 0xbc, 0x81, 0x36, 0x21, 0x8a, 0xca, 0x90, 0x24, 0x20, 0x89, 0x90, 0x12,
+	0x28, 0xbe, 0xba, 0x82, 0x44, 0x21, 0x10, 0x8a, 0xbc, 0xca, 0x91, 0x34, 0x41, 0x0a, 0xab, 0x98,
+	0x11, 0x09, 0xdc, 0xa8, 0x01, 0x19, 0xce, 0xa8, 0x47, 0x42, 0x19, 0xbe, 0xb9, 0x82, 0x35, 0x20,
+	0xab, 0xdb, 0x90, 0x23, 0x51, 0x19, 0xab, 0xa8, 0x23, 0x32, 0x9d, 0xcb, 0x91, 0x34, 0x21, 0x99,
+	0x98, 0x23, 0x21, 0x9b, 0x91, 0x54, 0x1a, 0xed, 0xba, 0x82, 0x54, 0x21, 0x8a, 0xab, 0x90, 0x35,
+	0x33, 0x28, 0x88, 0x15, 0x63, 0x40, 0x9c, 0xec, 0xa9, 0x01, 0x43, 0x32, 0x8a, 0xca, 0xa9, 0x98,
+	0x9b, 0xaa, 0x15, 0x44, 0x31, 0x11, 0x11, 0x8c, 0xfd, 0xca, 0xa8, 0x12, 0x33, 0x23, 0x35, 0x34,
+	0x21, 0x9b, 0xcc, 0xaa, 0xa8, 0x91, 0x24, 0x43, 0x31, 0xad, 0xdb, 0xba, 0x80, 0x23, 0x43, 0x43,
+	0x28, 0xce, 0xcb, 0xa0, 0x45, 0x32, 0x0a, 0xbb, 0x82, 0x54, 0x10, 0xbc, 0xba, 0x02, 0x32, 0x8c,
+	0xdc, 0xa9, 0x11, 0x32, 0x31, 0x00, 0x8a, 0xad, 0xbb, 0x81, 0x74, 0x33, 0x19, 0xaa, 0xa0, 0x54,
+	0x32, 0x0a, 0xdb, 0xc9, 0x80, 0x11, 0x08, 0xbb, 0xba, 0x16, 0x54, 0x21, 0x8a, 0xbb, 0x90, 0x12,
+	0x08, 0xbb, 0x92, 0x63, 0x1a, 0xdd, 0xb9, 0x02, 0x21, 0xae, 0xcb, 0x90, 0x44, 0x42, 0x0a, 0xcc,
+	0xba, 0x02, 0x63, 0x32, 0x0a, 0xbe, 0xab, 0x90, 0x12, 0x22, 0x10, 0x88, 0x00, 0x11, 0x8a, 0xba,
+	0x84, 0x64, 0x32, 0x9b, 0xdb, 0xa1, 0x56, 0x42, 0x29, 0xbd, 0xda, 0x98, 0x25, 0x33, 0x10, 0x9a,
+	0xba, 0xaa, 0xbc, 0xbb, 0x82, 0x64, 0x31, 0x8c, 0xcb, 0xa0, 0x45, 0x33, 0x18, 0xac, 0xba, 0x82,
+	0x34, 0x32, 0x28, 0x8b, 0xcb, 0xca, 0x98, 0x23, 0x33, 0x19, 0xdc, 0xbb, 0x90, 0x36, 0x44, 0x32,
+	0x09, 0xad, 0xcb, 0xba, 0xa8, 0x81, 0x22, 0x33, 0x10, 0x88, 0x02, 0x44, 0x31, 0x9b, 0xca, 0x17,
+	0x63, 0x30, 0xae, 0xcb, 0xb8, 0x24, 0x42, 0x18, 0xab, 0xba, 0x14, 0x53, 0x1a, 0xcf, 0xba, 0x90,
+	0x44, 0x33, 0x18, 0x9b, 0xb9, 0x03, 0x34, 0x18, 0xac, 0xca, 0x98, 0x02, 0x44, 0x34, 0x28, 0xbf,
+	0xcb, 0x90, 0x44, 0x42, 0x09, 0xcb, 0xba, 0x02, 0x32, 0x09, 0xcb, 0x91, 0x35, 0x31, 0x9a, 0xbb,
+	0x92, 0x43, 0x29, 0xdd, 0xb9, 0x82, 0x43, 0x28, 0x9b, 0xa8, 0x26, 0x42, 0x0a, 0xcc, 0xba, 0x04,
+	0x44, 0x30, 0x89, 0xa9, 0x23, 0x62, 0x19, 0xcc, 0xba, 0x80, 0x20, 0x08, 0xaa, 0x88, 0x24, 0x55,
+	0x35, 0x22, 0x09, 0xcd, 0xbc, 0xa9, 0x80, 0x01, 0x12, 0x44, 0x43, 0x19, 0xcc, 0xca, 0x91, 0x34,
+	0x21, 0x8b, 0xba, 0x90, 0x10, 0x8b, 0xb9, 0x27, 0x73, 0x31, 0x9b, 0xdb, 0xb8, 0x02, 0x11, 0xab,
+	0xda, 0x82, 0x45, 0x22, 0x0a, 0xcb, 0xa9, 0x15, 0x42, 0x18, 0xcc, 0xbb, 0x83, 0x45, 0x31, 0x8a,
+	0xbc, 0x90, 0x24, 0x32, 0x08, 0xaa, 0x90, 0x22, 0x20, 0x9e, 0xcc, 0xdb, 0xbc, 0x90, 0x26, 0x44,
+	0x11, 0x8a, 0xbb, 0x90, 0x34, 0x21, 0x9c, 0xca, 0x80, 0x23, 0x28, 0xcc, 0xbb, 0x80, 0x22, 0x0a,
+	0xcc, 0x90, 0x24, 0x31, 0x8c, 0xbb, 0x93, 0x75, 0x33, 0x10, 0x9a, 0x99, 0x98, 0x9b, 0xdd, 0xcb,
+	0xa9, 0x14, 0x44, 0x21, 0x10, 0x25, 0x63, 0x32, 0x9c, 0xeb, 0xba, 0x80, 0x11, 0x21, 0x33, 0x32,
+	0x1a, 0xec, 0xba, 0x80, 0x20, 0x8b, 0xeb, 0x92, 0x54, 0x33, 0x0a, 0xaa, 0x81, 0x21, 0x8c, 0xa9,
+	0x47, 0x31, 0x9c, 0xdb, 0x82, 0x63, 0x20, 0xac, 0xbb, 0x82, 0x33, 0x20, 0x9a, 0x92, 0x43, 0x20,
+	0xbd, 0xa8, 0x24, 0x38, 0xcf, 0xba, 0x81, 0x33, 0x1a, 0xcc, 0xa1, 0x44, 0x31, 0x9b, 0xca, 0x81,
+	0x12, 0x89, 0xbb, 0xa9, 0x02, 0x56, 0x53, 0x42, 0x8a, 0xeb, 0xc9, 0x80, 0x21, 0x18, 0x9b, 0x90,
+	0x37, 0x52, 0x20, 0x9b, 0xdb, 0xb8, 0x03, 0x53, 0x22, 0x9a, 0xcb, 0xa0, 0x35, 0x42, 0x0a, 0xcd,
+	0xba, 0x98, 0x12, 0x33, 0x22, 0x20, 0x80, 0x81, 0x34, 0x21, 0xae, 0xdb, 0xba, 0x99, 0xa9, 0xa9,
+	0x04, 0x63, 0x38, 0xaf, 0xbb, 0x81, 0x45, 0x42, 0x18, 0xbc, 0xca, 0xa9, 0x01, 0x32, 0x21, 0x88,
+	0x80, 0x55, 0x42, 0x18, 0xbe, 0xb9, 0x82, 0x53, 0x20, 0xad, 0xcb, 0xa8, 0x13, 0x35, 0x22, 0x18,
+	0x9c, 0xcb, 0xba, 0x15, 0x44, 0x21, 0x8b, 0xba, 0x91, 0x33, 0x0b, 0xda, 0x92, 0x54, 0x18, 0xad,
+	0xb9, 0x13, 0x43, 0x0b, 0xdb, 0xa8, 0x24, 0x20, 0x9b, 0x92, 0x75, 0x31, 0x9c, 0xdb, 0x91, 0x43,
+	0x31, 0x9c, 0xda, 0x88, 0x22, 0x20, 0x88, 0x01, 0x34, 0x28, 0xae, 0xba, 0x01, 0x34, 0x18, 0xcc,
+	0xbb, 0x90, 0x08, 0x89, 0x02, 0x64, 0x33, 0x0b, 0xcb, 0x82, 0x75, 0x22, 0x8a, 0xcb, 0x99, 0x12,
+	0x19, 0xbe, 0xba, 0x81, 0x33, 0x09, 0xdb, 0xa0, 0x37, 0x42, 0x19, 0xbc, 0xb9, 0x02, 0x53, 0x32,
+	0x19, 0x9a, 0xa9, 0x02, 0x43, 0x41, 0x8c, 0xdc, 0xba, 0x82, 0x55, 0x32, 0x18, 0xbc, 0xca, 0x98,
+	0x10, 0x8b, 0xcc, 0xa1, 0x47, 0x34, 0x10, 0x8a, 0xaa, 0x80, 0x89, 0xcc, 0xca, 0x90, 0x36, 0x32,
+	0x28, 0xad, 0xbb, 0xa9, 0x14, 0x43, 0x32, 0x00, 0x99, 0xaa, 0xaa, 0xba, 0x90, 0x24, 0x53, 0x32,
+	0x89, 0xcc, 0xcb, 0xaa, 0x81, 0x55, 0x42, 0x1a, 0xbe, 0xb9, 0x01, 0x30, 0x9d, 0xca, 0x92, 0x43,
+	0x20, 0x88, 0x36, 0x53, 0x29, 0xcd, 0xba, 0x81, 0x32, 0x0a, 0xcb, 0xa0, 0x46, 0x22, 0x89, 0xba,
+	0x81, 0x33, 0x0a, 0xeb, 0xa0, 0x33, 0x38, 0xbc, 0xa1, 0x55, 0x21, 0xac, 0xdb, 0xba, 0x88, 0x12,
+	0x63, 0x42, 0x09, 0xbc, 0xb9, 0x81, 0x20, 0x09, 0x88, 0x34, 0x52, 0x10, 0x99, 0x88, 0x00, 0x88,
+	0x02, 0x56, 0x42, 0x8c, 0xdc, 0xa9, 0x12, 0x28, 0xbf, 0xba, 0x15, 0x43, 0x20, 0xaa, 0xa0, 0x14,
+	0x21, 0x89, 0x02, 0x42, 0x9e, 0xec, 0xa9, 0x80, 0x20, 0x08, 0x01, 0x37, 0x32, 0x21, 0x8a, 0x9a,
+	0xab, 0xba, 0xa1, 0x75, 0x33, 0x0b, 0xfc, 0xa9, 0x13, 0x53, 0x18, 0xaa, 0xa9, 0x00, 0x8a, 0xda,
+	0x91, 0x33, 0x0c, 0xec, 0xa8, 0x23, 0x52, 0x00, 0x81, 0x13, 0x30, 0x9c, 0xcb, 0x91, 0x34, 0x21,
+	0x9c, 0xba, 0x82, 0x54, 0x31, 0x8a, 0xdc, 0xca, 0x81, 0x35, 0x41, 0x0a, 0xcc, 0xa0, 0x26, 0x32,
+	0x8a, 0xeb, 0xa8, 0x12, 0x21, 0x9a, 0xba, 0x02, 0x52, 0x18, 0xab, 0x91, 0x44, 0x52, 0x18, 0x9b,
+	0xda, 0xa8, 0x13, 0x42, 0x18, 0xbb, 0xd9, 0x82, 0x36, 0x43, 0x32, 0x18, 0xbf, 0xcc, 0xaa, 0x80,
+	0x21, 0x18, 0x9b, 0x91, 0x64, 0x32, 0x8b, 0xdb, 0x91, 0x44, 0x32, 0x10, 0x01, 0x21, 0x0a, 0xec,
+	0xa9, 0x01, 0x08, 0xcd, 0xc9, 0x92, 0x23, 0x19, 0xdc, 0xb9, 0x14, 0x42, 0x28, 0xab, 0xba, 0x00,
+	0x18, 0x99, 0x03, 0x75, 0x22, 0x89, 0xbc, 0x99, 0x00, 0x00, 0x09, 0x80, 0x26, 0x64, 0x33, 0x28,
+	0xdc, 0xda, 0x90, 0x24, 0x42, 0x18, 0xac, 0xbc, 0xa8, 0x02, 0x35, 0x22, 0x89, 0xcb, 0xa8, 0x35,
+	0x52, 0x28, 0xac, 0xbb, 0x81, 0x33, 0x19, 0xdd, 0xba, 0x80, 0x35, 0x34, 0x31, 0x0a, 0xeb, 0xc9,
+	0x02, 0x23, 0x09, 0xcb, 0x91, 0x64, 0x31, 0x89, 0xbb, 0x91, 0x32, 0x0b, 0xfc, 0xa9, 0x03, 0x44,
+	0x21, 0x00, 0x08, 0xac, 0xeb, 0xa8, 0x26, 0x42, 0x19, 0xbc, 0xa9, 0x02, 0x21, 0x9a, 0xb9, 0x01,
+	0x30, 0xaf, 0xba, 0x04, 0x63, 0x32, 0x9a, 0xcc, 0xa9, 0x81, 0x34, 0x34, 0x21, 0x0b, 0xdc, 0xba,
+	0x81, 0x12, 0x09, 0xba, 0x04, 0x44, 0x18, 0x99, 0x05, 0x63, 0x38, 0xae, 0xca, 0x80, 0x23, 0x18,
+	0xad, 0xb9, 0x83, 0x43, 0x20, 0x99, 0x81, 0x32, 0x1b, 0xfd, 0xa9, 0x14, 0x43, 0x19, 0xbd, 0xba,
+	0x92, 0x24, 0x10, 0xaa, 0x98, 0x24, 0x32, 0x8d, 0xcb, 0xa1, 0x45, 0x31, 0x9a, 0xca, 0x81, 0x32,
+	0x0a, 0xda, 0x93, 0x73, 0x30, 0x9d, 0xba, 0x82, 0x33, 0x8d, 0xeb, 0xa8, 0x35, 0x32, 0x0a, 0xbc,
+	0x90, 0x34, 0x30, 0x8a, 0x90, 0x34, 0x20, 0xbe, 0xbb, 0x82, 0x54, 0x22, 0x18, 0xab, 0xcb, 0xa9,
+	0x12, 0x53, 0x10, 0x9b, 0xca, 0x90, 0x18, 0xad, 0xdb, 0x98, 0x24, 0x18, 0xbd, 0xa2, 0x75, 0x33,
+	0x19, 0xdb, 0xb9, 0x02, 0x32, 0x89, 0xab, 0x99, 0x02, 0x36, 0x44, 0x31, 0x0c, 0xdb, 0xc9, 0x01,
+	0x32, 0x18, 0x9a, 0x03, 0x74, 0x31, 0x8b, 0xcd, 0xa9, 0x90, 0x01, 0x00, 0x88, 0x9b, 0xcb, 0xa0,
+	0x47, 0x33, 0x0a, 0xbd, 0xa0, 0x13, 0x21, 0x8a, 0xb9, 0x02, 0x08, 0xcc, 0xa1, 0x66, 0x43, 0x21,
+	0x09, 0x99, 0x99, 0xaa, 0xcb, 0xaa, 0x91, 0x23, 0x33, 0x23, 0x22, 0xaf, 0xfc, 0xa9, 0x04, 0x33,
+	0x28, 0xaa, 0x82, 0x52, 0x1b, 0xfb, 0xa0, 0x45, 0x52, 0x21, 0x8a, 0xbd, 0xbd, 0xa9, 0x82, 0x34,
+	0x31, 0x8b, 0xdb, 0xba, 0x02, 0x44, 0x21, 0x89, 0xbb, 0xcb, 0x98, 0x24, 0x44, 0x32, 0x20, 0x9a,
+	0xbb, 0xcb, 0xb9, 0x15, 0x54, 0x21, 0xbd, 0xdb, 0xa0, 0x14, 0x32, 0x00, 0x90, 0x02, 0x42, 0x0a,
+	0xcd, 0xba, 0x90, 0x11, 0x08, 0x98, 0x15, 0x64, 0x32, 0x21, 0x09, 0x99, 0xab, 0xcd, 0xbc, 0xa9,
+	0x12, 0x63, 0x42, 0x18, 0x9b, 0xba, 0x99, 0x89, 0x9a, 0x93, 0x66, 0x21, 0x9d, 0xdc, 0xa8, 0x25,
+	0x42, 0x18, 0xbe, 0xba, 0x80, 0x34, 0x21, 0x09, 0x88, 0x14, 0x43, 0x18, 0xad, 0xbb, 0xa8, 0x98,
+	0x88, 0x00, 0x23, 0x21, 0xbe, 0xca, 0x82, 0x43, 0x09, 0xec, 0xb9, 0x02, 0x43, 0x28, 0x9a, 0x90,
+	0x54, 0x43, 0x18, 0xbc, 0xcb, 0xaa, 0x01, 0x34, 0x43, 0x20, 0xad, 0xcb, 0xb8, 0x15, 0x44, 0x22,
+	0x08, 0x9b, 0xbb, 0xba, 0x80, 0x22, 0x20, 0xbd, 0xda, 0x82, 0x54, 0x28, 0xbf, 0xda, 0x90, 0x34,
+	0x33, 0x19, 0xaa, 0x92, 0x44, 0x21, 0xac, 0xca, 0x90, 0x21, 0x19, 0xbb, 0x93, 0x64, 0x20, 0x88,
+	0x83, 0x74, 0x21, 0xac, 0xdb, 0xa8, 0x03, 0x31, 0x8b, 0xbc, 0x81, 0x33, 0x19, 0xed, 0xb9, 0x91,
+	0x22, 0x18, 0x88, 0x15, 0x44, 0x32, 0x0b, 0xdd, 0xca, 0xa8, 0x12, 0x42, 0x20, 0x8a, 0x99, 0x03,
+	0x73, 0x42, 0x18, 0x8a, 0xb9, 0x90, 0x33, 0x21, 0xae, 0xdc, 0xba, 0x99, 0x89, 0x89, 0x00, 0x46,
+	0x34, 0x10, 0xac, 0xba, 0x13, 0x73, 0x28, 0xae, 0xbb, 0xa0, 0x13, 0x42, 0x00, 0x89, 0x00, 0x22,
+	0x28, 0xbd, 0xbb, 0x04, 0x54, 0x20, 0x9a, 0xba, 0x14, 0x53, 0x30, 0x8b, 0xba, 0x90, 0x0c, 0xfe,
+	0xbb, 0xa1, 0x45, 0x43, 0x20, 0x8a, 0xab, 0xba, 0xaa, 0x98, 0x24, 0x63, 0x32, 0x08, 0xaa, 0xaa,
+	0xad, 0xdc, 0xbb, 0x91, 0x65, 0x32, 0x29, 0xac, 0xba, 0x91, 0x33, 0x21, 0x89, 0xaa, 0x81, 0x08,
+	0xbf, 0xca, 0x82, 0x64, 0x33, 0x08, 0xcb, 0xa8, 0x27, 0x33, 0x20, 0xcd, 0xca, 0xa0, 0x14, 0x42,
+	0x10, 0x9a, 0xcb, 0xa9, 0x90, 0x11, 0x11, 0x11, 0x89, 0xa9, 0x04, 0x64, 0x42, 0x09, 0xcb, 0xb9,
+	0x13, 0x42, 0x0c, 0xdb, 0xb9, 0x04, 0x31, 0x0b, 0xdb, 0xa1, 0x35, 0x30, 0x9c, 0xcb, 0x80, 0x23,
+	0x28, 0x9a, 0x83, 0x74, 0x32, 0x88, 0xaa, 0xa9, 0xac, 0xdd, 0xa8, 0x26, 0x53, 0x20, 0xac, 0xcb,
+	0x90, 0x12, 0x21, 0x10, 0x13, 0x42, 0x8c, 0xfb, 0xb9, 0x12, 0x43, 0x21, 0x80, 0x81, 0x10, 0x89,
+	0xbc, 0x99, 0x88, 0xbf, 0xcc, 0x90, 0x44, 0x42, 0x10, 0x99, 0x90, 0x10, 0x9b, 0xca, 0x14, 0x63,
+	0x09, 0xdd, 0xab, 0x80, 0x10, 0x10, 0x80, 0x23, 0x41, 0x09, 0xbd, 0x99, 0x12, 0x0a, 0xed, 0xba,
+	0x84, 0x55, 0x33, 0x20, 0x9b, 0xdb, 0xc9, 0x90, 0x24, 0x23, 0x00, 0x99, 0x81, 0x44, 0x32, 0x09,
+	0xcc, 0xcb, 0xa9, 0x02, 0x44, 0x31, 0x9c, 0xdb, 0xc9, 0x02, 0x24, 0x21, 0x08, 0x88, 0x88, 0x88,
+	0x99, 0x02, 0x44, 0x20, 0x9c, 0xa9, 0x37, 0x42, 0x1a, 0xdd, 0xba, 0xa8, 0x00, 0x11, 0x24, 0x35,
+	0x22, 0x18, 0x9a, 0xbb, 0xbc, 0xcb, 0xbb, 0x81, 0x55, 0x43, 0x32, 0x00, 0x99, 0x88, 0x09, 0x9c,
+	0xda, 0xa8, 0x23, 0x1a, 0xff, 0xdb, 0x98, 0x25, 0x43, 0x30, 0x0a, 0xbb, 0x90, 0x13, 0x10, 0x9c,
+	0xcb, 0xba, 0x98, 0x13, 0x55, 0x32, 0x18, 0xbb, 0xca, 0x98, 0x89, 0x99, 0x04, 0x65, 0x33, 0x10,
+	0xad, 0xcb, 0xaa, 0x13, 0x74, 0x22, 0x1a, 0xec, 0xbb, 0xa0, 0x24, 0x34, 0x11, 0x89, 0x88, 0x01,
+	0x10, 0x08, 0x98, 0x9b, 0xcd, 0xcb, 0xa8, 0x03, 0x34, 0x11, 0x88, 0x88, 0x88, 0x02, 0x54, 0x42,
+	0x20, 0x80, 0x15, 0x53, 0x18, 0xec, 0xda, 0xa8, 0x11, 0x20, 0x8b, 0xa9, 0x24, 0x53, 0x18, 0xba,
+	0x81, 0x53, 0x1a, 0xfe, 0xaa, 0x03, 0x54, 0x21, 0x9b, 0xdb, 0xa8, 0x13, 0x44, 0x11, 0x09, 0x99,
+	0x99, 0x80, 0x08, 0xab, 0xdc, 0xa9, 0x25, 0x54, 0x21, 0x8a, 0xbb, 0x80, 0x34, 0x30, 0xbd, 0xca,
+	0x82, 0x34, 0x28, 0x9b, 0xb9, 0x00, 0x0b, 0xfb, 0xb8, 0x13, 0x42, 0x89, 0xc9, 0x05, 0x53, 0x31,
+	0x8a, 0xaa, 0x81, 0x30, 0xbf, 0xeb, 0xa8, 0x13, 0x63, 0x22, 0x18, 0xbd, 0xdb, 0xb9, 0x03, 0x43,
+	0x18, 0xcc, 0xa9, 0x14, 0x43, 0x20, 0x88, 0x82, 0x21, 0x8e, 0xdc, 0xa0, 0x25, 0x43, 0x08, 0xcc,
+	0xb9, 0x01, 0x31, 0x09, 0xab, 0x93, 0x64, 0x21, 0x9c, 0xca, 0xa8, 0x13, 0x21, 0x89, 0x91, 0x45,
+	0x33, 0x0b, 0xec, 0xba, 0x80, 0x23, 0x32, 0x18, 0x08, 0x81, 0x00, 0x08, 0x98, 0x01, 0x11, 0x0b,
+	0xfd, 0xbc, 0xa9, 0x25, 0x64, 0x23, 0x10, 0x9a, 0xba, 0x98, 0x80, 0x89, 0x01, 0x55, 0x42, 0x0a,
+	0xfc, 0xca, 0xa0, 0x34, 0x52, 0x08, 0xbc, 0xbb, 0x80, 0x33, 0x31, 0x89, 0x82, 0x65, 0x32, 0x8a,
+	0xec, 0xa9, 0x81, 0x32, 0x08, 0xcb, 0xba, 0x91, 0x23, 0x23, 0x43, 0x34, 0x10, 0x8a, 0xbb, 0xaa,
+	0xaa, 0xa0, 0x46, 0x43, 0x29, 0xec, 0xb9, 0x15, 0x43, 0x19, 0xdd, 0xba, 0x81, 0x33, 0x08, 0xcc,
+	0xa8, 0x24, 0x42, 0x00, 0x90, 0x15, 0x43, 0x21, 0x9b, 0xeb, 0xba, 0x81, 0x32, 0x30, 0x8a, 0x98,
+	0x26, 0x42, 0x28, 0xba, 0xa1, 0x54, 0x31, 0xbf, 0xdb, 0x90, 0x24, 0x31, 0xaf, 0xbc, 0x90, 0x12,
+	0x31, 0x8a, 0xa9, 0x03, 0x34, 0x19, 0x9a, 0x82, 0x74, 0x32, 0x28, 0xab, 0xdb, 0xa9, 0x11, 0x11,
+	0x9b, 0xda, 0x83, 0x74, 0x41, 0x09, 0xcd, 0xaa, 0x90, 0x11, 0x00, 0x01, 0x35, 0x31, 0x9c, 0xc9,
+	0x83, 0x53, 0x0c, 0xdd, 0xa9, 0x13, 0x53, 0x18, 0xab, 0xa9, 0x13, 0x51, 0x19, 0x99, 0x12, 0x32,
+	0x9d, 0xea, 0xa1, 0x33, 0x31, 0xac, 0xa9, 0x24, 0x42, 0x09, 0xaa, 0x80, 0x8a, 0xfc, 0xba, 0x04,
+	0x44, 0x19, 0xad, 0xa9, 0x14, 0x31, 0x8c, 0xcb, 0xa1, 0x34, 0x18, 0xbd, 0xa8, 0x13, 0x32, 0x8a,
+	0xa0, 0x55, 0x31, 0x8b, 0xcb, 0x93, 0x64, 0x21, 0x8a, 0xba, 0x91, 0x22, 0x0b, 0xec, 0xa9, 0x02,
+	0x32, 0x10, 0x88, 0x00, 0x11, 0x00, 0x35, 0x63, 0x32, 0x09, 0xcf, 0xdc, 0xbb, 0x90, 0x44, 0x41,
+	0x18, 0x99, 0x13, 0x31, 0x9f, 0xbc, 0x81, 0x44, 0x28, 0xbd, 0xbb, 0x81, 0x43, 0x20, 0xab, 0xb9,
+	0x14, 0x52, 0x19, 0xaa, 0xa8, 0x23, 0x42, 0x00, 0x99, 0xbf, 0xcc, 0xa8, 0x15, 0x42, 0x10, 0xaa,
+	0xa9, 0x00, 0x8b, 0xcb, 0x84, 0x54, 0x20, 0xac, 0xb9, 0x14, 0x43, 0x20, 0xab, 0xba, 0x90, 0x89,
+	0xbd, 0xbb, 0x80, 0x22, 0x09, 0xa8, 0x37, 0x53, 0x20, 0x88, 0x82, 0x33, 0x0b, 0xfe, 0xab, 0x98,
+	0x81, 0x45, 0x63, 0x32, 0x8b, 0xec, 0xa9, 0x80, 0x22, 0x00, 0x99, 0x00, 0x35, 0x32, 0x19, 0xcc,
+	0xba, 0x91, 0x45, 0x33, 0x18, 0xbd, 0xbb, 0x81, 0x35, 0x20, 0x9b, 0xba, 0x05, 0x42, 0x09, 0xcc,
+	0x90, 0x35, 0x22, 0x09, 0xaa, 0x98, 0x8a, 0xcd, 0xcb, 0x90, 0x24, 0x33, 0x21, 0x10, 0x08, 0xad,
+	0xcc, 0x90, 0x45, 0x42, 0x89, 0xbb, 0x98, 0x22, 0x0b, 0xfb, 0xb8, 0x25, 0x21, 0x8c, 0xcb, 0x92,
+	0x36, 0x21, 0x0a, 0xca, 0x90, 0x00, 0x8a, 0xcc, 0xa8, 0x13, 0x54, 0x34, 0x22, 0x0a, 0xdd, 0xb9,
+	0x81, 0x42, 0x0a, 0xcb, 0xa1, 0x64, 0x32, 0x0b, 0xdb, 0xa0, 0x43, 0x42, 0x9a, 0xdb, 0xa0, 0x24,
+	0x31, 0x0b, 0xcb, 0x90, 0x45, 0x33, 0x18, 0xac, 0xbb, 0xb9, 0x80, 0x22, 0x31, 0x18, 0x99, 0x80,
+	0x23, 0x19, 0xdd, 0xb9, 0x15, 0x53, 0x29, 0xce, 0xb9, 0x14, 0x63, 0x28, 0x9c, 0xba, 0x03, 0x42,
+	0x8b, 0xeb, 0xa8, 0x23, 0x20, 0xbd, 0xc9, 0x02, 0x32, 0x8a, 0xca, 0x16, 0x54, 0x30, 0x9c, 0xcb,
+	0xa0, 0x13, 0x42, 0x18, 0x8a, 0xaa, 0xb9, 0x03, 0x75, 0x32, 0x0b, 0xdc, 0xb9, 0x13, 0x43, 0x28,
+	0x8a, 0x98, 0x03, 0x20, 0x9d, 0xdb, 0x98, 0x24, 0x43, 0x19, 0xbd, 0xca, 0x90, 0x23, 0x52, 0x10,
+	0x9a, 0xa8, 0x01, 0x28, 0xae, 0xcb, 0xb8, 0x01, 0x32, 0x24, 0x35, 0x42, 0x11, 0x89, 0x02, 0x33,
+	0x0c, 0xfd, 0xba, 0x82, 0x53, 0x30, 0xbd, 0xdb, 0x99, 0x11, 0x22, 0x00, 0x80, 0x11, 0x22, 0x18,
+	0xa9, 0x80, 0x11, 0x8b, 0xca, 0x37, 0x75, 0x18, 0xad, 0xca, 0x81, 0x35, 0x32, 0x0a, 0xbc, 0xbb,
+	0x88, 0x00, 0x11, 0x11, 0x21, 0x09, 0xba, 0x85, 0x74, 0x22, 0x8b, 0xdb, 0xa0, 0x24, 0x31, 0x0b,
+	0xeb, 0xa8, 0x01, 0x08, 0x9b, 0xa0, 0x46, 0x42, 0x0a, 0xec, 0xbb, 0x82, 0x54, 0x22, 0x09, 0xbb,
+	0xb8, 0x36, 0x43, 0x20, 0x9a, 0xbb, 0x80, 0x21, 0x8c, 0xec, 0xba, 0x81, 0x42, 0x19, 0xbe, 0xa0,
+	0x45, 0x43, 0x18, 0xbc, 0xba, 0x81, 0x22, 0x8a, 0xbb, 0x83, 0x73, 0x40, 0x8a, 0xca, 0x88, 0x11,
+	0x8a, 0x98, 0x47, 0x34, 0x09, 0xbe, 0xa9, 0x12, 0x42, 0x09, 0xab, 0xa8, 0x24, 0x30, 0x9e, 0xca,
+	0xa0, 0x24, 0x31, 0x09, 0xbb, 0xa8, 0x24, 0x43, 0x41, 0x20, 0x9a, 0xcc, 0xca, 0x98, 0x12, 0x53,
+	0x31, 0x9c, 0xcd, 0xa9, 0x01, 0x22, 0x8a, 0xeb, 0xb9, 0x14, 0x53, 0x32, 0x10, 0x01, 0x33, 0x28,
+	0xce, 0xcb, 0x80, 0x34, 0x31, 0x8a, 0xb9, 0x83, 0x42, 0xaf, 0xeb, 0xb8, 0x13, 0x62, 0x28, 0x9a,
+	0xa8, 0x01, 0x21, 0x8b, 0xca, 0x98, 0x18, 0xbe, 0xcb, 0x82, 0x64, 0x20, 0x9c, 0xcb, 0x91, 0x35,
+	0x33, 0x18, 0x98, 0x80, 0x18, 0x9c, 0xcb, 0xb8, 0x14, 0x34, 0x31, 0x0a, 0xbd, 0xb9, 0x13, 0x74,
+	0x32, 0x19, 0xbc, 0xba, 0x01, 0x18, 0x9b, 0xd9, 0x15, 0x54, 0x21, 0x08, 0x99, 0xaa, 0xdb, 0xdb,
+	0xa9, 0x24, 0x43, 0x11, 0x9b, 0xdb, 0xa8, 0x04, 0x34, 0x20, 0x9b, 0xda, 0x90, 0x43, 0x42, 0x8b,
+	0xdb, 0xb8, 0x12, 0x21, 0x9b, 0xb1, 0x67, 0x42, 0x20, 0x99, 0x99, 0x99, 0xbe, 0xca, 0x90, 0x24,
+	0x31, 0x89, 0x98, 0x24, 0x31, 0x9e, 0xcb, 0x91, 0x55, 0x22, 0x8a, 0xbd, 0xa8, 0x01, 0x21, 0x89,
+	0x98, 0x35, 0x52, 0x10, 0xbc, 0xcb, 0xb9, 0x80, 0x12, 0x00, 0x11, 0x35, 0x41, 0x9d, 0xeb, 0xb8,
+	0x36, 0x33, 0x08, 0xbb, 0xa1, 0x33, 0x0b, 0xfd, 0xa0, 0x36, 0x33, 0x09, 0xcc, 0xa9, 0x82, 0x31,
+	0x0a, 0xbb, 0x91, 0x43, 0x18, 0xba, 0xa2, 0x33, 0x8f, 0xeb, 0x91, 0x46, 0x33, 0x09, 0xbd, 0xaa,
+	0x80, 0x12, 0x11, 0x11, 0x11, 0x09, 0x9a, 0x82, 0x76, 0x31, 0x0b, 0xdc, 0xb9, 0x02, 0x33, 0x28,
+	0xbc, 0xca, 0xa9, 0x11, 0x33, 0x42, 0x0a, 0xce, 0xba, 0x03, 0x63, 0x30, 0xad, 0xca, 0x01, 0x43,
+	0x19, 0xbd, 0xb9, 0x02, 0x44, 0x11, 0x10, 0x08, 0xab, 0xdc, 0xa8, 0x03, 0x34, 0x09, 0xcb, 0xa0,
+	0x37, 0x31, 0x8a, 0xcb, 0x90, 0x34, 0x30, 0x88, 0x13, 0x64, 0x10, 0xac, 0xb9, 0x25, 0x52, 0x18,
+	0xdc, 0xba, 0x90, 0x23, 0x32, 0x8b, 0xbc, 0x81, 0x36, 0x21, 0x09, 0x90, 0x22, 0x1a, 0xed, 0xa9,
+	0x26, 0x42, 0x1a, 0xcc, 0xaa, 0x01, 0x21, 0x09, 0x00, 0x36, 0x32, 0x9c, 0xdc, 0xa9, 0x11, 0x32,
+	0x09, 0x9a, 0x01, 0x20, 0xad, 0xba, 0x26, 0x42, 0x8c, 0xca, 0x91, 0x34, 0x29, 0xbd, 0x90, 0x44,
+	0x21, 0x9c, 0xa9, 0x15, 0x43, 0x19, 0xbc, 0xb9, 0x13, 0x31, 0xae, 0xcb, 0x91, 0x44, 0x21, 0x89,
+	0xaa, 0x99, 0x89, 0x80, 0x24, 0x42, 0x0a, 0xdb, 0xa9, 0x12, 0x20, 0x88, 0x37, 0x73, 0x30, 0x9b,
+	0xca, 0x81, 0x42, 0x0a, 0xfb, 0xb8, 0x35, 0x43, 0x09, 0xbc, 0xa9, 0x00, 0x09, 0xbb, 0x92, 0x45,
+	0x18, 0xcd, 0xa9, 0x25, 0x43, 0x19, 0xbd, 0xb9, 0x03, 0x42, 0x29, 0xab, 0xb9, 0x11, 0x28, 0x9a,
+	0xa1, 0x46, 0x32, 0x19, 0x9a, 0x98, 0x8a, 0xab, 0x93, 0x76, 0x32, 0x1a, 0xdc, 0xb9, 0x81, 0x34,
+	0x21, 0x9c, 0xbc, 0x98, 0x24, 0x31, 0x8a, 0xdb, 0xb9, 0x14, 0x54, 0x22, 0x10, 0x88, 0x99, 0xba,
+	0xca, 0xa9, 0x08, 0x8b, 0xdc, 0x92, 0x65, 0x32, 0x0a, 0xdb, 0x98, 0x34, 0x42, 0x19, 0xbc, 0xbc,
+	0xcb, 0xbb, 0xb0, 0x56, 0x44, 0x21, 0x09, 0xaa, 0xaa, 0x89, 0xaa, 0xa9, 0x26, 0x54, 0x22, 0x09,
+	0xab, 0xb9, 0x80, 0x01, 0x00, 0x02, 0x22, 0x0a, 0xfc, 0xca, 0xa8, 0x80, 0x08, 0x01, 0x25, 0x31,
+	0x9e, 0xdc, 0xa8, 0x24, 0x53, 0x30, 0x8b, 0xcc, 0xa8, 0x24, 0x43, 0x30, 0xac, 0xca, 0xa0, 0x23,
+	0x32, 0x0b, 0xcb, 0xc9, 0x81, 0x13, 0x34, 0x21, 0x09, 0xaa, 0xbb, 0xbb, 0xed, 0xcc, 0xa9, 0x04,
+	0x44, 0x21, 0x89, 0xa9, 0x81, 0x20, 0x8a, 0x86, 0x74, 0x41, 0x0a, 0xcc, 0xa9, 0x00, 0x18, 0xab,
+	0xa8, 0x37, 0x33, 0x10, 0xac, 0xaa, 0x80, 0x00, 0x08, 0x88, 0x08, 0x08, 0x08, 0x89, 0xa9, 0x91,
+	0x10,
+};
+
+static const unsigned char sndbank_plasma[4097] = {
+	0x77, 0x77, 0x76, 0x08, 0x88, 0x00, 0x88, 0x99, 0x81, 0x33, 0x30, 0x9b, 0xd9, 0x91, 0x22, 0x08,
+	0xbc, 0xab, 0xaa, 0xbc, 0xec, 0xcd, 0xbc, 0xba, 0xa8, 0x98, 0xad, 0xcc, 0xca, 0xb9, 0x99, 0x9a,
+	0xcc, 0xbc, 0xba, 0x9a, 0x99, 0xac, 0xbb, 0xba, 0xbb, 0xdd, 0xdc, 0xbc, 0xba, 0x99, 0x00, 0x22,
+	0x32, 0x20, 0x89, 0x90, 0x37, 0x73, 0x43, 0x34, 0x33, 0x53, 0x34, 0x24, 0x23, 0x33, 0x43, 0x43,
+	0x34, 0x33, 0x33, 0x34, 0x43, 0x43, 0x23, 0x32, 0x43, 0x53, 0x53, 0x33, 0x21, 0x10, 0x10, 0x23,
+	0x34, 0x28, 0xac, 0xcb, 0xb8, 0x81, 0x09, 0xbf, 0xca, 0xb9, 0x90, 0x8b, 0xee, 0xdc, 0xbc, 0xaa,
+	0x99, 0x99, 0xac, 0xdc, 0xbb, 0xab, 0x9a, 0xa9, 0xab, 0xbb, 0xac, 0xbc, 0xcc, 0xcb, 0xab, 0xa9,
+	0xab, 0xbc, 0xca, 0x90, 0x00, 0x09, 0xbd, 0xba, 0x83, 0x64, 0x33, 0x22, 0x21, 0x24, 0x34, 0x35,
+	0x35, 0x34, 0x23, 0x23, 0x35, 0x44, 0x43, 0x33, 0x32, 0x13, 0x25, 0x35, 0x33, 0x32, 0x21, 0x02,
+	0x13, 0x44, 0x33, 0x22, 0x23, 0x35, 0x34, 0x32, 0x21, 0x88, 0x99, 0x9a, 0xad, 0xcd, 0xcb, 0xdb,
+	0xcb, 0xaa, 0x9a, 0x99, 0xbb, 0xec, 0xcb, 0xbd, 0xab, 0xbb, 0xbb, 0xcb, 0xbc, 0xbc, 0xab, 0xaa,
+	0x9a, 0x9a, 0xac, 0xbd, 0xcb, 0xbb, 0xa8, 0x80, 0x08, 0xbc, 0xca, 0x83, 0x65, 0x43, 0x23, 0x22,
+	0x54, 0x44, 0x34, 0x33, 0x33, 0x35, 0x34, 0x33, 0x44, 0x23, 0x32, 0x21, 0x08, 0x88, 0x88, 0x10,
+	0x10, 0x08, 0x88, 0x08, 0x00, 0x80, 0x80, 0x08, 0x8a, 0xbb, 0x98, 0x10, 0x9d, 0xcb, 0x98, 0x10,
+	0x9d, 0xcb, 0x91, 0x44, 0x20, 0xbd, 0xba, 0x81, 0x28, 0xbe, 0xca, 0x92, 0x20, 0xcf, 0xdb, 0x91,
+	0x42, 0x9f, 0xff, 0xeb, 0xbc, 0xbc, 0xbc, 0xbc, 0xa9, 0x98, 0x80, 0x00, 0x88, 0x80, 0x80, 0x00,
+	0x88, 0x89, 0x80, 0x80, 0x88, 0x88, 0x80, 0x08, 0x8a, 0xbb, 0xa0, 0x23, 0x20, 0xbc, 0xb9, 0x26,
+	0x32, 0x09, 0xaa, 0x80, 0x33, 0x1a, 0xbd, 0x90, 0x54, 0x42, 0x10, 0x88, 0x00, 0x18, 0x9b, 0xa1,
+	0x57, 0x33, 0x10, 0x98, 0x17, 0x33, 0x09, 0xdb, 0x91, 0x65, 0x32, 0x9b, 0xd9, 0x37, 0x77, 0x73,
+	0x42, 0x33, 0x33, 0x43, 0x34, 0x42, 0x32, 0x21, 0x00, 0x08, 0x80, 0x08, 0x00, 0x80, 0x80, 0x00,
+	0x00, 0x08, 0x88, 0x80, 0x02, 0x11, 0x00, 0x88, 0x02, 0x34, 0x22, 0x09, 0xa9, 0x90, 0x36, 0x43,
+	0x31, 0x19, 0xaa, 0x90, 0x46, 0x43, 0x10, 0x08, 0x82, 0x46, 0x33, 0x41, 0x21, 0x09, 0x99, 0x91,
+	0x26, 0x43, 0x22, 0x88, 0x98, 0x80, 0x08, 0x88, 0x12, 0x29, 0xbe, 0xb1, 0x64, 0x18, 0xde, 0xba,
+	0x90, 0x00, 0x99, 0x37, 0x71, 0xcf, 0xff, 0xdb, 0xbc, 0xbb, 0xca, 0xcb, 0xbc, 0xbb, 0xa9, 0x99,
+	0x08, 0x00, 0x88, 0x98, 0x08, 0x00, 0x89, 0x98, 0x98, 0x00, 0x88, 0x89, 0xa8, 0x00, 0x08, 0xab,
+	0xcb, 0xaa, 0xaa, 0xcb, 0xbc, 0xab, 0xcb, 0xca, 0xa8, 0x81, 0x89, 0xdc, 0xda, 0xaa, 0xa9, 0xbc,
+	0xcb, 0xba, 0x98, 0x00, 0x9c, 0xfd, 0xcb, 0xba, 0x98, 0x00, 0x88, 0x00, 0x89, 0xfd, 0xc9, 0x27,
+	0x77, 0x72, 0x34, 0x22, 0x23, 0x22, 0x33, 0x53, 0x23, 0x22, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x12, 0x11, 0x10, 0x08, 0x80, 0x80, 0x89, 0xba, 0xbb, 0xbc, 0xcb, 0xca, 0x92, 0x34,
+	0x33, 0x33, 0x65, 0x34, 0x22, 0x11, 0x34, 0x64, 0x34, 0x34, 0x32, 0x31, 0x08, 0x98, 0x24, 0x54,
+	0x20, 0x8a, 0xbb, 0xca, 0x99, 0x99, 0xab, 0xba, 0xa8, 0x80, 0x11, 0x09, 0x80, 0x47, 0x73, 0x42,
+	0x10, 0x88, 0x02, 0x54, 0x33, 0x11, 0x02, 0x45, 0x42, 0x19, 0xbe, 0xb9, 0x01, 0x38, 0xef, 0xec,
+	0xbd, 0xab, 0xbb, 0xbc, 0xcb, 0xcb, 0xca, 0xa9, 0x98, 0x9a, 0xdc, 0xcc, 0xba, 0x99, 0x99, 0xac,
+	0xdb, 0xca, 0x88, 0x00, 0x00, 0x08, 0x90, 0x81, 0x00, 0x99, 0x99, 0x80, 0x10, 0x8a, 0x99, 0x02,
+	0x52, 0x08, 0xbc, 0xa9, 0x12, 0x0b, 0xff, 0xca, 0xb8, 0x80, 0x11, 0x00, 0x11, 0x43, 0x43, 0x31,
+	0x01, 0x02, 0x32, 0x18, 0xdd, 0xcb, 0xb9, 0x12, 0x43, 0x0b, 0xfe, 0xb9, 0x27, 0x75, 0x43, 0x52,
+	0x32, 0x22, 0x22, 0x43, 0x43, 0x33, 0x21, 0x18, 0x89, 0x88, 0x81, 0x11, 0x21, 0x19, 0x9b, 0xba,
+	0xa0, 0x02, 0x18, 0x9d, 0xbd, 0xaa, 0xa8, 0x80, 0x10, 0x8a, 0xed, 0xcb, 0xbb, 0xa8, 0x98, 0xbd,
+	0xdb, 0xcb, 0xa9, 0x88, 0x80, 0x01, 0x33, 0x52, 0x00, 0x88, 0x13, 0x74, 0x22, 0x22, 0x22, 0x53,
+	0x43, 0x33, 0x32, 0x19, 0xbf, 0xbb, 0xa9, 0x01, 0x8a, 0xec, 0xc9, 0x91, 0x23, 0x20, 0x9a, 0x90,
+	0x45, 0x33, 0x09, 0x98, 0x47, 0x54, 0x32, 0x10, 0xab, 0xdd, 0xbe, 0xbc, 0xcb, 0xbc, 0xbb, 0xcc,
+	0xbc, 0xba, 0xba, 0xac, 0xbd, 0xcc, 0xbb, 0xbb, 0xba, 0xaa, 0x88, 0x11, 0x22, 0x11, 0x00, 0x00,
+	0x10, 0x01, 0x01, 0x22, 0x42, 0x20, 0x8a, 0xaa, 0x88, 0x10, 0xab, 0xdb, 0x91, 0x36, 0x21, 0x9d,
+	0xcd, 0xcc, 0xca, 0xba, 0x81, 0x34, 0x33, 0x09, 0xac, 0xa9, 0x14, 0x33, 0x28, 0xcc, 0xcb, 0xa8,
+	0x13, 0x43, 0x20, 0xac, 0xa4, 0x77, 0x77, 0x43, 0x34, 0x22, 0x32, 0x34, 0x34, 0x32, 0x31, 0x00,
+	0x88, 0x80, 0x88, 0x88, 0x89, 0x89, 0x08, 0x01, 0x01, 0x12, 0x12, 0x10, 0x00, 0x80, 0x89, 0xcd,
+	0xcc, 0xbb, 0xa9, 0x89, 0xab, 0xdb, 0xa9, 0x01, 0x89, 0xdd, 0xba, 0x92, 0x21, 0x9f, 0xec, 0xa9,
+	0x04, 0x35, 0x21, 0x9a, 0xbb, 0xca, 0x99, 0x89, 0x80, 0x8a, 0xbd, 0xdb, 0xba, 0x81, 0x11, 0x9d,
+	0xdd, 0xbc, 0xa9, 0x98, 0x98, 0x99, 0x80, 0x12, 0x12, 0x09, 0x9c, 0xcb, 0xcb, 0xb9, 0x13, 0x42,
+	0x8e, 0xec, 0xdb, 0xcb, 0xbc, 0xcc, 0xcc, 0xcb, 0xcb, 0xbc, 0xbb, 0xbb, 0xba, 0xbc, 0xbd, 0xcb,
+	0xcc, 0xab, 0xba, 0x99, 0x80, 0x08, 0x08, 0x88, 0x00, 0x12, 0x11, 0x00, 0x02, 0x22, 0x18, 0xaa,
+	0x84, 0x77, 0x33, 0x42, 0x32, 0x42, 0x32, 0x21, 0x00, 0x13, 0x54, 0x33, 0x18, 0x9b, 0xa8, 0x03,
+	0x22, 0x8c, 0xcc, 0xbb, 0xbc, 0xcc, 0xcb, 0xaa, 0x81, 0x23, 0x20, 0x81, 0x57, 0x75, 0x44, 0x44,
+	0x33, 0x44, 0x33, 0x23, 0x12, 0x11, 0x23, 0x44, 0x42, 0x21, 0x08, 0x99, 0x89, 0x89, 0x9a, 0xaa,
+	0xa9, 0x81, 0x11, 0x10, 0x89, 0x89, 0x9a, 0x80, 0x26, 0x54, 0x33, 0x21, 0x89, 0x9a, 0x81, 0x35,
+	0x44, 0x33, 0x21, 0x8a, 0xec, 0xcb, 0xbb, 0xa9, 0x08, 0x00, 0x9a, 0xbd, 0xba, 0xb8, 0x82, 0x54,
+	0x33, 0x29, 0xde, 0xcb, 0xbb, 0x80, 0x44, 0x44, 0x23, 0x10, 0x89, 0xbb, 0xb8, 0x02, 0x44, 0x22,
+	0x08, 0x88, 0x15, 0x44, 0x30, 0x8c, 0xdc, 0xa9, 0x81, 0x09, 0xcf, 0xcc, 0xaa, 0x98, 0x99, 0xbc,
+	0xcc, 0xab, 0xac, 0xcd, 0xcc, 0xbb, 0xaa, 0xaa, 0xbd, 0xbd, 0xbc, 0xbc, 0xbb, 0xbc, 0xba, 0x99,
+	0x89, 0x89, 0xa9, 0x98, 0x81, 0x80, 0x9a, 0xbb, 0xcb, 0xa8, 0x01, 0x34, 0x34, 0x23, 0x21, 0x22,
+	0x45, 0x34, 0x31, 0x19, 0xab, 0xba, 0xaa, 0xbd, 0xcc, 0xba, 0x02, 0x53, 0x42, 0x09, 0xaa, 0x80,
+	0x35, 0x32, 0x23, 0x55, 0x43, 0x21, 0x80, 0x57, 0x75, 0x43, 0x43, 0x23, 0x34, 0x43, 0x33, 0x33,
+	0x34, 0x34, 0x33, 0x32, 0x20, 0x00, 0x80, 0x00, 0x08, 0x88, 0x12, 0x32, 0x19, 0xcb, 0xb9, 0x01,
+	0x0c, 0xfc, 0xcb, 0xba, 0xa9, 0x9a, 0xaa, 0x80, 0x24, 0x42, 0x20, 0x09, 0x00, 0x34, 0x52, 0x20,
+	0x9a, 0xb9, 0x04, 0x43, 0x30, 0xbe, 0xdb, 0xcb, 0xba, 0xaa, 0x99, 0x8a, 0xaa, 0xc9, 0x83, 0x65,
+	0x43, 0x42, 0x32, 0x23, 0x36, 0x34, 0x34, 0x22, 0x21, 0x12, 0x21, 0x32, 0x33, 0x33, 0x63, 0x52,
+	0x31, 0x19, 0xa9, 0x03, 0x73, 0x21, 0xbd, 0xcb, 0x81, 0x22, 0xaf, 0xfd, 0xcb, 0xcb, 0xbb, 0xcb,
+	0xcb, 0xbb, 0xbc, 0xac, 0xab, 0xcc, 0xbc, 0xbc, 0xbb, 0xb9, 0x88, 0x01, 0x09, 0x9b, 0xba, 0xa9,
+	0x9a, 0xaa, 0xa8, 0x14, 0x33, 0x29, 0xdd, 0xcb, 0xba, 0x98, 0x11, 0x18, 0xbe, 0xdb, 0xca, 0x98,
+	0x01, 0x12, 0x10, 0x89, 0xcb, 0xba, 0x98, 0x9d, 0xec, 0xcb, 0xba, 0x98, 0x9b, 0xcc, 0xb8, 0x15,
+	0x65, 0x34, 0x33, 0x42, 0x43, 0x34, 0x23, 0x33, 0x43, 0x44, 0x33, 0x23, 0x21, 0x10, 0x00, 0x11,
+	0x32, 0x21, 0x9c, 0xcd, 0xaa, 0x90, 0x11, 0x08, 0xab, 0xba, 0x01, 0x23, 0x8c, 0xec, 0xa9, 0x82,
+	0x44, 0x32, 0x20, 0x08, 0x98, 0x80, 0x12, 0x45, 0x54, 0x53, 0x53, 0x42, 0x23, 0x23, 0x54, 0x53,
+	0x43, 0x32, 0x22, 0x11, 0x22, 0x32, 0x18, 0x9a, 0xbb, 0x80, 0x45, 0x33, 0x32, 0x10, 0x08, 0xac,
+	0xec, 0xcb, 0xaa, 0x88, 0x00, 0x11, 0x13, 0x34, 0x22, 0x9b, 0xeb, 0xb8, 0x25, 0x54, 0x32, 0x42,
+	0x33, 0x33, 0x21, 0x11, 0x19, 0xdf, 0xfd, 0xbc, 0xbb, 0xbb, 0xbd, 0xbc, 0xca, 0xbb, 0xba, 0xbc,
+	0xab, 0xbb, 0xcb, 0xaa, 0x80, 0x11, 0x22, 0x10, 0x11, 0x45, 0x35, 0x33, 0x22, 0x11, 0x21, 0x12,
+	0x12, 0x35, 0x35, 0x33, 0x20, 0xad, 0xcc, 0xa9, 0x02, 0x44, 0x22, 0x0a, 0xcb, 0xcb, 0x99, 0x99,
+	0xbd, 0xdd, 0xbb, 0xb9, 0x90, 0x11, 0x11, 0x8a, 0xaa, 0x90, 0x45, 0x43, 0x28, 0xbe, 0xcb, 0xaa,
+	0x80, 0x09, 0xbc, 0xbb, 0x82, 0x34, 0x0b, 0xfd, 0xbb, 0xa9, 0x00, 0x00, 0xaa, 0xcc, 0xcb, 0xcb,
+	0xa8, 0x03, 0x44, 0x32, 0x20, 0x02, 0x54, 0x43, 0x32, 0x23, 0x45, 0x44, 0x33, 0x21, 0x01, 0x24,
+	0x44, 0x44, 0x33, 0x43, 0x34, 0x33, 0x43, 0x33, 0x41, 0x20, 0x08, 0x01, 0x24, 0x42, 0x21, 0x00,
+	0x01, 0x34, 0x32, 0x08, 0xbb, 0xcb, 0xba, 0xa8, 0x02, 0x32, 0x8d, 0xfc, 0xca, 0x90, 0x13, 0x33,
+	0x20, 0x08, 0x80, 0x13, 0x34, 0x21, 0x23, 0x43, 0x1b, 0xff, 0xfe, 0xbb, 0xdb, 0xcb, 0xbb, 0xbb,
+	0xbb, 0xaa, 0xab, 0xcc, 0xcb, 0xcb, 0xbb, 0xaa, 0xa9, 0x88, 0x89, 0x9c, 0xbd, 0xa9, 0x83, 0x44,
+	0x42, 0x11, 0x10, 0x02, 0x12, 0x22, 0x44, 0x43, 0x52, 0x31, 0x23, 0x36, 0x34, 0x22, 0x20, 0x80,
+	0x13, 0x64, 0x34, 0x34, 0x23, 0x21, 0x18, 0x88, 0x13, 0x74, 0x31, 0x09, 0xdc, 0xbb, 0x99, 0x88,
+	0xbd, 0xdc, 0xba, 0x98, 0x02, 0x12, 0x08, 0xaa, 0xaa, 0x99, 0x80, 0x13, 0x44, 0x33, 0x21, 0x11,
+	0x12, 0x22, 0x10, 0x90, 0x04, 0x42, 0x30, 0x88, 0x89, 0xcf, 0xff, 0xcc, 0xba, 0xba, 0xaa, 0xcb,
+	0xdc, 0xab, 0x98, 0x02, 0x34, 0x34, 0x33, 0x43, 0x54, 0x43, 0x53, 0x33, 0x42, 0x32, 0x32, 0x42,
+	0x32, 0x11, 0x08, 0xaa, 0xab, 0x90, 0x15, 0x33, 0x21, 0x8a, 0xa8, 0x37, 0x63, 0x34, 0x11, 0x08,
+	0x01, 0x14, 0x34, 0x32, 0x21, 0x00, 0x02, 0x35, 0x23, 0x22, 0x10, 0x21, 0x2a, 0xff, 0xcd, 0xab,
+	0x98, 0x11, 0x18, 0xac, 0xda, 0xa9, 0x08, 0x0a, 0xbe, 0xbb, 0x98, 0x18, 0x8b, 0xdc, 0xa8, 0x13,
+	0x52, 0x21, 0x00, 0x00, 0x24, 0x23, 0x34, 0x33, 0x41, 0x9c, 0xdc, 0xba, 0x80, 0x09, 0xcf, 0xbd,
+	0xaa, 0x88, 0x99, 0xbd, 0xcb, 0xbc, 0xbb, 0xba, 0xa9, 0x88, 0x8a, 0xed, 0xbd, 0xaa, 0x99, 0x89,
+	0x9c, 0xbe, 0xbc, 0xca, 0xbc, 0xa9, 0x99, 0x99, 0xab, 0xbb, 0x90, 0x13, 0x20, 0xbd, 0xca, 0x83,
+	0x55, 0x33, 0x22, 0x00, 0x12, 0x54, 0x53, 0x34, 0x21, 0x11, 0x10, 0x12, 0x11, 0x18, 0xbc, 0xbc,
+	0x90, 0x14, 0x42, 0x09, 0xec, 0xcc, 0xba, 0xa9, 0x80, 0x11, 0x01, 0x11, 0x24, 0x64, 0x43, 0x43,
+	0x33, 0x21, 0x21, 0x23, 0x43, 0x42, 0x00, 0x8a, 0xbb, 0xab, 0xab, 0xaa, 0xcd, 0xdd, 0xdb, 0xcb,
+	0xa9, 0x81, 0x23, 0x22, 0x10, 0x22, 0x54, 0x43, 0x53, 0x34, 0x34, 0x22, 0x21, 0x01, 0x22, 0x34,
+	0x22, 0x23, 0x46, 0x53, 0x43, 0x32, 0x11, 0x11, 0x24, 0x44, 0x34, 0x33, 0x33, 0x23, 0x23, 0x43,
+	0x44, 0x33, 0x43, 0x23, 0x33, 0x43, 0x42, 0x22, 0x23, 0x34, 0x33, 0x21, 0x89, 0xa9, 0x02, 0x43,
+	0x29, 0xed, 0xdb, 0xaa, 0x88, 0x9a, 0xed, 0xcb, 0xab, 0x99, 0x89, 0xbb, 0xdc, 0xbc, 0xbc, 0xcc,
+	0xbc, 0xbc, 0xbc, 0xbc, 0xab, 0xaa, 0xba, 0xca, 0xcb, 0xab, 0xba, 0xba, 0xbc, 0xbb, 0xca, 0xba,
+	0xbc, 0xca, 0xa9, 0x80, 0x08, 0x01, 0x14, 0x44, 0x43, 0x23, 0x33, 0x44, 0x24, 0x23, 0x23, 0x42,
+	0x22, 0x34, 0x44, 0x23, 0x20, 0x89, 0xa8, 0x80, 0x11, 0x88, 0x99, 0x8a, 0xcf, 0xde, 0xbd, 0xba,
+	0xaa, 0xaa, 0xbc, 0xcb, 0xaa, 0xa9, 0xaa, 0xab, 0xca, 0xaa, 0xab, 0xca, 0xba, 0xaa, 0xbd, 0xbc,
+	0xba, 0x98, 0x8a, 0xcd, 0xdc, 0xcb, 0xcb, 0xbb, 0xa9, 0x80, 0x12, 0x01, 0x00, 0x24, 0x54, 0x33,
+	0x33, 0x43, 0x64, 0x44, 0x33, 0x43, 0x42, 0x34, 0x32, 0x33, 0x32, 0x34, 0x23, 0x23, 0x34, 0x35,
+	0x34, 0x34, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x34, 0x35, 0x43, 0x43, 0x34,
+	0x23, 0x23, 0x34, 0x22, 0x32, 0x43, 0x35, 0x34, 0x22, 0x11, 0x88, 0x88, 0x89, 0x88, 0x9a, 0x98,
+	0x98, 0x9a, 0xcd, 0xbd, 0xaa, 0xaa, 0xbd, 0xcd, 0xcb, 0xab, 0x9a, 0x9b, 0xbe, 0xbc, 0xbb, 0xbb,
+	0xcb, 0xcb, 0xcb, 0xca, 0xbb, 0xab, 0x9a, 0xa9, 0xaa, 0xbb, 0xaa, 0x9a, 0xbe, 0xcc, 0xcb, 0xbc,
+	0xbd, 0xba, 0xa8, 0x13, 0x53, 0x32, 0x18, 0x9a, 0x9a, 0xac, 0xdd, 0xbb, 0xbb, 0xbb, 0xdc, 0xdb,
+	0xca, 0xba, 0xba, 0xbc, 0xaa, 0xba, 0xbb, 0xdb, 0xcb, 0xba, 0xa9, 0xbc, 0xeb, 0xdb, 0xaa, 0xaa,
+	0x99, 0x98, 0x82, 0x36, 0x35, 0x23, 0x22, 0x12, 0x12, 0x23, 0x44, 0x34, 0x31, 0x08, 0xac, 0xab,
+	0xb9, 0xaa, 0xab, 0xca, 0x92, 0x56, 0x42, 0x20, 0x9a, 0xaa, 0x03, 0x34, 0x8d, 0xfd, 0xcb, 0xcc,
+	0xbb, 0xbc, 0xbb, 0xbb, 0xcc, 0xab, 0xca, 0xbb, 0xcb, 0xca, 0x99, 0x88, 0x08, 0x98, 0x90, 0x01,
+	0x32, 0x33, 0x35, 0x64, 0x54, 0x44, 0x34, 0x33, 0x43, 0x42, 0x33, 0x34, 0x33, 0x23, 0x21, 0x22,
+	0x34, 0x44, 0x32, 0x32, 0x13, 0x25, 0x33, 0x32, 0x10, 0x88, 0x02, 0x43, 0x30, 0xae, 0xdc, 0xab,
+	0xa9, 0x9a, 0xbc, 0xdb, 0xcc, 0xaa, 0xbb, 0xbc, 0xbc, 0xba, 0xa9, 0x80, 0x11, 0x11, 0x00, 0x35,
+	0x63, 0x42, 0x28, 0x9a, 0xaa, 0xa9, 0xbc, 0xcc, 0xbc, 0xca, 0xbc, 0xba, 0x90, 0x01, 0x20, 0x10,
+	0x25, 0x44, 0x42, 0x11, 0x08, 0x08, 0x00, 0x88, 0x08, 0x00, 0x9a, 0xec, 0xcb, 0x81, 0x33, 0x1c,
+	0xfe, 0xba, 0x90, 0x34, 0x32, 0x10, 0x23, 0x74, 0x32, 0x31, 0x11, 0x35, 0x44, 0x34, 0x22, 0x11,
+	0x21, 0x11, 0x00, 0x99, 0x9b, 0xbc, 0xeb, 0xeb, 0xcb, 0xbc, 0xab, 0xa8, 0x82, 0x24, 0x32, 0x22,
+	0x22, 0x44, 0x44, 0x43, 0x33, 0x32, 0x09, 0xbd, 0xbc, 0xaa, 0xaa, 0xbd, 0xcd, 0xbb, 0xcb, 0xbb,
+	0xca, 0xbb, 0xca, 0xbc, 0xbb, 0xbb, 0x88, 0x11, 0x0a, 0xcd, 0xba, 0x81, 0x25, 0x35, 0x44, 0x44,
+	0x34, 0x23, 0x23, 0x33, 0x44, 0x33, 0x32, 0x34, 0x23, 0x32, 0x21, 0x08, 0x01, 0x11, 0x0a, 0xcc,
+	0xbb, 0x81, 0x34, 0x43, 0x30, 0x8c, 0xfc, 0xdb, 0xba, 0xa9, 0x88, 0xab, 0xec, 0xcb, 0xaa, 0xa9,
+	0x88, 0x89, 0x88, 0xab, 0xdc, 0xbb, 0xa8, 0x02, 0x10, 0x9c, 0xdb, 0xbb, 0xcc, 0xcb, 0xdb, 0xaa,
+	0xa8, 0x88, 0x99, 0x99, 0x02, 0x34, 0x20, 0x88, 0x03, 0x77, 0x33, 0x21, 0x0a, 0xbd, 0xbd, 0xab,
+	0xab, 0xbd, 0xbc, 0xcb, 0xbb, 0xab, 0xbb, 0xcb, 0xdb, 0xbc, 0xb9, 0x98, 0x13, 0x43, 0x32, 0x10,
+	0x82, 0x56, 0x54, 0x43, 0x23, 0x32, 0x43, 0x34, 0x32, 0x21, 0x01, 0x11, 0x11, 0x19, 0x9b, 0xcc,
+	0xab, 0xb9, 0x98, 0x25, 0x53, 0x33, 0x10, 0x9a, 0xba, 0x9a, 0xa9, 0x90, 0x37, 0x64, 0x23, 0x10,
+	0x9a, 0xcc, 0xcc, 0xbc, 0xbb, 0xaa, 0x9a, 0xbe, 0xcd, 0xcb, 0xcb, 0xab, 0xbb, 0xca, 0x98, 0x88,
+	0x88, 0x88, 0x14, 0x55, 0x43, 0x33, 0x34, 0x33, 0x43, 0x34, 0x32, 0x32, 0x43, 0x35, 0x42, 0x32,
+	0x21, 0x11, 0x24, 0x43, 0x21, 0x18, 0x01, 0x45, 0x43, 0x22, 0x10, 0x00, 0x22, 0x43, 0x53, 0x43,
+	0x44, 0x22, 0x10, 0x88, 0x01, 0x22, 0x28, 0xac, 0xcb, 0xca, 0xbc, 0xbd, 0xab, 0x99, 0x98, 0x08,
+	0x02, 0x43, 0x43, 0x11, 0x88, 0x80, 0x11, 0x08, 0xab, 0x90, 0x55, 0x29, 0xdf, 0xcc, 0xba, 0xaa,
+	0xbc, 0xcb, 0xbb, 0xcb, 0xcc, 0xcb, 0xbc, 0xab, 0xac, 0xac, 0xaa, 0xab, 0xbb, 0xeb, 0xcb, 0xbb,
+	0xbb, 0x99, 0x80, 0x02, 0x22, 0x53, 0x54, 0x43, 0x22, 0x21, 0x00, 0x13, 0x54, 0x33, 0x31, 0x08,
+	0xa9, 0x80, 0x23, 0x33, 0x09, 0xcc, 0xaa, 0x15, 0x64, 0x52, 0x33, 0x21, 0x00, 0x08, 0x80, 0x80,
+	0x89, 0xbf, 0xec, 0xcc, 0xbb, 0xbb, 0xdb, 0xbc, 0xbc, 0xbb, 0xbc, 0xaa, 0xaa, 0xab, 0xcc, 0xcb,
+	0xcb, 0xbb, 0xaa, 0xbb, 0xbc, 0xbb, 0xba, 0x98, 0x81, 0x11, 0x34, 0x34, 0x42, 0x11, 0x01, 0x26,
+	0x55, 0x43, 0x34, 0x33, 0x44, 0x35, 0x34, 0x33, 0x43, 0x32, 0x33, 0x42, 0x32, 0x32, 0x32, 0x23,
+	0x54, 0x43, 0x53, 0x23, 0x33, 0x24, 0x23, 0x22, 0x20, 0x9b, 0xcc, 0xcc, 0xbb, 0xcc, 0xbd, 0xab,
+	0xba, 0xab, 0xab, 0xbc, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0xbc, 0xaa, 0xa9, 0x88, 0x9b, 0xed, 0xcc,
+	0xca, 0xaa, 0x99, 0x00, 0x02, 0x21, 0x08, 0x88, 0x14, 0x54, 0x32, 0x11, 0x10, 0x18, 0xad, 0xec,
+	0xcc, 0xab, 0xbb, 0xdc, 0xbd, 0xbb, 0xbb, 0x9a, 0x88, 0x80, 0x01, 0x36, 0x43, 0x53, 0x34, 0x33,
+	0x44, 0x34, 0x33, 0x43, 0x33, 0x43, 0x32, 0x22, 0x21, 0x12, 0x22, 0x43, 0x42, 0x22, 0x11, 0x14,
+	0x54, 0x33, 0x31, 0x09, 0x99, 0x99, 0xad, 0xec, 0xbd, 0xbb, 0xcb, 0xbc, 0xbb, 0xbb, 0xba, 0xa9,
+	0x9a, 0xbd, 0xdb, 0xdb, 0xbc, 0xab, 0xac, 0xab, 0xcb, 0xac, 0xab, 0xaa, 0x98, 0x89, 0xab, 0xdb,
+	0xba, 0xa8, 0x88, 0x08, 0x02, 0x34, 0x22, 0x23, 0x75, 0x64, 0x43, 0x33, 0x32, 0x33, 0x43, 0x42,
+	0x32, 0x23, 0x35, 0x42, 0x32, 0x34, 0x54, 0x44, 0x33, 0x42, 0x33, 0x34, 0x33, 0x23, 0x32, 0x22,
+	0x10, 0x8a, 0xac, 0xdc, 0xdb, 0xdb, 0xcb, 0xbb, 0xcb, 0xbb, 0xca, 0xaa, 0xaa, 0x9a, 0x9a, 0x9a,
+	0x98, 0x99, 0xab, 0xcd, 0xcb, 0xcb, 0xbb, 0xbb, 0xba, 0xa8, 0x80, 0x80, 0x89, 0x90, 0x26, 0x45,
+	0x34, 0x22, 0x22, 0x21, 0x21, 0x23, 0x45, 0x35, 0x23, 0x21, 0x88, 0xab, 0xcc, 0xcb, 0xcc, 0xcb,
+	0xbb, 0xbb, 0x99, 0x00, 0x01, 0x23, 0x65, 0x54, 0x43, 0x43, 0x22, 0x33, 0x44, 0x43, 0x34, 0x43,
+	0x34, 0x34, 0x33, 0x23, 0x33, 0x42, 0x32, 0x22, 0x23, 0x33, 0x53, 0x33, 0x33, 0x11, 0x8a, 0xec,
+	0xdb, 0xcb, 0xbc, 0xbd, 0xbb, 0xda, 0xba, 0xaa, 0x9a, 0x99, 0x99, 0xaa, 0xcc, 0xbd, 0xab, 0x99,
+	0x90, 0x80, 0x88, 0xad, 0xdd, 0xbd, 0xbb, 0xaa, 0x98, 0x80, 0x00, 0x08, 0x88, 0x80, 0x11, 0x24,
+	0x22, 0x19, 0xbd, 0xbb, 0x90, 0x01, 0xaf, 0xfc, 0xcb, 0xca, 0xaa, 0xa9, 0xa9, 0x80, 0x23, 0x64,
+	0x34, 0x43, 0x53, 0x44, 0x22, 0x32, 0x22, 0x11, 0x08, 0xaa, 0xcc, 0xcb, 0xdb, 0xca, 0xba, 0xab,
+	0xbb, 0xcb, 0xaa, 0x98, 0x80, 0x08, 0x81, 0x13, 0x44, 0x34, 0x43, 0x33, 0x21, 0x08, 0x98, 0x15,
+	0x55, 0x34, 0x33, 0x34, 0x43, 0x43, 0x42, 0x23, 0x33, 0x34, 0x33, 0x32, 0x33, 0x43, 0x41, 0x19,
+	0xac, 0xdc, 0xcc, 0xcb, 0xdb, 0xba, 0xb9, 0x90, 0x00, 0x10, 0x11, 0x11, 0x22, 0x32, 0x12, 0x24,
+	0x44, 0x43, 0x43, 0x53, 0x54, 0x34, 0x33, 0x43, 0x35, 0x35, 0x23, 0x33, 0x23, 0x12, 0x22, 0x33,
+	0x43, 0x42, 0x32, 0x32, 0x21, 0x8b, 0xfd, 0xcb, 0xdb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xab, 0xca,
+	0xaa, 0x99, 0x88, 0x99, 0x9a, 0xbb, 0xcb, 0xbc, 0xab, 0x9a, 0x88, 0x00, 0x8a, 0xbd, 0xcb, 0xc9,
+	0x90, 0x24, 0x54, 0x53, 0x34, 0x22, 0x00, 0x9a, 0xbd, 0xbd, 0xca, 0xbb, 0xab, 0xaa, 0xcc, 0xbc,
+	0xba, 0xab, 0xab, 0xcb, 0xaa, 0x13, 0x74, 0x43, 0x33, 0x43, 0x44, 0x23, 0x21, 0x21, 0x22, 0x21,
+	0x8a, 0xcc, 0xb9, 0xa8, 0xab, 0xdc, 0xab, 0xbb, 0xdb, 0xdb, 0xbb, 0xba, 0xbb, 0xcb, 0xbb, 0x9a,
+	0xbc, 0xdb, 0xcb, 0xbc, 0xac, 0xba, 0xb9, 0x80, 0x22, 0x23, 0x54, 0x35, 0x34, 0x23, 0x34, 0x44,
+	0x35, 0x33, 0x34, 0x32, 0x21, 0x11, 0x02, 0x12, 0x20, 0x9c, 0xeb, 0xbb, 0xaa, 0x9a, 0xcc, 0xcb,
+	0xa9, 0x80, 0x10, 0x88, 0x03, 0x75, 0x43, 0x43, 0x34, 0x35, 0x43, 0x34, 0x32, 0x33, 0x43, 0x54,
+	0x34, 0x34, 0x33, 0x52, 0x42, 0x33, 0x33, 0x42, 0x22, 0x22, 0x22, 0x11, 0x18, 0xbc, 0xeb, 0xdb,
+	0xbc, 0xbc, 0xbc, 0xbb, 0xcb, 0xac, 0xab, 0xbb, 0xbb, 0xaa, 0xba, 0xbb, 0xab, 0x98, 0x88, 0x80,
+	0x00, 0x24, 0x44, 0x43, 0x32, 0x31, 0x08, 0xac, 0xcc, 0xcb, 0xba, 0xb9, 0x88, 0x08, 0x08, 0x88,
+	0x11, 0x10, 0xcf, 0xeb, 0xdc, 0xbb, 0xbc, 0xca, 0xbb, 0xbc, 0xcb, 0xbb, 0xba, 0x99, 0x89, 0x9a,
+	0xdc, 0xbb, 0xb9, 0x91, 0x25, 0x43, 0x43, 0x34, 0x23, 0x34, 0x43, 0x33, 0x23, 0x21, 0x23, 0x33,
+	0x42, 0x18, 0xcd, 0xdb, 0xcc, 0xaa, 0xbb, 0xdc, 0xcb, 0xcb, 0xb9, 0xaa, 0xab, 0xcc, 0xbb, 0xba,
+	0x99, 0x80, 0x13, 0x45, 0x43, 0x43, 0x44, 0x33, 0x53, 0x33, 0x32, 0x31, 0x22, 0x12, 0x18, 0x9c,
+	0xcc, 0xbb, 0xba, 0xaa, 0xaa, 0xca, 0xb9, 0x91, 0x24, 0x43, 0x42, 0x34, 0x33, 0x43, 0x23, 0x34,
+	0x54, 0x35, 0x34, 0x43, 0x53, 0x35, 0x23, 0x33, 0x53, 0x53, 0x42, 0x42, 0x23, 0x34, 0x33, 0x34,
+	0x22, 0x23, 0x43, 0x33, 0x31, 0x08, 0xab, 0xbb, 0xcc, 0xdc, 0xcc, 0xbb, 0xc9, 0xa9, 0x9b, 0xac,
+	0xcb, 0xba, 0xab, 0x9a, 0xaa, 0xbb, 0xca, 0xa9, 0x81, 0x33, 0x32, 0x34, 0x44, 0x44, 0x34, 0x23,
+	0x33, 0x43, 0x34, 0x11, 0x10, 0x88, 0x00, 0x80, 0x8a, 0xcd, 0xdb, 0xdb, 0xbb, 0xcb, 0xcb, 0xdb,
+	0xda, 0xbb, 0xab, 0xab, 0xbd, 0xbd, 0xba, 0x98, 0x01, 0x31, 0x08, 0xbb, 0xba, 0x81, 0x20, 0xbf,
+	0xec, 0xcb, 0xbc, 0xbb, 0xbc, 0xca, 0xbb, 0xbc, 0xca, 0xaa, 0x98, 0x00, 0x89, 0xaa, 0xba, 0xbb,
+	0xde, 0xcc, 0xca, 0xbb, 0xab, 0xba, 0xba, 0xa9, 0xa9, 0x91, 0x25, 0x54, 0x42, 0x33, 0x22, 0x22,
+	0x11, 0x23, 0x66, 0x44, 0x43, 0x23, 0x22, 0x22, 0x22, 0x11, 0x08, 0xab, 0xbc, 0xaa, 0xbc, 0xdc,
+	0xbd, 0xbc, 0xbb, 0xab, 0x98, 0x80, 0x00, 0x08, 0x81, 0x25, 0x64, 0x43, 0x44, 0x34, 0x33, 0x53,
+	0x43, 0x35, 0x23, 0x42, 0x34, 0x34, 0x33, 0x43, 0x23, 0x32, 0x34, 0x33, 0x43, 0x21, 0x10, 0x08,
+	0x80, 0x80, 0x88, 0x9b, 0xcc, 0xcb, 0xbb, 0xcb, 0xca, 0xbc, 0xbb, 0xca, 0xbc, 0xac, 0xab, 0xca,
+	0xb9, 0xa9, 0xaa, 0xab, 0xb9, 0x26, 0x64, 0x34, 0x32, 0x22, 0x32, 0x31, 0x0b, 0xfd, 0xbd, 0xbb,
+	0xcb, 0xbc, 0xbb, 0xcb, 0xbc, 0xab, 0xa9, 0xaa, 0x9a, 0xab, 0xcb, 0xcc, 0xbc, 0xbb, 0xaa, 0xba,
+	0xcb, 0xbb, 0xa9, 0x81, 0x00, 0xac, 0xfb, 0xdb, 0xbc, 0xbb, 0xbb, 0xbb, 0xba, 0xba, 0x99, 0x00,
+	0x12, 0x44, 0x52, 0x32, 0x21, 0x25, 0x44, 0x43, 0x31, 0x22, 0x23, 0x33, 0x29, 0xcd, 0xbb, 0x81,
+	0x35, 0x33, 0x10, 0x08, 0x88, 0x08, 0x02, 0x66, 0x53, 0x52, 0x31, 0x12, 0x24, 0x43, 0x43, 0x33,
+	0x43, 0x22, 0x8b, 0xdc, 0xca, 0xba, 0xbc, 0xbb, 0xbb, 0xcb, 0xeb, 0xcb, 0xb9, 0x00, 0x10, 0x08,
+	0x89, 0x00, 0x00, 0x80, 0x80, 0x08, 0x8a, 0xb0, 0x67, 0x55, 0x35, 0x43, 0x53, 0x44, 0x23, 0x42,
+	0x34, 0x34, 0x33, 0x33, 0x32, 0x32, 0x11, 0x10, 0x11, 0x22, 0x10, 0x88, 0x08, 0x00, 0x9a, 0xdc,
+	0xcb, 0xba, 0xa9, 0x81, 0x11, 0x18, 0xbc, 0x90, 0x56, 0x42, 0x10, 0x98, 0x14, 0x44, 0x18, 0xad,
+	0xbb, 0xba, 0xab, 0xbd, 0xbc, 0xaa, 0xcb, 0xdd, 0xbc, 0xcb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb,
+	0xab, 0x99, 0x00, 0x22, 0x34, 0x22, 0x10, 0x08, 0x80, 0x00, 0x9c, 0xdc, 0xca, 0xba, 0xbb, 0xbc,
+	0xdb, 0xdc, 0xbd, 0xca, 0xbb, 0xaa, 0xaa, 0xa9, 0x99, 0x00, 0x00, 0x08, 0x88, 0x88, 0x11, 0x08,
+	0x9a, 0x81, 0x2a, 0xff, 0xff, 0xab, 0xba, 0xba, 0xaa, 0xaa, 0x80, 0x00, 0x9c, 0xbc, 0x90, 0x26,
+	0x31, 0x19, 0xac, 0xba, 0xab, 0xbd, 0xcb, 0xbb, 0x88, 0x00, 0x8c, 0xcc, 0xbc, 0xab, 0xbb, 0xda,
+	0xa9, 0x80, 0x11, 0x88, 0x89, 0x80, 0x15, 0x65, 0x43, 0x32, 0x08, 0x98, 0x37, 0x74, 0x33, 0x32,
+	0x34, 0x44, 0x43, 0x52, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x32, 0x22, 0x22, 0x12, 0x00, 0x08,
+	0x88, 0x00, 0x80, 0x88, 0x03, 0x65, 0x54, 0x34, 0x22, 0x22, 0x01, 0x80, 0x9a, 0xbd, 0xcc, 0xcb,
+	0xcb, 0xbc, 0xaa, 0xaa, 0x88, 0x80, 0x08, 0x08, 0x02, 0x46, 0x44, 0x43, 0x32, 0x21, 0x12, 0x24,
+	0x34, 0x32, 0x10, 0x88, 0x01, 0x00, 0xae, 0xcc, 0xa9, 0x81, 0x00, 0xbf, 0xdb, 0xcb, 0xaa, 0xa9,
+	0xab, 0xbb, 0xbb, 0xcc, 0xbc, 0xbb, 0x98, 0x00, 0x8b, 0xdd, 0xbb, 0xbb, 0xcc, 0xdc, 0xca, 0xbb,
+	0xab, 0xbd, 0xbd, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xba, 0xba, 0xcc, 0xcb, 0xbc, 0xbb, 0xbd, 0xab,
+	0xbb, 0xab, 0xac, 0xbb, 0xbc, 0xbb, 0xdb, 0xbb, 0xa9, 0x01, 0x89, 0xbd, 0xb9, 0x81, 0x11, 0x08,
+	0x9a, 0x80, 0x25, 0x54, 0x54, 0x34, 0x42, 0x33, 0x35, 0x23, 0x32, 0x21, 0x21, 0x08, 0xab, 0xea,
+	0xa0, 0x16, 0x35, 0x33, 0x33, 0x44, 0x34, 0x43, 0x52, 0x43, 0x35, 0x33, 0x43, 0x34, 0x33, 0x43,
+	0x34, 0x23, 0x22, 0x12, 0x12, 0x11, 0x00, 0x88, 0x01, 0x33, 0x53, 0x32, 0x21, 0x08, 0x9a, 0x90,
+	0x45, 0x44, 0x21, 0x88, 0x98, 0x80, 0x01, 0x18, 0xad, 0xec, 0xcb, 0xbb, 0x98, 0x00, 0x89, 0x90,
+	0x37, 0x43, 0x31, 0x88, 0x98, 0x00, 0x88, 0x98, 0x24, 0x38, 0xff, 0xdc, 0xbb, 0xbb, 0xcb, 0xca,
+	0xbb, 0x9a, 0x9a, 0xbc, 0xa9, 0x80, 0x21, 0x19, 0xab, 0x90, 0x54, 0x29, 0xdf, 0xcb, 0xba, 0xa9,
+	0xaa, 0xbb, 0xca, 0xab, 0xec, 0xcb, 0xba, 0xa9, 0x9a, 0xbc, 0xab, 0xab, 0xdc, 0xdb, 0xbc, 0xbb,
+	0xbc, 0xbc, 0xab, 0xbc, 0xcb, 0xdb, 0xbb, 0xba, 0xba, 0xcb, 0xcc, 0xaa, 0xb9, 0xa9, 0xaa, 0xab,
+	0xbc, 0xbb, 0xb9, 0x91, 0x24, 0x45, 0x33, 0x34, 0x22, 0x24, 0x54, 0x35, 0x22, 0x21, 0x01, 0x22,
+	0x54, 0x34, 0x22, 0x21, 0x21, 0x32, 0x43, 0x33, 0x22, 0x08, 0xab, 0x90, 0x55, 0x43, 0x21, 0x89,
+	0x04, 0x75, 0x44, 0x32, 0x32, 0x23, 0x35, 0x43, 0x34, 0x33, 0x34, 0x22, 0x12, 0x12, 0x12, 0x23,
+	0x23, 0x34, 0x43, 0x33, 0x20, 0x98, 0x14, 0x54, 0x22, 0x09, 0xa9, 0x90, 0x36, 0x34, 0x43, 0x23,
+	0x32, 0x08, 0xab, 0x90, 0x55, 0x43, 0x21, 0x08, 0x99, 0x80, 0x11, 0x08, 0x99, 0x81, 0x0c, 0xff,
+	0xfb, 0xbb, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbe, 0xcd, 0xbc, 0xaa, 0x9a, 0xab, 0xeb, 0xca, 0xbb,
+	0xbd, 0xab, 0xba, 0x99, 0xbc, 0xcc, 0xbb, 0xa9, 0x88, 0x80, 0x01, 0x44, 0x34, 0x32, 0x10, 0x88,
+	0x02, 0x45, 0x53, 0x22, 0x00, 0x88, 0x11, 0x00, 0xbe, 0xcb, 0xab, 0xbc, 0xdd, 0xbc, 0xaa, 0xa9,
+	0xaa, 0xbb, 0xa8, 0x01, 0x9b, 0xec, 0xaa, 0x00, 0x18, 0xcd, 0xdb, 0xa9, 0x80, 0x08, 0x9a, 0xdb,
+	0xbc, 0xbb, 0xba, 0x90, 0x45, 0x42, 0x10, 0x88, 0x02, 0x54, 0x33, 0x33, 0x43, 0x43, 0x20, 0x09,
+	0x02, 0x55, 0x41, 0x08, 0xaa, 0xa1, 0x45, 0x32, 0x18, 0x98, 0x27, 0x44, 0x41, 0x20, 0x10, 0x22,
+	0x33, 0x41, 0x22, 0x33, 0x53, 0x42, 0x12, 0x24, 0x44, 0x44, 0x22, 0x12, 0x02, 0x13, 0x43, 0x32,
+	0x22, 0x35, 0x43, 0x33, 0x18, 0x88, 0x13, 0x64, 0x32, 0x33, 0x53, 0x33, 0x20, 0x98, 0x14, 0x63,
+	0x20, 0xae, 0xcb, 0xb9, 0x80, 0x18, 0x9b, 0xcc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xbd, 0xcd, 0xbd,
+	0xab, 0x99, 0x89, 0x9b, 0xdc, 0xca, 0xb9, 0xa9, 0xab, 0xdc, 0xbc, 0xbb, 0xaa, 0xa9, 0xaa, 0xab,
+	0xdb, 0xba, 0xa8, 0x00, 0x08, 0x90, 0x14, 0x64, 0x43, 0x32, 0x21, 0x08, 0xaa, 0x91, 0x37, 0x43,
+	0x31, 0x88, 0x98, 0x08, 0x00, 0x88, 0x02, 0x20, 0xdf, 0xeb, 0xaa, 0x81, 0x12, 0x08, 0xab, 0x90,
+	0x55, 0x53, 0x32, 0x09, 0xaa, 0xa1, 0x46, 0x42, 0x21, 0x09, 0x88, 0x00, 0x88, 0x80, 0x01, 0x18,
+	0xbc, 0xa1, 0x64, 0x28, 0xfd, 0xbb, 0x90, 0x10, 0xae, 0xca, 0x91, 0x35, 0x21, 0x88, 0x82, 0x54,
+	0x21, 0x88, 0x92, 0x44, 0x42, 0x09, 0xaa, 0x81, 0x23, 0x19, 0xcc, 0x90, 0x55, 0x33, 0x10, 0x98,
+	0x15, 0x43, 0x30, 0x88, 0x83, 0x64, 0x31, 0x08, 0xa9, 0x80, 0x21, 0x88, 0x92, 0x77, 0x35, 0x21,
+	0x88, 0x80, 0x13, 0x52, 0x10, 0x88, 0x04, 0x43, 0x31, 0x89, 0x83, 0x64, 0x32, 0x09, 0xaa, 0x80,
+	0x32, 0x19, 0xbc, 0x91, 0x44, 0x18, 0xde, 0xbc, 0x98, 0x00, 0x8a, 0xdc, 0xbb, 0xbb, 0xcb, 0xca,
+	0xba, 0xbd, 0xcc, 0xcc, 0xaa, 0x99, 0x9a, 0xba, 0xb9, 0x81, 0x11, 0x09, 0x98, 0x80, 0x10, 0x08,
+	0x89, 0x80, 0x11, 0x08, 0xa8, 0x90, 0x11, 0x00, 0x89, 0x00, 0x01, 0x08, 0x89, 0x00, 0x01, 0x00,
+	0x89, 0x00, 0x01, 0x00, 0x89, 0x90, 0x12, 0x18, 0xab, 0x90, 0x43, 0x2a, 0xcc, 0xa1, 0x54, 0x29,
+	0xdd, 0xa0, 0x66, 0x43, 0x10, 0x88, 0x03, 0x54, 0x41, 0x09, 0x99, 0x80, 0x12, 0x19, 0xab, 0xa0,
+	0x66, 0x34, 0x21, 0x08, 0x99, 0x00, 0x00, 0x00, 0x98, 0x80, 0x00, 0x00, 0x99, 0x00, 0x10, 0x00,
+	0x89, 0x00, 0x01, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+};
+
+static const unsigned char sndbank_shot[4097] = {
+	0x0f, 0xff, 0xf9, 0x00, 0x09, 0xab, 0xca, 0x81, 0x25, 0x36, 0x54, 0x43, 0x53, 0x23, 0x32, 0x32,
+	0x23, 0x22, 0x32, 0x21, 0x18, 0x08, 0x01, 0x44, 0x34, 0x22, 0x23, 0x65, 0x44, 0x35, 0x23, 0x34,
+	0x34, 0x44, 0x32, 0x31, 0x8b, 0xdc, 0xdc, 0xbb, 0xcb, 0xbb, 0xab, 0xcb, 0xcc, 0xbc, 0xcb, 0xcb,
+	0xbb, 0xa9, 0x91, 0x11, 0x00, 0xab, 0xcb, 0x90, 0x36, 0x53, 0x43, 0x33, 0x31, 0x20, 0x00, 0x03,
+	0x55, 0x34, 0x28, 0xaf, 0xbc, 0xb9, 0x13, 0x63, 0x41, 0x0a, 0xdc, 0xbc, 0xa9, 0x80, 0x11, 0x11,
+	0x09, 0xac, 0xcc, 0xba, 0xba, 0x99, 0xab, 0xdc, 0xcb, 0xa9, 0x24, 0x63, 0x42, 0x10, 0x9a, 0xba,
+	0x80, 0x44, 0x34, 0x22, 0x08, 0x99, 0x81, 0x36, 0x53, 0x43, 0x20, 0x08, 0x80, 0x44, 0x54, 0x33,
+	0x11, 0x88, 0x90, 0x03, 0x45, 0x33, 0x21, 0x8a, 0xcd, 0xcb, 0xbb, 0x99, 0x89, 0xbd, 0xdc, 0xbb,
+	0xa9, 0x80, 0x18, 0xab, 0xeb, 0xaa, 0x01, 0x22, 0x10, 0xab, 0xeb, 0xa9, 0x14, 0x74, 0x43, 0x32,
+	0x18, 0x99, 0x81, 0x44, 0x41, 0x09, 0xbc, 0xaa, 0x81, 0x21, 0x0a, 0xbb, 0xb8, 0x23, 0x42, 0x01,
+	0x37, 0x63, 0x42, 0x09, 0x99, 0x26, 0x73, 0x42, 0x18, 0xbb, 0xca, 0x80, 0x11, 0x0b, 0xdc, 0xba,
+	0x01, 0x33, 0x1a, 0xee, 0xbb, 0xa9, 0x81, 0x09, 0xbe, 0xcb, 0xba, 0x90, 0x21, 0x10, 0x88, 0x82,
+	0x45, 0x33, 0x19, 0xcc, 0xba, 0x80, 0x22, 0x18, 0xbf, 0xca, 0xb9, 0x03, 0x54, 0x43, 0x32, 0x10,
+	0x9a, 0xba, 0x80, 0x35, 0x33, 0x10, 0xac, 0xbb, 0x93, 0x77, 0x43, 0x42, 0x20, 0x08, 0x81, 0x25,
+	0x43, 0x31, 0x08, 0xaa, 0x81, 0x44, 0x43, 0x20, 0x89, 0xa9, 0x88, 0x89, 0xad, 0xcc, 0xcb, 0xcb,
+	0xdc, 0xbc, 0xaa, 0x01, 0x34, 0x21, 0x8b, 0xbb, 0x92, 0x45, 0x20, 0xaf, 0xdc, 0xab, 0x98, 0x01,
+	0x12, 0x22, 0x33, 0x43, 0x22, 0x18, 0x9a, 0x82, 0x55, 0x53, 0x22, 0x08, 0xbc, 0xbd, 0xba, 0xaa,
+	0x00, 0x36, 0x34, 0x32, 0x28, 0x8a, 0xcb, 0xbb, 0xbc, 0xba, 0xbb, 0x98, 0x13, 0x33, 0x20, 0xab,
+	0xda, 0x02, 0x74, 0x53, 0x23, 0x10, 0x88, 0x90, 0x24, 0x53, 0x11, 0xac, 0xdb, 0xb9, 0x80, 0x80,
+	0x9a, 0x84, 0x76, 0x43, 0x32, 0x0a, 0xac, 0xb9, 0x01, 0x44, 0x33, 0x34, 0x23, 0x43, 0x33, 0x21,
+	0x18, 0x8a, 0xbf, 0xdb, 0xdc, 0xbc, 0xab, 0xab, 0x98, 0x81, 0x21, 0x19, 0xcd, 0xbc, 0xa9, 0x82,
+	0x34, 0x33, 0x22, 0x22, 0x21, 0x10, 0x88, 0xaa, 0xbc, 0xdb, 0xdc, 0xab, 0xbc, 0xab, 0xcc, 0xbb,
+	0xba, 0x98, 0x00, 0x11, 0x35, 0x64, 0x54, 0x33, 0x43, 0x42, 0x33, 0x32, 0x21, 0x08, 0x01, 0x13,
+	0x33, 0x1a, 0xde, 0xcc, 0xbc, 0xab, 0xa9, 0x91, 0x24, 0x43, 0x32, 0x00, 0x89, 0x99, 0xa9, 0xa9,
+	0xa0, 0x15, 0x65, 0x44, 0x44, 0x32, 0x10, 0xbe, 0xcc, 0xca, 0x99, 0x80, 0x00, 0x9b, 0xbc, 0xa8,
+	0x02, 0x53, 0x22, 0x10, 0x98, 0x00, 0x23, 0x23, 0x21, 0x09, 0xae, 0xec, 0xcb, 0xba, 0x80, 0x33,
+	0x31, 0x8a, 0xa9, 0x25, 0x52, 0x0a, 0xec, 0xbb, 0xa9, 0x08, 0x8b, 0xca, 0x93, 0x75, 0x33, 0x20,
+	0x9a, 0xb9, 0x81, 0x33, 0x52, 0x32, 0x34, 0x11, 0x8a, 0xcb, 0xb9, 0x89, 0xbe, 0xcb, 0x92, 0x76,
+	0x33, 0x20, 0xbe, 0xbc, 0x98, 0x13, 0x42, 0x31, 0x11, 0x01, 0x21, 0x08, 0x9b, 0xca, 0x81, 0x44,
+	0x43, 0x11, 0x08, 0x80, 0x12, 0x35, 0x22, 0x89, 0xdb, 0xca, 0x99, 0x08, 0x9c, 0xdb, 0xca, 0x90,
+	0x11, 0x89, 0xcd, 0xca, 0x99, 0x88, 0x8b, 0xec, 0xcc, 0xbb, 0xbb, 0xba, 0xa9, 0x23, 0x63, 0x31,
+	0x9a, 0xcb, 0xb9, 0x00, 0x8c, 0xfd, 0xbc, 0xa9, 0x80, 0x21, 0x18, 0x98, 0x82, 0x45, 0x42, 0x10,
+	0x9a, 0xba, 0x90, 0x24, 0x63, 0x43, 0x21, 0x9c, 0xdc, 0xa8, 0x24, 0x63, 0x22, 0x08, 0x98, 0x23,
+	0x63, 0x31, 0x09, 0xa9, 0x15, 0x44, 0x33, 0x18, 0xaa, 0xa9, 0x88, 0x89, 0xcc, 0xbc, 0x98, 0x23,
+	0x63, 0x33, 0x11, 0x99, 0xaa, 0xba, 0xaa, 0xcd, 0xdc, 0xbb, 0x90, 0x13, 0x42, 0x09, 0xbc, 0xb9,
+	0x01, 0x21, 0x9d, 0xdc, 0xba, 0x81, 0x24, 0x28, 0xbf, 0xcc, 0xaa, 0xa8, 0x80, 0x00, 0x01, 0x10,
+	0x8b, 0xdc, 0xaa, 0x25, 0x54, 0x21, 0xac, 0xdb, 0xb8, 0x24, 0x33, 0x09, 0xcc, 0xa9, 0x13, 0x34,
+	0x09, 0xcc, 0xa9, 0x24, 0x53, 0x20, 0x9a, 0xaa, 0x98, 0x18, 0x8a, 0xba, 0x05, 0x64, 0x33, 0x08,
+	0xac, 0xb9, 0x02, 0x44, 0x42, 0x20, 0x00, 0x80, 0x22, 0x54, 0x42, 0x31, 0x10, 0x8a, 0xbd, 0xcc,
+	0xbc, 0xa8, 0x03, 0x43, 0x28, 0xbe, 0xcc, 0xa9, 0x98, 0x89, 0xab, 0xa9, 0x27, 0x54, 0x42, 0x10,
+	0x9a, 0xbb, 0xbb, 0x99, 0x11, 0x43, 0x53, 0x32, 0x09, 0xbe, 0xca, 0xba, 0x99, 0x88, 0x88, 0x13,
+	0x64, 0x34, 0x21, 0x09, 0xa9, 0x80, 0x34, 0x28, 0x9c, 0xb9, 0x27, 0x63, 0x31, 0x9a, 0xdb, 0xa9,
+	0x02, 0x32, 0x19, 0xac, 0xb9, 0x13, 0x63, 0x21, 0x8c, 0xcc, 0xaa, 0x03, 0x63, 0x41, 0x09, 0xbc,
+	0xba, 0x12, 0x53, 0x10, 0xbc, 0xca, 0x80, 0x21, 0x0b, 0xfc, 0xcb, 0x99, 0x12, 0x33, 0x32, 0x10,
+	0x08, 0x12, 0x35, 0x42, 0x32, 0x09, 0xbe, 0xbb, 0xa9, 0x82, 0x22, 0x8b, 0xfd, 0xbb, 0xb8, 0x02,
+	0x33, 0x1a, 0xed, 0xdc, 0xaa, 0x90, 0x35, 0x44, 0x22, 0x18, 0xab, 0xda, 0xa9, 0x81, 0x12, 0x11,
+	0x08, 0x00, 0x01, 0x18, 0x89, 0x92, 0x65, 0x43, 0x20, 0x88, 0x04, 0x75, 0x43, 0x21, 0x89, 0xbb,
+	0xb8, 0x03, 0x32, 0x20, 0x98, 0x00, 0x0a, 0xfc, 0xc9, 0x05, 0x64, 0x33, 0x19, 0xbc, 0xaa, 0x02,
+	0x41, 0x0b, 0xec, 0xaa, 0x81, 0x34, 0x20, 0x9b, 0xbb, 0xb9, 0x80, 0x09, 0x9b, 0xcb, 0xcc, 0xcc,
+	0xcb, 0xba, 0x99, 0x00, 0x08, 0x08, 0x13, 0x43, 0x28, 0xbe, 0xbb, 0x81, 0x54, 0x33, 0x21, 0x08,
+	0x00, 0x22, 0x20, 0x9d, 0xbc, 0x91, 0x46, 0x43, 0x22, 0x18, 0x88, 0x00, 0x21, 0x8a, 0xed, 0xba,
+	0x98, 0x00, 0x11, 0x03, 0x65, 0x54, 0x32, 0x09, 0xac, 0xaa, 0x14, 0x54, 0x33, 0x22, 0x21, 0x00,
+	0x9b, 0xdc, 0xaa, 0x03, 0x74, 0x32, 0x20, 0x89, 0xaa, 0xa9, 0x88, 0x00, 0x13, 0x44, 0x42, 0x10,
+	0x9b, 0xca, 0xbb, 0xab, 0xaa, 0x98, 0x03, 0x28, 0xef, 0xdc, 0xbb, 0x90, 0x37, 0x34, 0x21, 0x8b,
+	0xdc, 0xbc, 0xa9, 0x98, 0x99, 0xbb, 0xda, 0xba, 0xa9, 0x9a, 0xaa, 0x90, 0x26, 0x34, 0x10, 0xbd,
+	0xcb, 0xb9, 0x01, 0x21, 0x09, 0xbb, 0x83, 0x77, 0x52, 0x20, 0x8b, 0xbb, 0xa0, 0x45, 0x53, 0x32,
+	0x21, 0x88, 0xaa, 0xca, 0xb9, 0x81, 0x25, 0x22, 0x08, 0x91, 0x47, 0x54, 0x32, 0x18, 0x9b, 0xaa,
+	0x81, 0x23, 0x20, 0xad, 0xcc, 0x98, 0x25, 0x43, 0x42, 0x21, 0x08, 0x01, 0x32, 0x31, 0x9e, 0xcc,
+	0xaa, 0x01, 0x22, 0x29, 0xbc, 0xc9, 0x13, 0x73, 0x31, 0x0a, 0xbc, 0xba, 0x99, 0xad, 0xdc, 0xca,
+	0xa8, 0x14, 0x33, 0x18, 0xbf, 0xcb, 0xb9, 0x81, 0x13, 0x10, 0xab, 0xcc, 0xaa, 0x99, 0x80, 0x24,
+	0x44, 0x18, 0xbf, 0xda, 0xb8, 0x02, 0x43, 0x20, 0x89, 0x80, 0x36, 0x33, 0x08, 0xbc, 0xb8, 0x13,
+	0x62, 0x21, 0x98, 0x98, 0x12, 0x12, 0x00, 0x37, 0x64, 0x34, 0x18, 0x9b, 0xba, 0x82, 0x43, 0x30,
+	0x9a, 0xca, 0x98, 0x21, 0x20, 0x00, 0x01, 0x21, 0xaf, 0xec, 0xba, 0x80, 0x11, 0x19, 0xcc, 0xcb,
+	0xaa, 0x9a, 0xcc, 0xca, 0xa8, 0x22, 0x42, 0x89, 0xcc, 0xa9, 0x88, 0x9a, 0xdc, 0xb9, 0x16, 0x43,
+	0x30, 0xad, 0xca, 0x92, 0x64, 0x42, 0x20, 0x9a, 0xba, 0x98, 0x12, 0x22, 0x10, 0x88, 0x01, 0x11,
+	0x12, 0x34, 0x54, 0x21, 0x8b, 0xeb, 0xb9, 0x03, 0x43, 0x09, 0xdc, 0xba, 0x91, 0x35, 0x22, 0x18,
+	0xab, 0xdc, 0xbc, 0xca, 0xaa, 0x88, 0x80, 0x80, 0x80, 0x01, 0x08, 0x9b, 0xba, 0x17, 0x64, 0x22,
+	0x8a, 0xcd, 0xa9, 0x14, 0x54, 0x43, 0x22, 0x10, 0x8a, 0xbd, 0xbb, 0xa8, 0x03, 0x33, 0x1b, 0xee,
+	0xbb, 0x91, 0x46, 0x33, 0x30, 0x9b, 0xcc, 0xa9, 0x01, 0x32, 0x28, 0xad, 0xcc, 0xba, 0x98, 0x01,
+	0x24, 0x33, 0x31, 0x9b, 0xdd, 0xaa, 0x81, 0x12, 0x1b, 0xfc, 0xda, 0xb9, 0x01, 0x13, 0x22, 0x00,
+	0x09, 0x08, 0x12, 0x45, 0x44, 0x42, 0x31, 0x21, 0x13, 0x34, 0x20, 0xbf, 0xdb, 0xb9, 0x03, 0x64,
+	0x32, 0x11, 0x89, 0x99, 0x08, 0x08, 0x9b, 0xcb, 0xc9, 0x82, 0x35, 0x32, 0x19, 0xac, 0xcc, 0xca,
+	0xbb, 0xba, 0x98, 0x10, 0x00, 0x98, 0x98, 0x9b, 0xfe, 0xcb, 0xc9, 0x01, 0x23, 0x0b, 0xed, 0xa9,
+	0x03, 0x54, 0x10, 0xbd, 0xbb, 0x91, 0x36, 0x32, 0x18, 0xbb, 0xaa, 0x03, 0x44, 0x21, 0x09, 0x9b,
+	0x98, 0x13, 0x43, 0x18, 0xbf, 0xbb, 0x83, 0x66, 0x34, 0x31, 0x18, 0x88, 0x00, 0x11, 0x18, 0x9c,
+	0xbc, 0xaa, 0x81, 0x24, 0x43, 0x31, 0x18, 0xab, 0x90, 0x46, 0x42, 0x28, 0xac, 0xda, 0x98, 0x12,
+	0x32, 0x10, 0x80, 0x03, 0x23, 0x28, 0x8a, 0x99, 0xad, 0xfe, 0xdc, 0xca, 0xba, 0xa0, 0x01, 0x22,
+	0x32, 0x11, 0x10, 0x00, 0x12, 0x22, 0x31, 0x0b, 0xfe, 0xcc, 0xba, 0x91, 0x37, 0x42, 0x21, 0x9a,
+	0xcb, 0xa9, 0x02, 0x32, 0x8b, 0xfc, 0xcb, 0x99, 0x13, 0x44, 0x32, 0x10, 0x98, 0x98, 0x12, 0x53,
+	0x42, 0x18, 0xac, 0xdb, 0xba, 0x82, 0x35, 0x32, 0x1a, 0xdc, 0xba, 0x91, 0x37, 0x33, 0x31, 0x0a,
+	0xbd, 0xa9, 0x02, 0x43, 0x21, 0x89, 0xa9, 0x14, 0x54, 0x22, 0x08, 0x01, 0x45, 0x54, 0x22, 0x18,
+	0x89, 0x99, 0xaa, 0xaa, 0xb9, 0x90, 0x89, 0xcf, 0xcc, 0xba, 0x82, 0x65, 0x34, 0x21, 0x89, 0xcc,
+	0xba, 0xa8, 0x13, 0x52, 0x31, 0x8a, 0xcc, 0xba, 0x90, 0x14, 0x32, 0x20, 0x9b, 0xbc, 0xa9, 0x98,
+	0x99, 0x99, 0xbb, 0xee, 0xcd, 0xcb, 0xbb, 0x88, 0x24, 0x43, 0x34, 0x23, 0x12, 0x09, 0x9b, 0xaa,
+	0x01, 0x23, 0x19, 0xcb, 0xa0, 0x47, 0x34, 0x32, 0x34, 0x44, 0x32, 0x1a, 0xec, 0xca, 0xa8, 0x24,
+	0x43, 0x32, 0x21, 0x08, 0x88, 0x98, 0x90, 0x12, 0x43, 0x19, 0xcf, 0xca, 0xa9, 0x12, 0x33, 0x0a,
+	0xcd, 0xba, 0x88, 0x09, 0xed, 0xcc, 0xaa, 0x80, 0x01, 0x08, 0x9a, 0x99, 0x80, 0x8a, 0xac, 0xa0,
+	0x36, 0x42, 0x1a, 0xdd, 0xbb, 0x98, 0x11, 0x21, 0x8a, 0xcc, 0xa9, 0x03, 0x54, 0x32, 0x89, 0xdb,
+	0xc9, 0x04, 0x45, 0x32, 0x20, 0x89, 0x80, 0x24, 0x43, 0x18, 0xcc, 0xcb, 0xa8, 0x13, 0x43, 0x30,
+	0xac, 0xcc, 0xba, 0xba, 0xbb, 0xca, 0x90, 0x45, 0x53, 0x32, 0x10, 0x89, 0x99, 0x98, 0x9b, 0xcd,
+	0xcb, 0xcb, 0xaa, 0x80, 0x12, 0x35, 0x34, 0x33, 0x42, 0x10, 0x9c, 0xcc, 0xbb, 0x98, 0x10, 0x18,
+	0xac, 0xcb, 0xa0, 0x37, 0x54, 0x32, 0x18, 0xab, 0xda, 0x90, 0x35, 0x42, 0x0a, 0xcc, 0xbb, 0x81,
+	0x43, 0x20, 0x9c, 0xcb, 0x98, 0x21, 0x18, 0xac, 0xc9, 0x82, 0x53, 0x42, 0x22, 0x35, 0x43, 0x20,
+	0x9c, 0xcb, 0xa8, 0x12, 0x32, 0x0b, 0xeb, 0xb9, 0x82, 0x42, 0x10, 0x99, 0x02, 0x55, 0x32, 0x09,
+	0xcb, 0xb9, 0x12, 0x31, 0xae, 0xcb, 0x90, 0x45, 0x32, 0x19, 0xbb, 0xb9, 0x23, 0x52, 0x89, 0xdc,
+	0xbc, 0xbb, 0xab, 0xb9, 0x90, 0x00, 0x9b, 0xca, 0x17, 0x76, 0x33, 0x31, 0x09, 0xaa, 0x81, 0x43,
+	0x31, 0x0a, 0xca, 0x99, 0x08, 0x9c, 0xcc, 0xa9, 0x02, 0x31, 0x0a, 0xda, 0xa2, 0x56, 0x33, 0x18,
+	0xbe, 0xba, 0x90, 0x12, 0x22, 0x00, 0x88, 0x08, 0x09, 0xbb, 0xb8, 0x36, 0x42, 0x0a, 0xec, 0xbb,
+	0xaa, 0xac, 0xdb, 0xca, 0x81, 0x44, 0x31, 0x09, 0xcb, 0x90, 0x36, 0x43, 0x33, 0x11, 0x23, 0x54,
+	0x43, 0x31, 0x18, 0x90, 0x13, 0x63, 0x41, 0x09, 0xbd, 0xcb, 0xab, 0x9a, 0xaa, 0xbb, 0xa9, 0x80,
+	0x23, 0x44, 0x23, 0x12, 0x33, 0x74, 0x53, 0x43, 0x11, 0x89, 0xa8, 0x01, 0x23, 0x18, 0xdd, 0xcb,
+	0xba, 0x91, 0x35, 0x43, 0x32, 0x20, 0x08, 0x98, 0xa9, 0xa9, 0x88, 0x36, 0x64, 0x43, 0x32, 0x0a,
+	0xcc, 0xb9, 0x14, 0x54, 0x32, 0x0a, 0xbe, 0xcb, 0xca, 0xba, 0x80, 0x14, 0x33, 0x08, 0xcd, 0xbb,
+	0x90, 0x35, 0x31, 0x8a, 0xdc, 0xaa, 0x90, 0x80, 0xab, 0xdb, 0xba, 0x82, 0x34, 0x31, 0x10, 0x01,
+	0x12, 0x1a, 0xff, 0xbd, 0xaa, 0xa8, 0x00, 0x11, 0x22, 0x44, 0x44, 0x34, 0x22, 0x10, 0x88, 0x98,
+	0x00, 0x89, 0xab, 0xba, 0x13, 0x52, 0x8c, 0xeb, 0xb8, 0x46, 0x53, 0x31, 0x08, 0x99, 0x01, 0x42,
+	0x20, 0x9d, 0xbb, 0xa8, 0x22, 0x43, 0x22, 0x33, 0x33, 0x30, 0xad, 0xdb, 0xdb, 0xec, 0xcc, 0xbc,
+	0xaa, 0x88, 0x00, 0x99, 0xcd, 0xbb, 0x99, 0x12, 0x43, 0x21, 0x99, 0xca, 0xa9, 0x98, 0xac, 0xcc,
+	0xb9, 0x15, 0x63, 0x43, 0x20, 0x9a, 0xab, 0xa8, 0x03, 0x42, 0x21, 0x00, 0x00, 0x18, 0x9a, 0xb9,
+	0x15, 0x64, 0x21, 0x8a, 0xa8, 0x57, 0x54, 0x42, 0x11, 0x99, 0xaa, 0xa9, 0x02, 0x12, 0x09, 0xcc,
+	0xcc, 0xab, 0xaa, 0x9a, 0xab, 0xdc, 0xcb, 0xa9, 0x83, 0x53, 0x43, 0x10, 0x89, 0x81, 0x34, 0x43,
+	0x42, 0x34, 0x34, 0x32, 0x18, 0x89, 0x80, 0x13, 0x21, 0x8b, 0xcb, 0xaa, 0xbd, 0xcd, 0xba, 0x83,
+	0x75, 0x33, 0x18, 0xab, 0xda, 0xa8, 0x01, 0x11, 0x10, 0x08, 0x98, 0x80, 0x11, 0x0b, 0xff, 0xdb,
+	0xbb, 0xa9, 0x89, 0xbd, 0xec, 0xbb, 0xc9, 0x80, 0x11, 0x32, 0x24, 0x24, 0x44, 0x32, 0x22, 0x08,
+	0x89, 0x88, 0x80, 0x89, 0xaa, 0x82, 0x75, 0x34, 0x21, 0x0a, 0xa8, 0x04, 0x55, 0x22, 0x0a, 0xbd,
+	0xa9, 0x82, 0x43, 0x41, 0x10, 0x89, 0x80, 0x13, 0x53, 0x21, 0xab, 0xfb, 0xbb, 0x98, 0x81, 0x08,
+	0x9b, 0xdc, 0xcb, 0xba, 0xa9, 0x01, 0x44, 0x32, 0x18, 0xae, 0xcb, 0xdb, 0xaa, 0x98, 0x23, 0x43,
+	0x21, 0xab, 0xda, 0xa8, 0x24, 0x44, 0x22, 0x28, 0x9a, 0xdc, 0xbb, 0xca, 0xb9, 0x98, 0x01, 0x33,
+	0x32, 0x08, 0xb9, 0x85, 0x75, 0x35, 0x21, 0x08, 0xaa, 0xb9, 0x82, 0x54, 0x53, 0x34, 0x31, 0x08,
+	0xac, 0xba, 0x02, 0x54, 0x33, 0x0a, 0xdc, 0xbb, 0xa8, 0x01, 0x21, 0x22, 0x22, 0x21, 0x89, 0xcd,
+	0xbb, 0xab, 0xcc, 0xdd, 0xcb, 0xba, 0xa8, 0x88, 0x9a, 0xca, 0x03, 0x75, 0x43, 0x21, 0x09, 0xab,
+	0xaa, 0x88, 0x08, 0x02, 0x25, 0x53, 0x22, 0x09, 0x9a, 0x80, 0x23, 0x18, 0xdc, 0xb8, 0x25, 0x53,
+	0x1a, 0xed, 0xcb, 0xaa, 0x98, 0x00, 0x22, 0x54, 0x35, 0x20, 0x8a, 0xdb, 0xda, 0x98, 0x81, 0x10,
+	0x08, 0x99, 0xa8, 0x03, 0x64, 0x32, 0x20, 0x9b, 0xbb, 0x98, 0x11, 0x00, 0xbd, 0xbc, 0x90, 0x45,
+	0x54, 0x33, 0x42, 0x34, 0x35, 0x23, 0x32, 0x10, 0x09, 0x99, 0xbd, 0xbd, 0xbb, 0x90, 0x25, 0x53,
+	0x33, 0x10, 0x89, 0x98, 0x80, 0x08, 0x8a, 0xaa, 0x88, 0x8c, 0xee, 0xcb, 0xbb, 0x90, 0x01, 0x8a,
+	0xcc, 0xb9, 0x82, 0x34, 0x28, 0xcd, 0xdb, 0xc9, 0x98, 0x14, 0x44, 0x34, 0x22, 0x10, 0x09, 0xab,
+	0xbe, 0xbd, 0xcb, 0xcb, 0xa9, 0x90, 0x12, 0x43, 0x43, 0x42, 0x42, 0x33, 0x42, 0x21, 0x10, 0x01,
+	0x01, 0x0a, 0xce, 0xcb, 0xa8, 0x03, 0x22, 0x8b, 0xfc, 0xca, 0xa8, 0x88, 0x88, 0xab, 0xeb, 0xca,
+	0xa8, 0x02, 0x42, 0x33, 0x10, 0x88, 0x02, 0x65, 0x43, 0x42, 0x21, 0x89, 0xab, 0xbc, 0x99, 0x98,
+	0x88, 0x99, 0xab, 0xcd, 0xcd, 0xbb, 0xab, 0x99, 0x9a, 0xcd, 0xcb, 0xba, 0x98, 0x00, 0x8b, 0xfc,
+	0xba, 0x90, 0x46, 0x34, 0x22, 0x21, 0x22, 0x33, 0x33, 0x11, 0x11, 0x12, 0x0a, 0xed, 0xdb, 0xab,
+	0x99, 0x00, 0x00, 0x99, 0xbb, 0xb9, 0x16, 0x54, 0x33, 0x22, 0x23, 0x45, 0x34, 0x31, 0x09, 0x90,
+	0x26, 0x53, 0x31, 0x8b, 0xcd, 0xbb, 0xbb, 0xcc, 0xbd, 0xcb, 0xca, 0xa9, 0x80, 0x11, 0x08, 0x88,
+	0x13, 0x64, 0x33, 0x22, 0x21, 0x23, 0x53, 0x43, 0x33, 0x11, 0x8a, 0xcc, 0xbc, 0xbb, 0xcb, 0xcb,
+	0xa8, 0x03, 0x44, 0x43, 0x34, 0x23, 0x22, 0x23, 0x23, 0x44, 0x33, 0x31, 0x89, 0xac, 0xbb, 0xcb,
+	0xdc, 0xbb, 0xbb, 0xaa, 0x9b, 0xcd, 0xcb, 0xdc, 0xbb, 0xaa, 0x91, 0x23, 0x44, 0x23, 0x35, 0x35,
+	0x33, 0x21, 0x89, 0xa9, 0xa8, 0x12, 0x22, 0x19, 0xab, 0xa1, 0x55, 0x42, 0x10, 0x98, 0x15, 0x55,
+	0x43, 0x22, 0x21, 0x10, 0x00, 0x9a, 0xac, 0xbb, 0xbb, 0xcc, 0xbc, 0xbb, 0x9a, 0x99, 0xcd, 0xdc,
+	0xcb, 0xcb, 0xaa, 0x99, 0x90, 0x80, 0x09, 0x9a, 0xa9, 0x04, 0x64, 0x34, 0x11, 0x08, 0x99, 0x9a,
+	0xaa, 0xab, 0xa0, 0x26, 0x44, 0x23, 0x43, 0x45, 0x33, 0x38, 0xad, 0xdb, 0xa8, 0x02, 0x20, 0xaf,
+	0xcc, 0xaa, 0x01, 0x24, 0x31, 0x20, 0x13, 0x44, 0x43, 0x32, 0x22, 0x22, 0x22, 0x11, 0x08, 0xab,
+	0xbb, 0x91, 0x44, 0x29, 0xdf, 0xcc, 0xba, 0xaa, 0xbc, 0xba, 0xb9, 0x91, 0x23, 0x55, 0x35, 0x22,
+	0x19, 0x99, 0x83, 0x66, 0x33, 0x20, 0xab, 0xeb, 0xba, 0x98, 0x88, 0xab, 0xfc, 0xbc, 0xba, 0xa9,
+	0x99, 0x89, 0x88, 0x89, 0x99, 0x05, 0x65, 0x53, 0x33, 0x22, 0x12, 0x33, 0x43, 0x23, 0x11, 0x01,
+	0x01, 0x08, 0x9a, 0xaa, 0x99, 0x9b, 0xfe, 0xcd, 0xbb, 0xab, 0x99, 0x88, 0x9a, 0xab, 0xca, 0xa9,
+	0x01, 0x23, 0x22, 0x08, 0xbc, 0xbd, 0xa9, 0x80, 0x22, 0x18, 0xce, 0xca, 0x81, 0x64, 0x43, 0x32,
+	0x18, 0x9a, 0xcc, 0xbb, 0xb9, 0x80, 0x21, 0x08, 0xaa, 0x07, 0x75, 0x43, 0x41, 0x10, 0x99, 0x99,
+	0x01, 0x33, 0x42, 0x21, 0x88, 0x80, 0x11, 0x00, 0xbf, 0xec, 0xbc, 0xca, 0xbb, 0xdb, 0xcb, 0xbc,
+	0xa9, 0x99, 0x98, 0x99, 0x89, 0x99, 0xab, 0x80, 0x45, 0x42, 0x18, 0xcb, 0xcb, 0x99, 0x00, 0x08,
+	0x80, 0x14, 0x64, 0x34, 0x42, 0x31, 0x18, 0x9a, 0xa9, 0x27, 0x54, 0x42, 0x21, 0x11, 0x13, 0x54,
+	0x34, 0x22, 0x10, 0x08, 0x99, 0x80, 0x23, 0x54, 0x22, 0x10, 0x01, 0x12, 0x23, 0x32, 0x10, 0xad,
+	0xed, 0xcd, 0xcb, 0xbb, 0xba, 0xaa, 0xab, 0xbb, 0xdb, 0xcc, 0xac, 0xab, 0xaa, 0x90, 0x81, 0x80,
+	0x99, 0x90, 0x36, 0x53, 0x33, 0x20, 0x88, 0x80, 0x01, 0x08, 0x9b, 0xdb, 0xba, 0x80, 0x36, 0x55,
+	0x35, 0x44, 0x33, 0x34, 0x22, 0x21, 0x12, 0x36, 0x35, 0x34, 0x22, 0x00, 0x8a, 0xaa, 0xa9, 0x00,
+	0x18, 0xae, 0xec, 0xcb, 0xbb, 0xa9, 0xa9, 0x99, 0x02, 0x37, 0x33, 0x21, 0x0a, 0xac, 0xaa, 0x81,
+	0x22, 0x32, 0x08, 0x80, 0x12, 0x28, 0xef, 0xcc, 0xca, 0xbb, 0xbb, 0xba, 0xa0, 0x13, 0x44, 0x34,
+	0x33, 0x54, 0x43, 0x34, 0x34, 0x34, 0x22, 0x11, 0x11, 0x08, 0x9a, 0xbd, 0xbc, 0xbd, 0xac, 0xab,
+	0xaa, 0xba, 0xab, 0xa9, 0x88, 0x00, 0x8b, 0xcb, 0xc9, 0x80, 0x21, 0x08, 0xaa, 0x90, 0x43, 0x39,
+	0xfe, 0xdc, 0xba, 0x81, 0x25, 0x42, 0x10, 0x9a, 0xca, 0x81, 0x24, 0x31, 0x0a, 0xbc, 0xa8, 0x80,
+	0x18, 0x88, 0x11, 0x20, 0xdf, 0xbc, 0x81, 0x64, 0x43, 0x22, 0x23, 0x45, 0x44, 0x33, 0x21, 0x8a,
+	0xcb, 0xdb, 0xbb, 0xaa, 0x80, 0x24, 0x54, 0x43, 0x34, 0x21, 0x10, 0x88, 0x08, 0x80, 0x09, 0x9a,
+	0xcb, 0xba, 0x82, 0x43, 0x20, 0xad, 0xeb, 0xbc, 0xab, 0xcd, 0xcd, 0xbc, 0xbb, 0xba, 0x9a, 0x98,
+	0x01, 0x35, 0x53, 0x43, 0x33, 0x11, 0x18, 0x08, 0x08, 0x08, 0x09, 0x80, 0x12, 0x44, 0x22, 0x19,
+	0xae, 0xcc, 0xdc, 0xbd, 0xab, 0xa9, 0x80, 0x00, 0x99, 0x90, 0x37, 0x44, 0x42, 0x22, 0x12, 0x12,
+	0x32, 0x11, 0x01, 0x13, 0x43, 0x41, 0x0a, 0xbb, 0xb8, 0x36, 0x53, 0x21, 0x0a, 0xbb, 0xbc, 0xce,
+	0xcc, 0xbb, 0xa8, 0x80, 0x10, 0x12, 0x55, 0x53, 0x33, 0x22, 0x01, 0x11, 0x23, 0x22, 0x10, 0x9d,
+	0xdd, 0xca, 0xb9, 0x99, 0x89, 0x9a, 0xba, 0xba, 0xba, 0x90, 0x44, 0x28, 0xfd, 0xdc, 0xba, 0x90,
+	0x01, 0x11, 0x10, 0x08, 0x89, 0xac, 0xbd, 0xbd, 0xab, 0xa9, 0x00, 0x00, 0xac, 0xeb, 0xca, 0x99,
+	0x80, 0x13, 0x53, 0x52, 0x31, 0x21, 0x22, 0x33, 0x21, 0x89, 0x02, 0x77, 0x53, 0x43, 0x22, 0x20,
+	0x88, 0x88, 0x11, 0x00, 0xbd, 0xcc, 0xaa, 0x99, 0x99, 0x91, 0x13, 0x18, 0xdf, 0xdb, 0xaa, 0x81,
+	0x12, 0x21, 0x11, 0x00, 0xac, 0xec, 0xbb, 0xa9, 0x02, 0x23, 0x22, 0x08, 0xab, 0x90, 0x57, 0x64,
+	0x34, 0x32, 0x20, 0x9a, 0xba, 0xb9, 0x00, 0x08, 0x8a, 0xa0, 0x55, 0x53, 0x32, 0x88, 0xa9, 0x80,
+	0x22, 0x18, 0xcf, 0xcb, 0xcb, 0xca, 0xab, 0x9a, 0x98, 0x00, 0x09, 0xbd, 0xdc, 0xbc, 0xaa, 0xa9,
+	0xa9, 0xbb, 0xba, 0x90, 0x46, 0x44, 0x34, 0x32, 0x32, 0x21, 0x20, 0x08, 0x99, 0x80, 0x25, 0x43,
+	0x42, 0x34, 0x33, 0x43, 0x22, 0x34, 0x64, 0x34, 0x21, 0x08, 0x99, 0x15, 0x44, 0x41, 0x10, 0x80,
+	0x81, 0x00, 0xac, 0xeb, 0xab, 0x99, 0xaa, 0xdc, 0xcb, 0xcb, 0xcb, 0xcb, 0xa9, 0x99, 0x8a, 0xad,
+	0xcb, 0xab, 0x98, 0x80, 0x01, 0x23, 0x55, 0x33, 0x32, 0x09, 0xab, 0xca, 0xa9, 0x80, 0x25, 0x55,
+	0x44, 0x22, 0x08, 0x9a, 0xa0, 0x13, 0x63, 0x34, 0x22, 0x21, 0x10, 0x80, 0x88, 0x00, 0x89, 0x88,
+	0x25, 0x54, 0x42, 0x23, 0x34, 0x33, 0x22, 0x88, 0x99, 0x80, 0x11, 0x88, 0x88, 0x10, 0xaf, 0xfd,
+	0xcb, 0xba, 0x90, 0x08, 0x89, 0x90, 0x37, 0x73, 0x43, 0x21, 0x8a, 0xab, 0xa9, 0x00, 0x11, 0x18,
+	0xbe, 0xed, 0xcb, 0xcb, 0xb9, 0x99, 0x99, 0x9b, 0xaa, 0x81, 0x22, 0x28, 0xde, 0xcc, 0xaa, 0x81,
+	0x13, 0x32, 0x10, 0x88, 0x02, 0x00, 0xbf, 0xca, 0xa9, 0x01, 0x8c, 0xfc, 0xdb, 0xaa, 0x90, 0x22,
+	0x23, 0x22, 0x24, 0x45, 0x44, 0x33, 0x33, 0x11, 0x01, 0x13, 0x35, 0x22, 0x00, 0x90, 0x03, 0x44,
+	0x32, 0x19, 0xbc, 0xda, 0xaa, 0x80, 0x26, 0x54, 0x43, 0x32, 0x22, 0x35, 0x44, 0x42, 0x20, 0x88,
+	0x80, 0x00, 0x9a, 0xdc, 0xba, 0xa8, 0x9a, 0xcd, 0xcb, 0xab, 0x98, 0x80, 0x10, 0x80, 0x98, 0x88,
+	0x12, 0x18, 0xbf, 0xcb, 0xba, 0xbc, 0xdd, 0xbc, 0xaa, 0xa9, 0xab, 0xdc, 0xbc, 0xba, 0xbb, 0xcb,
+	0xca, 0x9a, 0x88, 0x80, 0x01, 0x35, 0x44, 0x34, 0x33, 0x31, 0x08, 0x80, 0x04, 0x34, 0x31, 0x89,
+	0x80, 0x45, 0x63, 0x43, 0x22, 0x22, 0x12, 0x33, 0x44, 0x23, 0x11, 0x88, 0x89, 0x80, 0x14, 0x46,
+	0x43, 0x32, 0x00, 0x90, 0x13, 0x63, 0x32, 0x89, 0x80, 0x47, 0x35, 0x21, 0x80, 0x90, 0x13, 0x43,
+	0x28, 0xbe, 0xcb, 0xaa, 0x98, 0xac, 0xeb, 0xcb, 0xa9, 0x00, 0x00, 0x08, 0x88, 0x00, 0x88, 0x80,
+	0x02, 0x10, 0xcf, 0xdb, 0xbb, 0xbc, 0xdc, 0xcc, 0xaa, 0xa9, 0x8a, 0xaa, 0xca, 0xbb, 0xab, 0xcb,
+	0xcb, 0xbc, 0xa9, 0x80, 0x24, 0x43, 0x42, 0x34, 0x33, 0x43, 0x22, 0x35, 0x44, 0x22, 0x0a, 0xbb,
+	0xca, 0xbb, 0xdc, 0xba, 0x82, 0x43, 0x20, 0x89, 0x13, 0x73, 0x20, 0x98, 0x14, 0x74, 0x33, 0x11,
+	0x02, 0x45, 0x43, 0x32, 0x10, 0x88, 0x01, 0x33, 0x32, 0x19, 0xbc, 0xcc, 0xbb, 0xcb, 0xa9, 0x80,
+	0x12, 0x08, 0xae, 0xcc, 0xba, 0x91, 0x33, 0x39, 0xfe, 0xbc, 0xaa, 0xa9, 0xaa, 0xca, 0x88, 0x00,
+	0x9b, 0xdb, 0xa9, 0x01, 0x8c, 0xdc, 0x98, 0x24, 0x53, 0x21, 0x10, 0x88, 0x08, 0x80, 0x02, 0x64,
+	0x43, 0x33, 0x12, 0x35, 0x44, 0x22, 0x08, 0x88, 0x12, 0x28, 0xde, 0xdb, 0xa9, 0x81, 0x10, 0x08,
+	0x98, 0x00, 0x09, 0x90, 0x26, 0x53, 0x31, 0x09, 0x90, 0x00, 0x9c, 0xed, 0xaa, 0x80, 0x23, 0x19,
+	0xcd, 0xbb, 0xa9, 0x81, 0x00, 0x88, 0x00, 0x00, 0x9a, 0xb0, 0x67, 0x53, 0x32, 0x09, 0xa9, 0x90,
+	0x34, 0x28, 0xee, 0xdb, 0xda, 0x99, 0x81, 0x08, 0x9a, 0xbc, 0xa8, 0x80, 0x10, 0x88, 0x00, 0x08,
+	0x9a, 0xa0, 0x57, 0x53, 0x21, 0x88, 0x91, 0x46, 0x43, 0x22, 0x18, 0x88, 0x12, 0x54, 0x31, 0x19,
+	0xad, 0xbb, 0xb9, 0x91, 0x24, 0x44, 0x43, 0x42, 0x10, 0x09, 0x01, 0x45, 0x43, 0x32, 0x18, 0x88,
+	0x11, 0x18, 0xbf, 0xcb, 0x90, 0x26, 0x34, 0x21, 0x10, 0x08, 0x88, 0x80, 0x02, 0x18, 0xbf, 0xcb,
+	0xcb, 0xac, 0xbc, 0xbb, 0x98, 0x00, 0x8b, 0xec, 0xba, 0xbb, 0xdc, 0xcc, 0xbb, 0xa9, 0x80, 0x08,
+	0x89, 0xcb, 0xeb, 0xaa, 0x90, 0x18, 0x9b, 0xdc, 0xa9, 0x81, 0x10, 0x08, 0x98, 0x80, 0x03, 0x76,
+	0x54, 0x33, 0x21, 0x09, 0x81, 0x25, 0x42, 0x31, 0x12, 0x24, 0x44, 0x22, 0x08, 0x80, 0x03, 0x44,
+	0x33, 0x42, 0x43, 0x33, 0x21, 0x88, 0x90, 0x08, 0x89, 0x98, 0x47, 0x53, 0x32, 0x09, 0xa9, 0x80,
+	0x22, 0x18, 0xce, 0xcc, 0xcc, 0xaa, 0x90, 0x25, 0x43, 0x31, 0x09, 0xad, 0xbb, 0xab, 0xbe, 0xcc,
+	0xbc, 0xa8, 0x01, 0x08, 0xac, 0xba, 0x02, 0x43, 0x19, 0xcc, 0xa0, 0x34, 0x42, 0x09, 0xa9, 0x81,
+	0x11, 0x09, 0x99, 0x00, 0x10, 0x88, 0x01, 0x20, 0xdf, 0xfc, 0xab, 0xba, 0xcb, 0xbc, 0xa9, 0x81,
+	0x11, 0x08, 0xaa, 0x91, 0x37, 0x63, 0x22, 0x19, 0xab, 0xa1, 0x55, 0x42, 0x10, 0x98, 0x13, 0x63,
+	0x21, 0x09, 0x80, 0x54, 0x53, 0x22, 0x10, 0x88, 0x08, 0x88, 0x12, 0x65, 0x43, 0x32, 0x00, 0x98,
+	0x23, 0x63, 0x31, 0x09, 0x88, 0x00, 0x8c, 0xed, 0xba, 0x81, 0x23, 0x29, 0xdd, 0xba, 0x90, 0x10,
+	0xaf, 0xcc, 0xc9, 0xa8, 0x98, 0xaa, 0xba, 0x80, 0x33, 0x19, 0xdc, 0xca, 0x90, 0x00, 0x9b, 0xeb,
+	0xa9, 0x00, 0x00, 0x88, 0x04, 0x64, 0x33, 0x33, 0x43, 0x43, 0x21, 0x09, 0x89, 0x00, 0x08, 0x88,
+	0x15, 0x74, 0x43, 0x41, 0x10, 0x08, 0x88, 0x08, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x99, 0x80,
+	0x13, 0x19, 0xcb, 0xa1, 0x54, 0x18, 0xdc, 0x91, 0x54, 0x28, 0xfd, 0xca, 0xa8, 0x00, 0x8b, 0xeb,
+	0xba, 0x81, 0x11, 0x08, 0x98, 0x80, 0x08, 0x90, 0x15, 0x28, 0xfd, 0xdb, 0xb9, 0x81, 0x10, 0x08,
+	0x90, 0x00, 0x9a, 0xa0, 0x67, 0x44, 0x21, 0x09, 0x98, 0x91, 0x11, 0x08, 0xa9, 0x80, 0x22, 0x19,
+	0xbc, 0x91, 0x44, 0x29, 0xdc, 0xa0, 0x66, 0x43, 0x21, 0x08, 0x90, 0x00, 0x9d, 0xdc, 0xbb, 0x81,
+	0x23, 0x19, 0xcb, 0xa1, 0x65, 0x42, 0x09, 0xbc, 0xb9, 0x81, 0x10, 0x08, 0x98, 0x00, 0x09, 0x98,
+	0x37, 0x73, 0x43, 0x32, 0x43, 0x34, 0x21, 0x88, 0x98, 0x80, 0x01, 0x08, 0x99, 0x80, 0x12, 0x28,
+	0xdf, 0xec, 0xcb, 0xc9, 0x98, 0x00, 0x88, 0x88, 0x13, 0x29, 0xde, 0xca, 0x90, 0x00, 0x9c, 0xcb,
+	0xa9, 0x01, 0x8c, 0xdb, 0xb9, 0x00, 0x0a, 0xec, 0xba, 0x81, 0x21, 0x08, 0xaa, 0x81, 0x22, 0x19,
+	0xbd, 0x90, 0x56, 0x44, 0x33, 0x43, 0x24, 0x33, 0x32, 0x08, 0xbb, 0xa1, 0x56, 0x42, 0x10, 0x88,
+	0x02, 0x54, 0x32, 0x09, 0xaa, 0x90, 0x45, 0x42, 0x21, 0x09, 0x89, 0x00, 0x00, 0x00, 0x99, 0x80,
+	0x12, 0x08, 0xba, 0xa0, 0x64, 0x29, 0xdf, 0xeb, 0xca, 0xbb, 0xbc, 0xbc, 0xaa, 0x81, 0x12, 0x18,
+	0xcb, 0xa1, 0x65, 0x42, 0x09, 0xbc, 0xb9, 0x81, 0x10, 0x08, 0x90, 0x08, 0x89, 0x90, 0x36, 0x28,
+	0xee, 0xca, 0x91, 0x34, 0x41, 0x08, 0xa9, 0x81, 0x11, 0x09, 0x98, 0x80, 0x01, 0x08, 0x90, 0x00,
+	0x88, 0x88, 0x22, 0x18, 0xcb, 0xb1, 0x64, 0x29, 0xdd, 0xa0, 0x66, 0x43, 0x18, 0xbe, 0xba, 0x91,
+	0x34, 0x42, 0x10, 0x08, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0x99, 0x80, 0x12, 0x19,
+	0xab, 0x91, 0x34, 0x29, 0xdc, 0x90, 0x55, 0x28, 0xfd, 0xcc, 0xa9, 0x00, 0x10, 0x08, 0x98, 0x80,
+	0x11, 0x08, 0xa9, 0x80, 0x22, 0x19, 0xbc, 0x91, 0x43, 0x29, 0xeb, 0xa1, 0x55, 0x29, 0xdc, 0xa0,
+	0x66, 0x42, 0x18, 0xcb, 0xc9, 0x80, 0x21, 0x19, 0xaa, 0x80, 0x34, 0x19, 0xcc, 0xa1, 0x64, 0x42,
+	0x1a, 0xbd, 0xa9, 0x00, 0x00, 0x88, 0x13, 0x74, 0x21, 0x08, 0xa9, 0x00, 0x11, 0x09, 0x89, 0x80,
+	0x11, 0x88, 0x89, 0x80, 0x00, 0x09, 0x01, 0x10, 0x9a, 0x90, 0x24, 0x29, 0xcc, 0xb1, 0x65, 0x28,
+	0xee, 0xdb, 0xa9, 0x81, 0x11, 0x88, 0x98, 0x80, 0x10, 0x08, 0x89, 0x80, 0x10, 0x00, 0x99, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x08, 0x90, 0x11, 0x00, 0x9a, 0x80, 0x22, 0x10, 0xbc, 0x90, 0x54, 0x18,
+	0xdd, 0xa1, 0x66, 0x44, 0x21, 0x09, 0x98, 0x80, 0x01, 0x08, 0x98, 0x80, 0x01, 0x08, 0x99, 0x00,
+	0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8a, 0x88, 0x12, 0x29, 0xac, 0x90, 0x44, 0x29,
+	0xdc, 0xa1, 0x55, 0x28, 0xee, 0xca, 0xa9, 0x00, 0x08, 0x90, 0x25, 0x54, 0x21, 0x09, 0x89, 0x00,
+	0x08, 0x80, 0x01, 0x20, 0xdf, 0xcc, 0xa9, 0x80, 0x20, 0x08, 0x98, 0x80, 0x10, 0x08, 0x98, 0x80,
+	0x11, 0x08, 0x99, 0x80, 0x11, 0x08, 0x98, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x88, 0x00, 0x18, 0x99, 0x00, 0x11, 0x18, 0xa9, 0x90, 0x22, 0x29, 0xbc, 0x90, 0x54, 0x18,
+	0xdd, 0xa1, 0x66, 0x44, 0x21, 0x09, 0x98, 0x80, 0x01, 0x08, 0x98, 0x80, 0x01, 0x08, 0x99, 0x80,
+	0x11, 0x08, 0x99, 0x88, 0x01, 0x00, 0x89, 0x88, 0x01, 0x18, 0x9a, 0x80, 0x12, 0x18, 0xab, 0x90,
+	0x43, 0x29, 0xdc, 0xa1, 0x55, 0x29, 0xee, 0xcc, 0xa9, 0x81, 0x10, 0x08, 0x89, 0x80, 0x10, 0x00,
+	0x99, 0x80, 0x12, 0x09, 0x99, 0x91, 0x12, 0x18, 0xab, 0x80, 0x23, 0x18, 0xcb, 0xa1, 0x54, 0x29,
+	0xdd, 0xa0, 0x75, 0x44, 0x21, 0x88, 0x98, 0x80, 0x10, 0x08, 0x98, 0x80, 0x01, 0x08, 0x99, 0x00,
+	0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8a, 0x80, 0x12, 0x10, 0xac, 0x90, 0x44, 0x18,
+	0xdc, 0xa1, 0x55, 0x28, 0xee, 0xca, 0xa9, 0x00, 0x00, 0x88, 0x01, 0x10, 0xbd, 0xa0, 0x66, 0x42,
+	0x09, 0xcb, 0xa0, 0x36, 0x21, 0x9d, 0xca, 0x91, 0x43, 0x31, 0x9c, 0xba, 0x04, 0x32, 0x0b, 0xcb,
+	0x93, 0x53, 0x1a, 0xdb, 0x81, 0x43, 0x19, 0xcc, 0x91, 0x42, 0x29, 0xcb, 0xa1, 0x44, 0x18, 0xbc,
+	0xa8, 0x36, 0x20, 0xac, 0xb9, 0x15, 0x42, 0x19, 0xbd, 0xa9, 0x02, 0x33, 0x1a, 0xbd, 0xa8, 0x25,
+	0x42, 0x19, 0xbd, 0xb9, 0x02, 0x42, 0x19, 0xcb, 0xa0, 0x26, 0x32, 0x19, 0xbc, 0xc9, 0x98, 0x80,
+	0x80,
+};
+
+static const unsigned char* const sndbank_data[7] = { sndbank_click, sndbank_door, sndbank_explosion, sndbank_monster, sndbank_noise, sndbank_plasma, sndbank_shot };
+
+#endif
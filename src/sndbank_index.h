@@ -0,0 +1,20 @@
+/* Generated by tools/mkbank.c, don't edit. */
+
+#ifndef SNDBANK_INDEX_H
+#define SNDBANK_INDEX_H
+
+#define SNDBANK_CLICK 0
+#define SNDBANK_DOOR 1
+#define SNDBANK_EXPLOSION 2
+#define SNDBANK_MONSTER 3
+#define SNDBANK_NOISE 4
+#define SNDBANK_PLASMA 5
+#define SNDBANK_SHOT 6
+
+#define SNDBANK_COUNT 7
+#define SNDBANK_SIZE 43008
+
+static const unsigned long sndbank_offsets[SNDBANK_COUNT] = { 0, 6144, 12288, 18432, 24576, 30720, 36864 };
+static const unsigned long sndbank_sizes[SNDBANK_COUNT] = { 4097, 4097, 4097, 4097, 4097, 4097, 4097 };
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * Gameblabla small PCFX lib Copyright 2024
+ * Licensed under MIT license
+ * See LICENSE file for more
+*/
+
+#include "fastking.h"
+#include "soundbank.h"
+
+static const soundbank_entry_t* bank_manifest;
+static int bank_count = 0;
+static u32 bank_start, bank_end, bank_page;
+
+// KRAM address of each sample (without the page), SOUNDBANK_NOT_RESIDENT if it isn't there
+static u32 bank_addr[SOUNDBANK_MAX];
+
+static u32 Soundbank_Words(int sample)
+{
+	u32 words = (bank_manifest[sample].size + 1) >> 1;
+	return (words + SOUNDBANK_ALIGN - 1) & ~(SOUNDBANK_ALIGN - 1);
+}
+
+/*
+ * First fit : returns the lowest address where the sample fits between the resident
+ * ones, or SOUNDBANK_NOT_RESIDENT.
+*/
+static u32 Soundbank_Find(int sample)
+{
+	int i;
+	u32 addr = bank_start;
+	u32 words = Soundbank_Words(sample);
+	
+	for (;;)
+	{
+		u32 next = addr;
+		
+		// move past any resident sample that overlaps [addr, addr + words)
+		for (i = 0; i < bank_count; i++)
+		{
+			if (bank_addr[i] == SOUNDBANK_NOT_RESIDENT) continue;
+			
+			if (bank_addr[i] < addr + words && addr < bank_addr[i] + Soundbank_Words(i))
+			{
+				if (bank_addr[i] + Soundbank_Words(i) > next)
+					next = bank_addr[i] + Soundbank_Words(i);
+			}
+		}
+		
+		if (next == addr)
+			break;
+		
+		addr = next;
+	}
+	
+	if (addr + words > bank_end)
+		return SOUNDBANK_NOT_RESIDENT;
+	
+	return addr;
+}
+
+/* Returns -1 if the sample couldn't be read from the CD, it isn't resident then. */
+static int Soundbank_Upload(int sample)
+{
+	const soundbank_entry_t* e = &bank_manifest[sample];
+	u32 addr = bank_addr[sample] | bank_page;
+	int result = 0;
+	
+	Present_Lock();
+	if (e->data)
+	{
+		eris_king_set_kram_write(addr, 1);
+		king_kram_write_buffer((void*)e->data, e->size);
+	}
+	else
+	{
+		result = LoadADPCMCD(e->lba, addr, e->size);
+	}
+	Present_Unlock();
+	
+	if (result)
+		bank_addr[sample] = SOUNDBANK_NOT_RESIDENT;
+	
+	return result;
+}
+
+void Soundbank_Init(const soundbank_entry_t manifest[], int count, u32 kram_start, u32 kram_end, u32 kram_page)
+{
+	int i;
+	
+	bank_manifest = manifest;
+	bank_count = count > SOUNDBANK_MAX ? SOUNDBANK_MAX : count;
+	bank_start = kram_start;
+	bank_end = kram_end;
+	bank_page = kram_page;
+	
+	for (i = 0; i < SOUNDBANK_MAX; i++)
+		bank_addr[i] = SOUNDBANK_NOT_RESIDENT;
+}
+
+/*
+ * Makes the samples in the resident mask (bit i = sample i) resident and frees the other ones.
+ * Samples already in KRAM stay where they are, if the new ones don't fit around them everything
+ * is packed again from the start. Returns the number of samples uploaded, -1 if they don't fit.
+ * A sample that couldn't be read from the CD stays not resident and is tried again by the next
+ * call.
+*/
+int Soundbank_Load(u32 resident)
+{
+	int i, uploaded = 0, packed = 0;
+	
+	for (i = 0; i < bank_count; i++)
+	{
+		if (!(resident & (1 << i)))
+			bank_addr[i] = SOUNDBANK_NOT_RESIDENT;
+	}
+	
+	for (i = 0; i < bank_count; i++)
+	{
+		if (!(resident & (1 << i)) || bank_addr[i] != SOUNDBANK_NOT_RESIDENT) continue;
+		
+		bank_addr[i] = Soundbank_Find(i);
+		
+		if (bank_addr[i] == SOUNDBANK_NOT_RESIDENT)
+		{
+			if (packed) return -1;
+			
+			// fragmented, start over with an empty bank
+			packed = 1;
+			uploaded = 0;
+			Soundbank_Init(bank_manifest, bank_count, bank_start, bank_end, bank_page);
+			i = -1;
+			continue;
+		}
+		
+		if (Soundbank_Upload(i) == 0)
+			uploaded++;
+	}
+	
+	return uploaded;
+}
+
+u32 Soundbank_Address(int sample)
+{
+	if (sample < 0 || sample >= bank_count || bank_addr[sample] == SOUNDBANK_NOT_RESIDENT)
+		return SOUNDBANK_NOT_RESIDENT;
+	
+	return bank_addr[sample] | bank_page;
+}
+
+u32 Soundbank_Size(int sample)
+{
+	return bank_manifest[sample].size;
+}
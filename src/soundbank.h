@@ -0,0 +1,30 @@
+#ifndef SOUNDBANK_H
+#define SOUNDBANK_H
+
+#include "pcfx.h"
+
+/*
+ * Sound bank : places the ADPCM samples of a manifest in a KRAM region and keeps
+ * resident only the ones asked for (e.g. the ones a level uses).
+*/
+
+#define SOUNDBANK_MAX 32
+#define SOUNDBANK_ALIGN 256 // Play_ADPCM takes the start address divided by 256
+#define SOUNDBANK_NOT_RESIDENT 0xFFFFFFFF
+
+typedef struct
+{
+	const unsigned char* data; // the sample in RAM, or 0 if it has to be read from the CD
+	u32 lba;                   // where the sample is on the CD if data is 0
+	u32 size;                  // in bytes
+} soundbank_entry_t;
+
+extern void Soundbank_Init(const soundbank_entry_t manifest[], int count, u32 kram_start, u32 kram_end, u32 kram_page);
+
+extern int Soundbank_Load(u32 resident);
+
+extern u32 Soundbank_Address(int sample);
+
+extern u32 Soundbank_Size(int sample);
+
+#endif
@@ -43,7 +43,7 @@
 SFG_PROGRAM_MEMORY uint8_t SFG_musicTrackAverages[SFG_TRACK_COUNT] =
   {14,7,248,148,6,8};
 
-struct
+SFG_THREAD_LOCAL struct
 { // all should be initialized to 0 by default
   uint8_t track;
   uint32_t t;      // time variable/parameter
@@ -0,0 +1,187 @@
+/*
+ * audiotrace : summarizes a dump of the audio trace of the PC-FX port (see src/audiotrace.h).
+ *
+ * Build the game with AUDIO_TRACE defined, play, then dump sizeof(audio_trace_t) bytes at
+ * the address of audio_trace (it's in the .map file) from the emulator's memory and run :
+ *   cc -O2 -o audiotrace tools/audiotrace.c
+ *   ./audiotrace trace.bin
+ *
+ * For every sound it prints how many times it was asked for, how often it was dropped and
+ * why, and the latency percentiles between the request and the start of its channel.
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/audiotrace.h"
+
+#define SOUNDS 256
+#define MAX_LATENCIES 4096
+
+static const char* sound_names[] = { "shot", "door", "explosion", "click", "plasma", "monster" };
+
+typedef struct
+{
+	unsigned requests, drop_frame, drop_missing, drop_busy, merged, replaced, started;
+	unsigned latency[MAX_LATENCIES]; // ms
+	unsigned latency_frames[MAX_LATENCIES];
+	unsigned latencies;
+} sound_stats_t;
+
+static sound_stats_t stats[SOUNDS];
+
+static unsigned le32(const unsigned char* p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned)p[3] << 24);
+}
+
+static int compare(const void* a, const void* b)
+{
+	unsigned x = *(const unsigned*)a, y = *(const unsigned*)b;
+	return x < y ? -1 : x > y;
+}
+
+static unsigned percentile(unsigned* v, unsigned n, unsigned p)
+{
+	return n ? v[((n - 1) * p) / 100] : 0;
+}
+
+static void print_sound(const char* name, sound_stats_t* s)
+{
+	unsigned drops = s->drop_frame + s->drop_missing + s->drop_busy + s->replaced;
+	
+	qsort(s->latency, s->latencies, sizeof(unsigned), compare);
+	qsort(s->latency_frames, s->latencies, sizeof(unsigned), compare);
+	
+	printf("%-10s %6u %5.1f%% %6u %6u %6u %6u %6u   %4u %4u %4u %4u   %3u %3u\n", name,
+		s->requests, s->requests ? drops * 100.0 / s->requests : 0.0,
+		s->drop_frame, s->drop_missing, s->drop_busy, s->replaced, s->merged,
+		percentile(s->latency, s->latencies, 50), percentile(s->latency, s->latencies, 90),
+		percentile(s->latency, s->latencies, 99), s->latencies ? s->latency[s->latencies - 1] : 0,
+		percentile(s->latency_frames, s->latencies, 50), s->latencies ? s->latency_frames[s->latencies - 1] : 0);
+}
+
+int main(int argc, char* argv[])
+{
+	FILE* f;
+	unsigned char header[8];
+	unsigned char raw[AUDIO_TRACE_SIZE][12];
+	unsigned count, first, i, n;
+	unsigned last_request[SOUNDS], last_request_frame[SOUNDS];
+	int voice_sound[256];
+	unsigned voice_request[256], voice_request_frame[256];
+	sound_stats_t total;
+	char name[16];
+	
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage : %s trace.bin\n", argv[0]);
+		return 1;
+	}
+	
+	f = fopen(argv[1], "rb");
+	if (!f || fread(header, 1, 8, f) != 8 || le32(header) != AUDIO_TRACE_MAGIC)
+	{
+		fprintf(stderr, "%s isn't an audio trace dump\n", argv[1]);
+		return 1;
+	}
+	
+	count = le32(header + 4);
+	n = count < AUDIO_TRACE_SIZE ? count : AUDIO_TRACE_SIZE;
+	first = count - n;
+	
+	if (fread(raw, 12, AUDIO_TRACE_SIZE, f) != AUDIO_TRACE_SIZE)
+	{
+		fprintf(stderr, "%s is too short\n", argv[1]);
+		return 1;
+	}
+	fclose(f);
+	
+	memset(last_request, 0, sizeof(last_request));
+	memset(last_request_frame, 0, sizeof(last_request_frame));
+	for (i = 0; i < 256; i++) voice_sound[i] = -1;
+	
+	// oldest event first
+	for (i = first; i < count; i++)
+	{
+		const unsigned char* e = raw[i & (AUDIO_TRACE_SIZE - 1)];
+		unsigned ticks = le32(e), frame = le32(e + 4);
+		unsigned type = e[8], sound = e[9], voice = e[10];
+		sound_stats_t* s = &stats[sound];
+		
+		switch (type)
+		{
+			case AUDIO_EVENT_REQUEST:
+				s->requests++;
+				last_request[sound] = ticks;
+				last_request_frame[sound] = frame;
+			break;
+			case AUDIO_EVENT_DROP_FRAME: s->drop_frame++; break;
+			case AUDIO_EVENT_DROP_MISSING: s->drop_missing++; break;
+			case AUDIO_EVENT_DROP_BUSY: s->drop_busy++; break;
+			case AUDIO_EVENT_MERGED: s->merged++; break;
+			case AUDIO_EVENT_REPLACED:
+				s->replaced++;
+				voice_sound[voice] = -1;
+			break;
+			case AUDIO_EVENT_ACCEPT:
+				voice_sound[voice] = sound;
+				voice_request[voice] = last_request[sound];
+				voice_request_frame[voice] = last_request_frame[sound];
+			break;
+			case AUDIO_EVENT_START:
+				s->started++;
+				if (voice_sound[voice] == (int)sound && s->latencies < MAX_LATENCIES)
+				{
+					s->latency[s->latencies] = ticks - voice_request[voice];
+					s->latency_frames[s->latencies] = frame - voice_request_frame[voice];
+					s->latencies++;
+				}
+				voice_sound[voice] = -1;
+			break;
+			default: break;
+		}
+	}
+	
+	printf("%u events, %u in the dump\n\n", count, n);
+	printf("%-10s %6s %6s %6s %6s %6s %6s %6s   %4s %4s %4s %4s   %3s %3s\n", "sound",
+		"asked", "drop", "frame", "miss", "busy", "lost", "merged", "p50", "p90", "p99", "max", "f50", "fmx");
+	
+	memset(&total, 0, sizeof(total));
+	
+	for (i = 0; i < SOUNDS; i++)
+	{
+		sound_stats_t* s = &stats[i];
+		unsigned j;
+		
+		if (!s->requests && !s->started) continue;
+		
+		if (i < sizeof(sound_names) / sizeof(sound_names[0]))
+			snprintf(name, sizeof(name), "%s", sound_names[i]);
+		else
+			snprintf(name, sizeof(name), "sound %u", i);
+		
+		total.requests += s->requests;
+		total.drop_frame += s->drop_frame;
+		total.drop_missing += s->drop_missing;
+		total.drop_busy += s->drop_busy;
+		total.replaced += s->replaced;
+		total.merged += s->merged;
+		for (j = 0; j < s->latencies && total.latencies < MAX_LATENCIES; j++)
+		{
+			total.latency[total.latencies] = s->latency[j];
+			total.latency_frames[total.latencies] = s->latency_frames[j];
+			total.latencies++;
+		}
+		
+		print_sound(name, s);
+	}
+	
+	print_sound("all", &total);
+	printf("\nlatencies in ms (p50 p90 p99 max) and in frames (f50 fmx)\n");
+	
+	return 0;
+}
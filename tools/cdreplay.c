@@ -0,0 +1,168 @@
+/*
+ * cdreplay : replays a trace of the CD command queue of the PC-FX port (src/cdqueue.c)
+ * on the host, with the timing model of a 2x drive the queue has with CDQ_HOST.
+ *
+ * Play the game, then dump sizeof(cd_queue_trace) bytes at the address of
+ * cd_queue_trace (it's in the .map file) from the emulator's memory. The trace keeps
+ * the last CD_QUEUE_TRACE commands. Every command of the trace is queued again at the
+ * time it was issued with CD_Queue_Read or CD_Queue_Audio, and CD_Queue_Poll is called
+ * every poll interval (the game polls once per main loop iteration). A command that
+ * finds the queue full is queued again at the next poll, like the game does for the
+ * CD-DA ones.
+ *
+ * For every command it prints the latency of the recording (issue to completion) and
+ * of the replay (queueing to completion, which includes waiting behind the other
+ * commands), then the average and highest latencies of reads and CD-DA commands and
+ * the queue statistics. Comparing the recorded latencies with the replayed ones tells
+ * how far the timing model is from the drive. Running a trace with other poll intervals
+ * or CD_QUEUE_BUDGET values tells what they change.
+ *
+ * Build and use :
+ *   cc -O2 -o cdreplay tools/cdreplay.c
+ *   ./cdreplay trace.bin [poll interval in ms]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CDQ_HOST
+
+#include "../src/cdqueue.c"
+
+static unsigned now = 0;
+
+int getTicks()
+{
+	return now;
+}
+
+typedef struct
+{
+	cd_queue_trace_t rec;
+	unsigned queued;        // replay times, ms
+	unsigned completed;
+} command_t;
+
+static command_t commands[CD_QUEUE_TRACE];
+static int count = 0;
+
+static int by_issue_time(const void* a, const void* b)
+{
+	const command_t* x = a;
+	const command_t* y = b;
+
+	return (x->rec.issued > y->rec.issued) - (x->rec.issued < y->rec.issued);
+}
+
+static unsigned sectors(const cd_queue_trace_t* t)
+{
+	return (t->cmd[7] << 8) | t->cmd[8];
+}
+
+int main(int argc, char** argv)
+{
+	cd_queue_trace_t trace[CD_QUEUE_TRACE];
+	unsigned poll_ms = argc > 2 ? atoi(argv[2]) : 16;
+	unsigned done = 0, refused = 0, sum[2] = { 0, 0 }, max[2] = { 0, 0 }, n[2] = { 0, 0 };
+	int next = 0, order[CD_QUEUE_TRACE], queued = 0, i;
+	unsigned char* buf;
+	FILE* f;
+
+	if (argc < 2 || !(f = fopen(argv[1], "rb")))
+	{
+		fprintf(stderr, "usage : %s trace.bin [poll interval in ms]\n", argv[0]);
+		return 1;
+	}
+
+	if (fread(trace, 1, sizeof(trace), f) != sizeof(trace))
+	{
+		fprintf(stderr, "%s is not a dump of cd_queue_trace (%d bytes)\n", argv[1],
+			(int) sizeof(trace));
+		return 1;
+	}
+
+	fclose(f);
+
+	if (poll_ms < 1)
+		poll_ms = 1;
+
+	for (i = 0; i < CD_QUEUE_TRACE; i++)
+		if (trace[i].cmd[0] != 0) // never used entries are all zeroes
+			commands[count++].rec = trace[i];
+
+	if (count == 0)
+	{
+		fprintf(stderr, "the trace is empty\n");
+		return 1;
+	}
+
+	qsort(commands, count, sizeof(command_t), by_issue_time);
+
+	buf = malloc(65536 * CD_QUEUE_SECTOR); // the most a READ(10) can ask for
+	now = commands[0].rec.issued;
+
+	while (done < (unsigned) count)
+	{
+		while (next < count && commands[next].rec.issued <= now)
+		{
+			command_t* c = &commands[next];
+			int result = c->rec.type == CD_QUEUE_READ ?
+				CD_Queue_Read(c->rec.lba, buf, sectors(&c->rec) * CD_QUEUE_SECTOR, 0, 0, 0) :
+				CD_Queue_Audio(c->rec.cmd);
+
+			if (result)
+			{
+				refused++;
+				break; // again at the next poll, keeping the order
+			}
+
+			c->queued = now;
+			order[queued++] = next++;
+		}
+
+		CD_Queue_Poll();
+
+		// the queue is first in first out
+		while (done < cd_queue_stats.completed)
+			commands[order[done++]].completed = now;
+
+		now += poll_ms;
+	}
+
+	printf("  #  type   lba       sectors  recorded ms  replayed ms\n");
+
+	for (i = 0; i < count; i++)
+	{
+		command_t* c = &commands[i];
+		int read = c->rec.type == CD_QUEUE_READ;
+		unsigned latency = c->completed - c->queued;
+
+		if (c->rec.completed)
+			printf("%3d  %-5s  %8u  %7u  %11u  %11u\n", i, read ? "read" : "cdda",
+				c->rec.lba, read ? sectors(&c->rec) : 0, c->rec.completed - c->rec.issued, latency);
+		else
+			printf("%3d  %-5s  %8u  %7u  %11s  %11u\n", i, read ? "read" : "cdda",
+				c->rec.lba, read ? sectors(&c->rec) : 0, "-", latency);
+
+		sum[read] += latency;
+		n[read]++;
+
+		if (latency > max[read])
+			max[read] = latency;
+	}
+
+	for (i = 1; i >= 0; i--)
+		if (n[i])
+			printf("%s : %u, latency %u ms on average, %u ms at most\n", i ? "reads" : "cdda ",
+				n[i], sum[i] / n[i], max[i]);
+
+	printf("polled every %u ms : %u busy polls, the queue was full %u times\n",
+		poll_ms, cd_queue_stats.busy_polls, refused);
+
+	free(buf);
+
+	return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * gridbench : host microbenchmark of the collision grid of the engine (SFG_grid in
+ * src/game.h).
+ *
+ * Fills the first level with synthetic crowds of 64 monsters and shoots 12 projectiles
+ * around them, then times the projectile against monster collision queries done by
+ * walking all the monsters (as the engine used to) and through the grid, moving the
+ * monsters a bit every step. Both have to find the same hits.
+ *
+ * Build and use :
+ *   cc -O2 -o gridbench tools/gridbench.c
+ *   ./gridbench [steps]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_setPixel(x, y, colorIndex) // nothing is drawn
+
+#include "../src/game.h"
+
+#define MONSTERS 64
+#define PROJECTILES 12
+#define CROWDS 4
+
+int8_t SFG_keyPressed(uint8_t key) { return 0; }
+void SFG_getMouseOffset(int16_t* x, int16_t* y) { *x = 0; *y = 0; }
+uint32_t SFG_getTimeMs() { return 0; }
+void SFG_sleepMs(uint16_t timeMs) { }
+void SFG_playSound(uint8_t soundIndex, uint8_t volume) { }
+void SFG_setMusic(uint8_t value) { }
+void SFG_processEvent(uint8_t event, uint8_t data) { }
+void SFG_save(uint8_t data[SFG_SAVE_SIZE]) { }
+uint8_t SFG_load(uint8_t data[SFG_SAVE_SIZE]) { return 0; }
+
+static uint32_t seed = 1;
+
+static uint32_t rnd()
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+static int hits(const SFG_ProjectileRecord* p, const uint8_t* monsters, unsigned count)
+{
+	unsigned i;
+	int found = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		SFG_MonsterRecord* m = &SFG_currentLevel.monsterRecords[monsters[i]];
+
+		if (SFG_projectileCollides((SFG_ProjectileRecord*)p,
+			SFG_MONSTER_COORD_TO_RCL_UNITS(m->coords[0]),
+			SFG_MONSTER_COORD_TO_RCL_UNITS(m->coords[1]),
+			SFG_floorHeightAt(SFG_MONSTER_COORD_TO_SQUARES(m->coords[0]),
+				SFG_MONSTER_COORD_TO_SQUARES(m->coords[1]))))
+			found++;
+	}
+
+	return found;
+}
+
+static void setup(SFG_ProjectileRecord* projectiles)
+{
+	unsigned i;
+	uint8_t crowds[CROWDS][2];
+
+	for (i = 0; i < CROWDS; i++)
+	{
+		crowds[i][0] = 16 + rnd() % 224;
+		crowds[i][1] = 16 + rnd() % 224;
+	}
+
+	SFG_currentLevel.monsterRecordCount = MONSTERS;
+
+	for (i = 0; i < MONSTERS; i++)
+	{
+		SFG_MonsterRecord* m = &SFG_currentLevel.monsterRecords[i];
+
+		m->stateType = SFG_MONSTER_STATE_IDLE;
+		m->health = 100;
+		m->coords[0] = crowds[i % CROWDS][0] + rnd() % 24 - 12;
+		m->coords[1] = crowds[i % CROWDS][1] + rnd() % 24 - 12;
+	}
+
+	SFG_gridInit();
+
+	for (i = 0; i < PROJECTILES; i++)
+	{
+		SFG_ProjectileRecord* p = &projectiles[i];
+		SFG_MonsterRecord* m = &SFG_currentLevel.monsterRecords[rnd() % MONSTERS];
+
+		p->type = SFG_PROJECTILE_PLASMA;
+		p->position[0] = SFG_MONSTER_COORD_TO_RCL_UNITS(m->coords[0]) + rnd() % 4096 - 2048;
+		p->position[1] = SFG_MONSTER_COORD_TO_RCL_UNITS(m->coords[1]) + rnd() % 4096 - 2048;
+		p->position[2] = SFG_floorHeightAt(SFG_MONSTER_COORD_TO_SQUARES(m->coords[0]),
+			SFG_MONSTER_COORD_TO_SQUARES(m->coords[1])) + RCL_UNITS_PER_SQUARE / 2;
+		p->direction[0] = (int)(rnd() % 512) - 256;
+		p->direction[1] = (int)(rnd() % 512) - 256;
+		p->direction[2] = 0;
+	}
+}
+
+static void move_monsters()
+{
+	unsigned i;
+
+	for (i = 0; i < MONSTERS; i++)
+	{
+		SFG_MonsterRecord* m = &SFG_currentLevel.monsterRecords[i];
+
+		m->coords[0] += rnd() % 3 - 1;
+		m->coords[1] += rnd() % 3 - 1;
+		SFG_gridUpdateMonster(i);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	unsigned steps = argc > 1 ? atoi(argv[1]) : 20000, i, j;
+	SFG_ProjectileRecord projectiles[PROJECTILES];
+	uint8_t all[MONSTERS], nearby[SFG_MAX_LEVEL_ELEMENTS];
+	long found_all = 0, found_grid = 0, visited = 0;
+	clock_t t_all = 0, t_grid = 0, start;
+
+	SFG_init();
+	SFG_setAndInitLevel(0);
+
+	for (i = 0; i < MONSTERS; i++)
+		all[i] = i;
+
+	for (i = 0; i < steps; i++)
+	{
+		if (i % 100 == 0)
+			setup(projectiles);
+
+		move_monsters();
+
+		start = clock();
+		for (j = 0; j < PROJECTILES; j++)
+			found_all += hits(&projectiles[j], all, MONSTERS);
+		t_all += clock() - start;
+
+		start = clock();
+		for (j = 0; j < PROJECTILES; j++)
+		{
+			uint8_t count = SFG_gridMonstersNear(projectiles[j].position[0],
+				projectiles[j].position[1], SFG_ELEMENT_COLLISION_RADIUS, nearby);
+
+			visited += count;
+			found_grid += hits(&projectiles[j], nearby, count);
+		}
+		t_grid += clock() - start;
+	}
+
+	printf("%u steps, %d monsters in %d crowds, %d projectiles\n", steps, MONSTERS, CROWDS,
+		PROJECTILES);
+	printf("all monsters : %8.1f ns/step, %ld hits\n",
+		t_all * 1e9 / CLOCKS_PER_SEC / steps, found_all);
+	printf("grid         : %8.1f ns/step, %ld hits, %.1f monsters visited per projectile\n",
+		t_grid * 1e9 / CLOCKS_PER_SEC / steps, found_grid,
+		(double)visited / steps / PROJECTILES);
+
+	return found_all != found_grid;
+}
@@ -0,0 +1,208 @@
+/*
+ * headless : runs levels of the game with random inputs much faster than real
+ * time, for balancing and regression tests (SFG_HEADLESS in src/settings.h).
+ *
+ * Each run starts the level and lets a random player (walking, turning, strafing
+ * and shooting for random stretches of time) play it until it's won, the player
+ * dies or the step limit is reached. The outcome of every run is printed with the
+ * player health and kills, then the simulated steps per second of all runs. Run n
+ * is seeded with seed + n so it always ends the same, whichever thread runs it:
+ * the game state is thread local (SFG_THREAD_LOCAL), each thread plays its own
+ * games.
+ *
+ * Build and use :
+ *   cc -O2 -pthread -o headless tools/headless.c
+ *   ./headless [level] [runs] [max steps] [seed] [threads]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+#define SFG_HEADLESS 1
+#define SFG_THREAD_LOCAL _Thread_local
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_setPixel(x, y, colorIndex) // nothing is drawn
+
+#include "../src/game.h"
+
+static _Thread_local uint16_t keys = 0;
+
+int8_t SFG_keyPressed(uint8_t key) { return (keys >> key) & 1; }
+void SFG_getMouseOffset(int16_t* x, int16_t* y) { *x = 0; *y = 0; }
+uint32_t SFG_getTimeMs() { return 0; }
+void SFG_sleepMs(uint16_t timeMs) { }
+void SFG_playSound(uint8_t soundIndex, uint8_t volume) { }
+void SFG_setMusic(uint8_t value) { }
+void SFG_processEvent(uint8_t event, uint8_t data) { }
+void SFG_save(uint8_t data[SFG_SAVE_SIZE]) { }
+uint8_t SFG_load(uint8_t data[SFG_SAVE_SIZE]) { return 0; }
+
+static _Thread_local uint32_t seed = 1;
+
+static uint32_t rnd()
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+/* Picks what the random player does for the next stretch of steps, mostly walking
+   forward and shooting. */
+static void pick_keys()
+{
+	keys = 0;
+
+	if (rnd() % 4)
+		keys |= 1 << SFG_KEY_UP;
+
+	switch (rnd() % 6)
+	{
+		case 0: keys |= 1 << SFG_KEY_LEFT; break;
+		case 1: keys |= 1 << SFG_KEY_RIGHT; break;
+		case 2: keys |= 1 << SFG_KEY_STRAFE_LEFT; break;
+		case 3: keys |= 1 << SFG_KEY_STRAFE_RIGHT; break;
+		default: break;
+	}
+
+	if (rnd() % 2)
+		keys |= 1 << SFG_KEY_A;
+
+	if (rnd() % 16 == 0)
+		keys |= 1 << SFG_KEY_JUMP;
+
+	if (rnd() % 32 == 0)
+		keys |= 1 << SFG_KEY_NEXT_WEAPON;
+}
+
+typedef struct
+{
+	const char* outcome;
+	unsigned long steps;
+	SFG_RunState state;
+} Result;
+
+static unsigned level, runs, next_run = 0;
+static unsigned long max_steps, base_seed;
+static Result* results;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void play(unsigned run)
+{
+	Result* r = &results[run];
+	unsigned long i, hold = 0;
+
+	seed = base_seed + run;
+	keys = 0;
+
+	SFG_init();
+	SFG_mainLoopBody(); // no keys are held, leaves the init state
+	SFG_setAndInitLevel(level);
+
+	r->outcome = "timeout";
+
+	for (i = 0; i < max_steps; i++)
+	{
+		if (hold-- == 0)
+		{
+			pick_keys();
+			hold = rnd() % 64;
+		}
+
+		SFG_mainLoopBody();
+		SFG_getRunState(&r->state);
+
+		if (r->state.levelWon)
+		{
+			r->outcome = "won";
+			break;
+		}
+
+		if (r->state.health == 0)
+		{
+			r->outcome = "died";
+			break;
+		}
+	}
+
+	r->steps = i < max_steps ? i + 1 : max_steps;
+}
+
+static void* worker(void* unused)
+{
+	for (;;)
+	{
+		unsigned run;
+
+		pthread_mutex_lock(&lock);
+		run = next_run++;
+		pthread_mutex_unlock(&lock);
+
+		if (run >= runs)
+			return NULL;
+
+		play(run);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	unsigned threads, run, won = 0, died = 0;
+	unsigned long total_steps = 0;
+	pthread_t ids[64];
+	struct timespec start, end;
+	double seconds;
+
+	level = argc > 1 ? atoi(argv[1]) : 0;
+	runs = argc > 2 ? atoi(argv[2]) : 10;
+	max_steps = argc > 3 ? atol(argv[3]) : 100000;
+	base_seed = argc > 4 ? atol(argv[4]) : 1;
+	threads = argc > 5 ? atoi(argv[5]) : 1;
+
+	if (level >= SFG_NUMBER_OF_LEVELS)
+	{
+		fprintf(stderr, "there are only %d levels\n", SFG_NUMBER_OF_LEVELS);
+		return 1;
+	}
+
+	if (threads < 1 || threads > 64)
+		threads = 1;
+
+	results = calloc(runs, sizeof(Result));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (run = 0; run < threads; run++)
+		pthread_create(&ids[run], NULL, worker, NULL);
+
+	for (run = 0; run < threads; run++)
+		pthread_join(ids[run], NULL);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+	for (run = 0; run < runs; run++)
+	{
+		Result* r = &results[run];
+
+		won += r->state.levelWon;
+		died += r->state.health == 0;
+		total_steps += r->steps;
+
+		printf("run %3u : level %u %-7s after %6lu steps, health %3u, kills %2u/%u\n",
+			run, r->state.levelNumber, r->outcome, r->steps, r->state.health,
+			r->state.kills, r->state.monsters);
+	}
+
+	printf("%u runs on %u threads, %u won, %u died, %lu steps in %.2f s "
+		"(%.0f steps/s, %.0fx real time)\n", runs, threads, won, died, total_steps,
+		seconds, total_steps / seconds, total_steps / seconds / SFG_FPS);
+
+	free(results);
+
+	return 0;
+}
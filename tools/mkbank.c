@@ -0,0 +1,256 @@
+/*
+ * mkbank : builds the ADPCM sound bank of the PC-FX port.
+ *
+ * Reads 16 bit mono WAV files, encodes them to 4 bit ADPCM (IMA steps, high nibble
+ * first, which is how the samples of the old snd.h decode) and writes them one
+ * after another into a bank file that is put on the CD, along with a header telling
+ * the game where each sample is. Every sample starts on a CD sector, so the sound
+ * bank reads each one from the CD on its own (LoadADPCMCD) when a level needs it.
+ * The same samples are also written as C arrays, for the build without a CD
+ * (FXUPLOADER), which has them in the executable.
+ *
+ * Build and use (the Makefile does this for the CD) :
+ *   cc -O2 -o mkbank tools/mkbank.c
+ *   ./mkbank sndbank.bin src/sndbank_index.h src/sndbank_data.h click.wav door.wav ...
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define SAMPLE_ALIGN 2048  // a CD sector
+#define MAX_SAMPLES 32
+
+static const int step_table[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+	11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767
+};
+
+static const int index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static unsigned int le16(const unsigned char* p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static unsigned long le32(const unsigned char* p)
+{
+	return p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+}
+
+/* Returns the samples of a 16 bit mono WAV file, count is set to their number. */
+static short* load_wav(const char* path, unsigned long* count)
+{
+	FILE* f = fopen(path, "rb");
+	unsigned char* buf;
+	long size;
+	unsigned long pos = 12;
+	short* samples;
+	unsigned long i;
+	
+	if (!f) return NULL;
+	
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	buf = malloc(size);
+	if (fread(buf, 1, size, f) != (size_t)size || size < 12 || memcmp(buf, "RIFF", 4) || memcmp(buf + 8, "WAVE", 4))
+	{
+		fclose(f);
+		free(buf);
+		return NULL;
+	}
+	fclose(f);
+	
+	while (pos + 8 <= (unsigned long)size)
+	{
+		unsigned long chunk = le32(buf + pos + 4);
+		
+		if (!memcmp(buf + pos, "fmt ", 4))
+		{
+			if (le16(buf + pos + 8) != 1 || le16(buf + pos + 10) != 1 || le16(buf + pos + 22) != 16)
+			{
+				fprintf(stderr, "%s : only 16 bit mono PCM is supported\n", path);
+				free(buf);
+				return NULL;
+			}
+		}
+		else if (!memcmp(buf + pos, "data", 4))
+		{
+			if (pos + 8 + chunk > (unsigned long)size)
+				chunk = size - pos - 8;
+			
+			*count = chunk / 2;
+			samples = malloc(*count * sizeof(short) + 1);
+			for (i = 0; i < *count; i++)
+				samples[i] = (short)le16(buf + pos + 8 + i * 2);
+			free(buf);
+			return samples;
+		}
+		
+		pos += 8 + chunk + (chunk & 1);
+	}
+	
+	free(buf);
+	return NULL;
+}
+
+/* Encodes count samples to (count + 1) / 2 bytes. */
+static void encode(const short* samples, unsigned long count, unsigned char* out)
+{
+	int prev = 0, index = 0;
+	unsigned long i;
+	
+	memset(out, 0, (count + 1) / 2);
+	
+	for (i = 0; i < count; i++)
+	{
+		int step = step_table[index];
+		int delta = samples[i] - prev;
+		int nibble = abs(delta) * 4 / step;
+		int diff;
+		
+		if (nibble > 7) nibble = 7;
+		
+		diff = (step * (2 * nibble + 1)) / 8;
+		
+		if (delta < 0)
+		{
+			nibble |= 8;
+			diff = -diff;
+		}
+		
+		prev += diff;
+		if (prev > 32767) prev = 32767;
+		if (prev < -32768) prev = -32768;
+		
+		index += index_table[nibble & 7];
+		if (index < 0) index = 0;
+		if (index > 88) index = 88;
+		
+		out[i / 2] |= (i & 1) ? nibble : (nibble << 4);
+	}
+}
+
+/* click.wav -> CLICK, or click if lower */
+static void sample_name(const char* path, char* name, int lower)
+{
+	const char* base = strrchr(path, '/');
+	int i = 0;
+	
+	base = base ? base + 1 : path;
+	
+	while (base[i] && base[i] != '.' && i < 31)
+	{
+		name[i] = !isalnum((unsigned char)base[i]) ? '_' :
+			lower ? tolower((unsigned char)base[i]) : toupper((unsigned char)base[i]);
+		i++;
+	}
+	name[i] = 0;
+}
+
+int main(int argc, char* argv[])
+{
+	FILE *bank, *header, *data;
+	unsigned long offsets[MAX_SAMPLES], sizes[MAX_SAMPLES];
+	char name[32];
+	unsigned long pos = 0, j;
+	int i, count = argc - 4;
+	
+	if (argc < 5 || count > MAX_SAMPLES)
+	{
+		fprintf(stderr, "usage : %s bank.bin index.h data.h sample.wav ... (up to %d samples)\n", argv[0], MAX_SAMPLES);
+		return 1;
+	}
+	
+	bank = fopen(argv[1], "wb");
+	header = fopen(argv[2], "w");
+	data = fopen(argv[3], "w");
+	
+	if (!bank || !header || !data)
+	{
+		fprintf(stderr, "can't open the output files\n");
+		return 1;
+	}
+	
+	fprintf(data, "/* Generated by tools/mkbank.c, don't edit. The sound bank of the build without a CD. */\n\n");
+	fprintf(data, "#ifndef SNDBANK_DATA_H\n#define SNDBANK_DATA_H\n\n");
+	
+	for (i = 0; i < count; i++)
+	{
+		unsigned long n, padded;
+		short* samples = load_wav(argv[4 + i], &n);
+		unsigned char* adpcm;
+		
+		if (!samples)
+		{
+			fprintf(stderr, "can't read %s\n", argv[4 + i]);
+			return 1;
+		}
+		
+		sizes[i] = (n + 1) / 2;
+		padded = (sizes[i] + SAMPLE_ALIGN - 1) & ~(unsigned long)(SAMPLE_ALIGN - 1);
+		
+		adpcm = calloc(padded, 1);
+		encode(samples, n, adpcm);
+		fwrite(adpcm, 1, padded, bank);
+		
+		sample_name(argv[4 + i], name, 1);
+		fprintf(data, "static const unsigned char sndbank_%s[%lu] = {", name, sizes[i]);
+		for (j = 0; j < sizes[i]; j++)
+			fprintf(data, "%s0x%02x,", (j % 16) ? " " : "\n\t", adpcm[j]);
+		fprintf(data, "\n};\n\n");
+		
+		offsets[i] = pos;
+		pos += padded;
+		
+		free(adpcm);
+		free(samples);
+	}
+	
+	fclose(bank);
+	
+	fprintf(data, "static const unsigned char* const sndbank_data[%d] = {", count);
+	for (i = 0; i < count; i++)
+	{
+		sample_name(argv[4 + i], name, 1);
+		fprintf(data, "%ssndbank_%s", i ? ", " : " ", name);
+	}
+	fprintf(data, " };\n\n#endif\n");
+	
+	fclose(data);
+	
+	fprintf(header, "/* Generated by tools/mkbank.c, don't edit. */\n\n");
+	fprintf(header, "#ifndef SNDBANK_INDEX_H\n#define SNDBANK_INDEX_H\n\n");
+	
+	for (i = 0; i < count; i++)
+	{
+		sample_name(argv[4 + i], name, 0);
+		fprintf(header, "#define SNDBANK_%s %d\n", name, i);
+	}
+	
+	fprintf(header, "\n#define SNDBANK_COUNT %d\n", count);
+	fprintf(header, "#define SNDBANK_SIZE %lu\n\n", pos);
+	
+	fprintf(header, "static const unsigned long sndbank_offsets[SNDBANK_COUNT] = {");
+	for (i = 0; i < count; i++)
+		fprintf(header, "%s%lu", i ? ", " : " ", offsets[i]);
+	fprintf(header, " };\n");
+	
+	fprintf(header, "static const unsigned long sndbank_sizes[SNDBANK_COUNT] = {");
+	for (i = 0; i < count; i++)
+		fprintf(header, "%s%lu", i ? ", " : " ", sizes[i]);
+	fprintf(header, " };\n\n#endif\n");
+	
+	fclose(header);
+	
+	return 0;
+}
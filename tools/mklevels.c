@@ -0,0 +1,246 @@
+/*
+ * mklevels : builds the level pack of the PC-FX port.
+ *
+ * Packs every level of src/levels.h with the LZ/RLE format of src/lz.h into a file that
+ * is put on the CD, each level starting on its own sector, and writes a header telling
+ * the game where each level is (see SFG_loadLevel in src/main.c).
+ *
+ * Build and use (the Makefile does this for the CD) :
+ *   cc -O2 -o mklevels tools/mklevels.c
+ *   ./mklevels levels.bin src/levelpack_index.h
+ *
+ * ./mklevels -b packs the levels and all the images of src/images.h and prints the
+ * compression ratio and the decoding speed (of this machine) for each of them.
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_LEVEL_PACK 0
+
+#include "../src/levels.h"
+#include "../src/images.h"
+#include "../src/lz.c"
+
+#define SECTOR 2048
+
+// the PC-FX unpacks the file straight into an SFG_Level, the layout has to be the same
+typedef char level_size_check[sizeof(SFG_Level) == 4622 ? 1 : -1];
+
+/* Greedy packer, out has to hold size + size / 128 + 1 bytes. Returns the packed size. */
+static unsigned lz_pack(const uint8_t* in, unsigned size, uint8_t* out)
+{
+	unsigned pos = 0, o = 0, literals = 0, lit_start = 0;
+	
+	while (pos <= size)
+	{
+		unsigned run = 0, best = 0, dist = 0, i;
+		int token = 0;
+		
+		if (pos < size)
+		{
+			while (pos + run < size && run < LZ_MAX_MATCH && in[pos + run] == in[pos])
+				run++;
+			
+			for (i = pos > LZ_MAX_DISTANCE ? pos - LZ_MAX_DISTANCE : 0; i < pos; i++)
+			{
+				unsigned len = 0;
+				
+				while (pos + len < size && len < LZ_MAX_MATCH && in[i + len] == in[pos + len])
+					len++;
+				
+				if (len > best)
+				{
+					best = len;
+					dist = pos - i;
+				}
+			}
+			
+			// a run costs 2 bytes, a match 3
+			if (run >= LZ_MIN_MATCH && run + 1 >= best)
+				token = 1;
+			else if (best >= LZ_MIN_MATCH + 1 || (best == LZ_MIN_MATCH && literals == 0))
+				token = 2;
+		}
+		
+		if (token || pos == size || literals == LZ_MAX_LITERALS)
+		{
+			if (literals)
+			{
+				out[o++] = literals - 1;
+				memcpy(out + o, in + lit_start, literals);
+				o += literals;
+				literals = 0;
+			}
+		}
+		
+		if (pos == size)
+			break;
+		
+		if (token == 1)
+		{
+			out[o++] = 0x80 + run - LZ_MIN_MATCH;
+			out[o++] = in[pos];
+			pos += run;
+		}
+		else if (token == 2)
+		{
+			out[o++] = 0xC0 + best - LZ_MIN_MATCH;
+			out[o++] = dist & 0xFF;
+			out[o++] = dist >> 8;
+			pos += best;
+		}
+		else
+		{
+			if (!literals) lit_start = pos;
+			literals++;
+			pos++;
+		}
+	}
+	
+	return o;
+}
+
+static unsigned pack_checked(const uint8_t* in, unsigned size, uint8_t* out)
+{
+	unsigned packed = lz_pack(in, size, out);
+	uint8_t* check = malloc(size);
+	
+	LZ_Decode(out, check, size);
+	if (memcmp(check, in, size))
+	{
+		fprintf(stderr, "the packed data doesn't unpack right\n");
+		exit(1);
+	}
+	
+	free(check);
+	return packed;
+}
+
+static void bench(const char* name, const uint8_t* in, unsigned size)
+{
+	uint8_t* packed = malloc(size + size / 128 + 1);
+	uint8_t* out = malloc(size);
+	unsigned n = pack_checked(in, size, packed);
+	unsigned runs = 0;
+	clock_t start = clock(), t;
+	
+	do
+	{
+		LZ_Decode(packed, out, size);
+		runs++;
+		t = clock() - start;
+	} while (t < CLOCKS_PER_SEC / 10);
+	
+	printf("%-20s %6u -> %6u  %5.1f%%  %8.1f MB/s\n", name, size, n, n * 100.0 / size,
+		(double)size * runs / ((double)t / CLOCKS_PER_SEC) / (1024 * 1024));
+	
+	free(packed);
+	free(out);
+}
+
+static void bench_images(const char* name, const uint8_t* images, unsigned count)
+{
+	char label[32];
+	unsigned i;
+	
+	for (i = 0; i < count; i++)
+	{
+		snprintf(label, sizeof(label), "%s %u", name, i);
+		bench(label, images + i * SFG_TEXTURE_STORE_SIZE, SFG_TEXTURE_STORE_SIZE);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	FILE *pack, *header;
+	static uint8_t packed[SFG_NUMBER_OF_LEVELS][sizeof(SFG_Level) * 2];
+	unsigned sizes[SFG_NUMBER_OF_LEVELS], sectors[SFG_NUMBER_OF_LEVELS];
+	unsigned i, j, sector = 0, max_sectors = 0;
+	
+	if (argc == 2 && !strcmp(argv[1], "-b"))
+	{
+		char label[32];
+		
+		printf("%-20s %6s    %6s  %6s  %8s\n", "asset", "size", "packed", "ratio", "decoding");
+		
+		for (i = 0; i < SFG_NUMBER_OF_LEVELS; i++)
+		{
+			snprintf(label, sizeof(label), "level %u", i);
+			bench(label, (const uint8_t*)SFG_levels[i], sizeof(SFG_Level));
+		}
+		
+		bench_images("wall texture", SFG_wallTextures, SFG_WALL_TEXTURE_COUNT);
+		bench_images("item sprite", SFG_itemSprites, 13);
+		bench_images("background", SFG_backgroundImages, 3);
+		bench_images("weapon", SFG_weaponImages, 6);
+		bench_images("effect", SFG_effectSprites, 4);
+		bench_images("monster", SFG_monsterSprites, 19);
+		bench_images("logo", SFG_logoImage, 1);
+		
+		return 0;
+	}
+	
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage : %s levels.bin index.h\n       %s -b\n", argv[0], argv[0]);
+		return 1;
+	}
+	
+	pack = fopen(argv[1], "wb");
+	header = fopen(argv[2], "w");
+	
+	if (!pack || !header)
+	{
+		fprintf(stderr, "can't open the output files\n");
+		return 1;
+	}
+	
+	for (i = 0; i < SFG_NUMBER_OF_LEVELS; i++)
+	{
+		sizes[i] = pack_checked((const uint8_t*)SFG_levels[i], sizeof(SFG_Level), packed[i]);
+		sectors[i] = (sizes[i] + SECTOR - 1) / SECTOR;
+		
+		if (sectors[i] > max_sectors)
+			max_sectors = sectors[i];
+		
+		fwrite(packed[i], 1, sizes[i], pack);
+		
+		for (j = sizes[i]; j < sectors[i] * SECTOR; j++)
+			fputc(0, pack);
+	}
+	
+	fclose(pack);
+	
+	fprintf(header, "/* Generated by tools/mklevels.c, don't edit. */\n\n");
+	fprintf(header, "#ifndef LEVELPACK_INDEX_H\n#define LEVELPACK_INDEX_H\n\n");
+	fprintf(header, "#define LEVELPACK_LEVEL_SIZE %u\n", (unsigned)sizeof(SFG_Level));
+	fprintf(header, "#define LEVELPACK_MAX_SECTORS %u\n\n", max_sectors);
+	
+	// sector of each level from the start of the pack and its packed size
+	fprintf(header, "static const unsigned char levelpack_sectors[%d] = {", SFG_NUMBER_OF_LEVELS);
+	for (i = 0; i < SFG_NUMBER_OF_LEVELS; i++)
+	{
+		fprintf(header, "%s%u", i ? ", " : " ", sector);
+		sector += sectors[i];
+	}
+	fprintf(header, " };\n");
+	
+	fprintf(header, "static const unsigned short levelpack_sizes[%d] = {", SFG_NUMBER_OF_LEVELS);
+	for (i = 0; i < SFG_NUMBER_OF_LEVELS; i++)
+		fprintf(header, "%s%u", i ? ", " : " ", sizes[i]);
+	fprintf(header, " };\n\n");
+	
+	fprintf(header, "#define LEVELPACK_SIZE %u\n\n#endif\n", sector * SECTOR);
+	
+	fclose(header);
+	
+	return 0;
+}
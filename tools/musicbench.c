@@ -0,0 +1,108 @@
+/*
+ * musicbench : host benchmark of the bytebeat music stream of the PC-FX port
+ * (MUSIC_BYTEBEAT in src/main.c).
+ *
+ * Makes the music the way Music_Batch does : MUSIC_BATCH samples at a time from
+ * SFG_getNextMusicSample, repeated to the 32 kHz ADPCM rate and encoded with
+ * ADPCM_Encode (src/adpcm.c). Goes through all the tracks (or the given number of
+ * samples) and prints the samples generated per millisecond for generating alone,
+ * encoding alone and both, next to the 8 samples per millisecond the music plays
+ * at. The numbers are of this machine, the V810 is a lot slower, but they compare
+ * changes of the generator or the encoder. The checksum of the encoded stream has
+ * to stay the same unless the music or the encoding is meant to change.
+ *
+ * Build and use :
+ *   cc -O2 -o musicbench tools/musicbench.c
+ *   ./musicbench [samples]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_THREAD_LOCAL
+
+#include "../src/sounds.h"
+#include "../src/adpcm.c"
+
+// as in src/main.c
+#define MUSIC_BATCH 256
+#define MUSIC_BATCH_BYTES (MUSIC_BATCH * 4 / 2)
+#define MUSIC_VOLUME 64
+
+static double now()
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+
+	return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* Makes one batch of 32 kHz samples, like the first part of Music_Batch. */
+static void generate(short pcm[MUSIC_BATCH * 4])
+{
+	int i;
+
+	for (i = 0; i < MUSIC_BATCH; i++)
+	{
+		int16_t sample = SFG_getNextMusicSample();
+
+		sample = (sample - SFG_musicTrackAverages[SFG_MusicState.track]) * MUSIC_VOLUME;
+
+		pcm[i * 4] = sample;
+		pcm[i * 4 + 1] = sample;
+		pcm[i * 4 + 2] = sample;
+		pcm[i * 4 + 3] = sample;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	unsigned long samples = argc > 1 ? atol(argv[1]) : (unsigned long) SFG_TRACK_SAMPLES * SFG_TRACK_COUNT;
+	unsigned long batches = samples / MUSIC_BATCH, b;
+	short pcm[MUSIC_BATCH * 4];
+	unsigned char adpcm[MUSIC_BATCH_BYTES];
+	adpcm_state_t state = { 0, 0 };
+	double t_generate = 0, t_encode = 0, start;
+	uint32_t sum = 0;
+	int i;
+
+	if (batches == 0)
+	{
+		fprintf(stderr, "give at least %d samples\n", MUSIC_BATCH);
+		return 1;
+	}
+
+	for (b = 0; b < batches; b++)
+	{
+		start = now();
+		generate(pcm);
+		t_generate += now() - start;
+
+		start = now();
+		ADPCM_Encode(&state, pcm, MUSIC_BATCH * 4, adpcm);
+		t_encode += now() - start;
+
+		for (i = 0; i < MUSIC_BATCH_BYTES; i++)
+			sum = sum * 31 + adpcm[i];
+	}
+
+	samples = batches * MUSIC_BATCH;
+
+	printf("%lu bytebeat samples in %lu batches of %d, checksum %08x\n", samples,
+		batches, MUSIC_BATCH, sum);
+	printf("generate %10.0f samples/ms\n", samples / (t_generate * 1000));
+	printf("encode   %10.0f samples/ms (4 ADPCM samples each)\n",
+		samples / (t_encode * 1000));
+	printf("both     %10.0f samples/ms, %.1f us per batch\n",
+		samples / ((t_generate + t_encode) * 1000), (t_generate + t_encode) * 1e6 / batches);
+	printf("needed   %10d samples/ms (8 kHz)\n", 8);
+
+	return 0;
+}
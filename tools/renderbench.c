@@ -0,0 +1,219 @@
+/*
+ * renderbench : host benchmark of the 3D view drawn in parallel column ranges
+ * (SFG_RENDER_THREADS in src/settings.h) at 640x480.
+ *
+ * Draws the view turning around in given level, first with one thread and then
+ * with more, up to given count, and prints the time per frame. The view is always
+ * split into 8 column ranges, which the threads take in turns. The checksum of the
+ * drawn frames has to be the same for all thread counts, and the same as with the
+ * serial renderer (build with -DSFG_RENDER_THREADS=1).
+ *
+ * Build and use :
+ *   cc -O2 -pthread -o renderbench tools/renderbench.c
+ *   ./renderbench [level] [frames] [max threads]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define SFG_SCREEN_RESOLUTION_X 640
+#define SFG_SCREEN_RESOLUTION_Y 480
+
+#ifndef SFG_RENDER_THREADS
+	#define SFG_RENDER_THREADS 8
+#endif
+
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_setPixel(x, y, colorIndex) framebuffer[(y) * SFG_SCREEN_RESOLUTION_X + (x)] = (colorIndex)
+
+static uint8_t framebuffer[SFG_SCREEN_RESOLUTION_X * SFG_SCREEN_RESOLUTION_Y];
+
+#include "../src/game.h"
+
+int8_t SFG_keyPressed(uint8_t key) { return 0; }
+void SFG_getMouseOffset(int16_t* x, int16_t* y) { *x = 0; *y = 0; }
+uint32_t SFG_getTimeMs() { return 0; }
+void SFG_sleepMs(uint16_t timeMs) { }
+void SFG_playSound(uint8_t soundIndex, uint8_t volume) { }
+void SFG_setMusic(uint8_t value) { }
+void SFG_processEvent(uint8_t event, uint8_t data) { }
+void SFG_save(uint8_t data[SFG_SAVE_SIZE]) { }
+uint8_t SFG_load(uint8_t data[SFG_SAVE_SIZE]) { return 0; }
+
+#if SFG_RENDER_THREADS > 1
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static void (*job)(uint8_t part);
+static unsigned next_part, parts_done, generation, quit;
+
+/* Takes column ranges of the current frame until there are none left, on the main
+   thread as well as on the workers. */
+static void draw_parts()
+{
+	for (;;)
+	{
+		unsigned part;
+
+		pthread_mutex_lock(&lock);
+		part = next_part++;
+		pthread_mutex_unlock(&lock);
+
+		if (part >= SFG_RENDER_THREADS)
+			return;
+
+		job(part);
+
+		pthread_mutex_lock(&lock);
+
+		if (++parts_done == SFG_RENDER_THREADS)
+			pthread_cond_signal(&done_cond);
+
+		pthread_mutex_unlock(&lock);
+	}
+}
+
+static void* worker(void* unused)
+{
+	unsigned seen = 0;
+
+	pthread_mutex_lock(&lock);
+
+	for (;;)
+	{
+		while (generation == seen && !quit)
+			pthread_cond_wait(&start_cond, &lock);
+
+		if (quit)
+			break;
+
+		seen = generation;
+		pthread_mutex_unlock(&lock);
+		draw_parts();
+		pthread_mutex_lock(&lock);
+	}
+
+	pthread_mutex_unlock(&lock);
+
+	return NULL;
+}
+
+void SFG_drawInParallel(void (*drawPart)(uint8_t part))
+{
+	pthread_mutex_lock(&lock);
+	job = drawPart;
+	next_part = 0;
+	parts_done = 0;
+	generation++;
+	pthread_cond_broadcast(&start_cond);
+	pthread_mutex_unlock(&lock);
+
+	draw_parts();
+
+	pthread_mutex_lock(&lock);
+
+	while (parts_done < SFG_RENDER_THREADS)
+		pthread_cond_wait(&done_cond, &lock);
+
+	pthread_mutex_unlock(&lock);
+}
+#endif
+
+static double now()
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+
+	return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* Draws the given number of frames turning around, returns the checksum. */
+static uint32_t draw_frames(unsigned frames)
+{
+	unsigned i, j;
+	uint32_t sum = 0;
+
+	for (i = 0; i < frames; i++)
+	{
+		SFG_player.camera.direction = (i * RCL_UNITS_PER_SQUARE) / frames;
+		SFG_draw();
+
+		for (j = 0; j < sizeof(framebuffer); j++)
+			sum = sum * 31 + framebuffer[j];
+	}
+
+	return sum;
+}
+
+int main(int argc, char** argv)
+{
+	unsigned level = argc > 1 ? atoi(argv[1]) : 0;
+	unsigned frames = argc > 2 ? atoi(argv[2]) : 200;
+	unsigned max_threads = argc > 3 ? atoi(argv[3]) : sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned threads = 1;
+	double one = 0;
+
+	if (level >= SFG_NUMBER_OF_LEVELS)
+	{
+		fprintf(stderr, "there are only %d levels\n", SFG_NUMBER_OF_LEVELS);
+		return 1;
+	}
+
+	if (max_threads < 1 || SFG_RENDER_THREADS == 1)
+		max_threads = 1;
+
+	if (max_threads > SFG_RENDER_THREADS)
+		max_threads = SFG_RENDER_THREADS;
+
+	SFG_init();
+	SFG_setAndInitLevel(level);
+	SFG_game.state = SFG_GAME_STATE_PLAYING;
+
+	draw_frames(10); // warm up
+
+	printf("%dx%d, %d column ranges, %u frames\n", SFG_GAME_RESOLUTION_X,
+		SFG_GAME_RESOLUTION_Y, SFG_RENDER_THREADS, frames);
+
+	for (;;)
+	{
+		double start = now(), ms;
+		uint32_t sum = draw_frames(frames);
+
+		ms = (now() - start) * 1000 / frames;
+
+		if (threads == 1)
+			one = ms;
+
+		printf("%2u threads : %7.2f ms/frame, %6.1f fps, %.2fx, checksum %08x\n",
+			threads, ms, 1000 / ms, one / ms, sum);
+
+		if (threads == max_threads)
+			break;
+
+#if SFG_RENDER_THREADS > 1
+		pthread_t id;
+
+		pthread_create(&id, NULL, worker, NULL); // one more
+		pthread_detach(id);
+#endif
+
+		threads++;
+	}
+
+#if SFG_RENDER_THREADS > 1
+	pthread_mutex_lock(&lock);
+	quit = 1;
+	pthread_cond_broadcast(&start_cond);
+	pthread_mutex_unlock(&lock);
+#endif
+
+	return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * replay : records the keys of a run of the game into a file and plays such
+ * files back (SFG_INPUT_RECORDS in src/settings.h), on the host.
+ *
+ * Recording lets a random player (like tools/headless.c) play given level from
+ * its start for given number of steps. Playing back starts the level of the
+ * record and goes through all its steps, records made on the PC-FX (taken from
+ * inputRecord in RAM, see Replay_Switch in src/main.c) play the same. Both print the state of the run at the end
+ * and two checksums: of the game state after every step and of every frame
+ * drawn (at 320x240), so playing a record back has to print exactly what
+ * recording it did. This makes the records usable as benchmark input, golden
+ * frame checks and bug reports.
+ *
+ * Build and use :
+ *   cc -O2 -o replay tools/replay.c
+ *   ./replay record file [level] [steps] [seed]
+ *   ./replay play file
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define SFG_SCREEN_RESOLUTION_X 320
+#define SFG_SCREEN_RESOLUTION_Y 240
+
+#define SFG_INPUT_RECORDS 1
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_setPixel(x, y, colorIndex) framebuffer[(y) * SFG_SCREEN_RESOLUTION_X + (x)] = (colorIndex)
+
+static uint8_t framebuffer[SFG_SCREEN_RESOLUTION_X * SFG_SCREEN_RESOLUTION_Y];
+
+#include "../src/game.h"
+
+#define RECORD_SIZE (1024 * 1024)
+
+static uint16_t keys = 0;
+
+int8_t SFG_keyPressed(uint8_t key) { return (keys >> key) & 1; }
+void SFG_getMouseOffset(int16_t* x, int16_t* y) { *x = 0; *y = 0; }
+uint32_t SFG_getTimeMs() { return 0; }
+void SFG_sleepMs(uint16_t timeMs) { }
+void SFG_playSound(uint8_t soundIndex, uint8_t volume) { }
+void SFG_setMusic(uint8_t value) { }
+void SFG_processEvent(uint8_t event, uint8_t data) { }
+void SFG_save(uint8_t data[SFG_SAVE_SIZE]) { }
+uint8_t SFG_load(uint8_t data[SFG_SAVE_SIZE]) { return 0; }
+
+static uint32_t seed = 1;
+
+static uint32_t rnd()
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+static void pick_keys()
+{
+	keys = 0;
+
+	if (rnd() % 4)
+		keys |= 1 << SFG_KEY_UP;
+
+	switch (rnd() % 6)
+	{
+		case 0: keys |= 1 << SFG_KEY_LEFT; break;
+		case 1: keys |= 1 << SFG_KEY_RIGHT; break;
+		case 2: keys |= 1 << SFG_KEY_STRAFE_LEFT; break;
+		case 3: keys |= 1 << SFG_KEY_STRAFE_RIGHT; break;
+		default: break;
+	}
+
+	if (rnd() % 2)
+		keys |= 1 << SFG_KEY_A;
+
+	if (rnd() % 16 == 0)
+		keys |= 1 << SFG_KEY_JUMP;
+
+	if (rnd() % 32 == 0)
+		keys |= 1 << SFG_KEY_NEXT_WEAPON;
+}
+
+static uint32_t state_sum = 0, frame_sum = 0;
+
+static uint32_t sum(uint32_t s, const void* data, size_t size)
+{
+	const uint8_t* d = data;
+
+	while (size--)
+		s = s * 31 + *d++;
+
+	return s;
+}
+
+/* What SFG_mainLoopBody() does for one step, drawing every step. */
+static void step()
+{
+	SFG_game.frameTime += SFG_MS_PER_FRAME;
+	SFG_gameStep();
+	SFG_game.frame++;
+
+	state_sum = sum(state_sum, &SFG_player, sizeof(SFG_player));
+	state_sum = sum(state_sum, &SFG_game.currentRandom, sizeof(SFG_game.currentRandom));
+	state_sum = sum(state_sum, SFG_currentLevel.monsterRecords,
+		sizeof(SFG_currentLevel.monsterRecords));
+	state_sum = sum(state_sum, SFG_currentLevel.projectileRecords,
+		sizeof(SFG_currentLevel.projectileRecords));
+	state_sum = sum(state_sum, SFG_currentLevel.doorRecords,
+		sizeof(SFG_currentLevel.doorRecords));
+
+	SFG_draw();
+	frame_sum = sum(frame_sum, framebuffer, sizeof(framebuffer));
+}
+
+static void print_run(unsigned long steps, uint32_t size)
+{
+	SFG_RunState state;
+
+	SFG_getRunState(&state);
+
+	printf("%lu steps, record of %u bytes : level %u, health %u, kills %u/%u%s\n",
+		steps, (unsigned) size, state.levelNumber, state.health, state.kills,
+		state.monsters, state.levelWon ? ", won" : "");
+	printf("state checksum %08x, frame checksum %08x\n", state_sum, frame_sum);
+}
+
+int main(int argc, char** argv)
+{
+	static uint8_t record[RECORD_SIZE];
+	unsigned long i = 0;
+	uint32_t size;
+	FILE* f;
+
+	if (argc < 3 || (strcmp(argv[1], "record") && strcmp(argv[1], "play")))
+	{
+		fprintf(stderr, "usage : %s record file [level] [steps] [seed]\n"
+			"        %s play file\n", argv[0], argv[0]);
+		return 1;
+	}
+
+	SFG_init();
+
+	if (argv[1][0] == 'r')
+	{
+		unsigned level = argc > 3 ? atoi(argv[3]) : 0;
+		unsigned long steps = argc > 4 ? atol(argv[4]) : 10000, hold = 0;
+
+		seed = argc > 5 ? atol(argv[5]) : 1;
+
+		if (level >= SFG_NUMBER_OF_LEVELS)
+		{
+			fprintf(stderr, "there are only %d levels\n", SFG_NUMBER_OF_LEVELS);
+			return 1;
+		}
+
+		SFG_recordInput(record, RECORD_SIZE);
+		SFG_setAndInitLevel(level);
+
+		for (i = 0; i < steps && SFG_inputRecord.mode == SFG_INPUT_RECORD_RECORDING; i++)
+		{
+			if (hold-- == 0)
+			{
+				pick_keys();
+				hold = rnd() % 64;
+			}
+
+			step();
+		}
+
+		size = SFG_stopInput();
+
+		if (!(f = fopen(argv[2], "wb")) || fwrite(record, 1, size, f) != size)
+		{
+			fprintf(stderr, "can't write %s\n", argv[2]);
+			return 1;
+		}
+	}
+	else
+	{
+		if (!(f = fopen(argv[2], "rb")))
+		{
+			fprintf(stderr, "can't read %s\n", argv[2]);
+			return 1;
+		}
+
+		size = fread(record, 1, RECORD_SIZE, f);
+
+		if (!SFG_playInput(record, size))
+		{
+			fprintf(stderr, "%s is not a record of this version\n", argv[2]);
+			return 1;
+		}
+
+		for (i = 0; SFG_inputRecord.mode == SFG_INPUT_RECORD_PLAYING; i++)
+			step();
+	}
+
+	fclose(f);
+	print_run(i, size);
+
+	return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * snapbench : host benchmark of the state snapshots of the engine (SFG_SNAPSHOTS in
+ * src/settings.h).
+ *
+ * Plays given level with random inputs (like tools/headless.c), taking a snapshot
+ * after every step, then rewinds step by step back to the oldest kept snapshot and
+ * checks every restored state against the one saved at that step. Prints the
+ * snapshot and delta sizes and the time of encoding (taking) and decoding
+ * (rewinding) a snapshot per step, next to the time of a step.
+ *
+ * Build and use :
+ *   cc -O2 -o snapbench tools/snapbench.c
+ *   ./snapbench [level] [steps] [seed]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+static unsigned long delta_bytes = 0, delta_max = 0, deltas = 0;
+
+#define SFG_HEADLESS 1
+#define SFG_SNAPSHOTS 1
+#define SFG_SNAPSHOT_STATS(bytes, count) \
+	{ delta_bytes += (bytes); deltas++; if ((bytes) > delta_max) delta_max = (bytes); }
+#define SFG_PROGRAM_MEMORY static const
+#define SFG_PROGRAM_MEMORY_U8(addr) ((uint8_t) (*(addr)))
+#define SFG_setPixel(x, y, colorIndex) // nothing is drawn
+
+#include "../src/game.h"
+
+static uint16_t keys = 0;
+
+int8_t SFG_keyPressed(uint8_t key) { return (keys >> key) & 1; }
+void SFG_getMouseOffset(int16_t* x, int16_t* y) { *x = 0; *y = 0; }
+uint32_t SFG_getTimeMs() { return 0; }
+void SFG_sleepMs(uint16_t timeMs) { }
+void SFG_playSound(uint8_t soundIndex, uint8_t volume) { }
+void SFG_setMusic(uint8_t value) { }
+void SFG_processEvent(uint8_t event, uint8_t data) { }
+void SFG_save(uint8_t data[SFG_SAVE_SIZE]) { }
+uint8_t SFG_load(uint8_t data[SFG_SAVE_SIZE]) { return 0; }
+
+static uint32_t seed = 1;
+
+static uint32_t rnd()
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+static void pick_keys()
+{
+	keys = 0;
+
+	if (rnd() % 4)
+		keys |= 1 << SFG_KEY_UP;
+
+	switch (rnd() % 4)
+	{
+		case 0: keys |= 1 << SFG_KEY_LEFT; break;
+		case 1: keys |= 1 << SFG_KEY_RIGHT; break;
+		default: break;
+	}
+
+	if (rnd() % 2)
+		keys |= 1 << SFG_KEY_A;
+}
+
+static double now()
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+
+	return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* the snapshot taken at each of the last SFG_SNAPSHOT_COUNT + 1 steps */
+static uint8_t saved[SFG_SNAPSHOT_COUNT + 1][SFG_SNAPSHOT_SIZE];
+
+int main(int argc, char** argv)
+{
+	unsigned level = argc > 1 ? atoi(argv[1]) : 0;
+	unsigned long steps = argc > 2 ? atol(argv[2]) : 20000, i, pushed = 0;
+	double t_step = 0, t_encode = 0, t_decode = 0, start;
+	uint16_t rewound = 0;
+	uint8_t current[SFG_SNAPSHOT_SIZE];
+
+	seed = argc > 3 ? atol(argv[3]) : 1;
+
+	if (level >= SFG_NUMBER_OF_LEVELS)
+	{
+		fprintf(stderr, "there are only %d levels\n", SFG_NUMBER_OF_LEVELS);
+		return 1;
+	}
+
+	SFG_init();
+	SFG_mainLoopBody(); // no keys are held, leaves the init state
+	SFG_setAndInitLevel(level);
+
+	for (i = 0; i < steps; i++)
+	{
+		if (i % 32 == 0)
+			pick_keys();
+
+		SFG_player.health = 100; // keep playing
+
+		// what SFG_mainLoopBody() does, timing the step and the snapshot apart
+		start = now();
+		SFG_game.frameTime += SFG_MS_PER_FRAME;
+		SFG_gameStep();
+		SFG_game.frame++;
+		t_step += now() - start;
+
+		if (SFG_game.state == SFG_GAME_STATE_PLAYING)
+		{
+			start = now();
+			SFG_pushSnapshot();
+			t_encode += now() - start;
+
+			SFG_snapshotWrite(saved[pushed % (SFG_SNAPSHOT_COUNT + 1)]);
+			pushed++;
+		}
+	}
+
+	if (pushed == 0)
+	{
+		fprintf(stderr, "the level was never played\n");
+		return 1;
+	}
+
+	printf("%lu steps, %lu snapshots of %d bytes, deltas of %.0f bytes on average "
+		"(%lu at most), %u kept in %d bytes\n", steps, pushed, (int) SFG_SNAPSHOT_SIZE,
+		(double)delta_bytes / deltas, delta_max, SFG_snapshots.count,
+		SFG_SNAPSHOT_BUFFER_SIZE);
+
+	while (SFG_snapshots.count > 0)
+	{
+		start = now();
+		SFG_rewind(1);
+		t_decode += now() - start;
+		rewound++;
+
+		SFG_snapshotWrite(current);
+
+		if (memcmp(current, saved[(pushed - 1 - rewound) % (SFG_SNAPSHOT_COUNT + 1)],
+			SFG_SNAPSHOT_SIZE) != 0)
+		{
+			printf("rewinding %u steps restored a different state\n", rewound);
+			return 1;
+		}
+	}
+
+	printf("rewound %u steps, every restored state matches\n", rewound);
+	printf("step   %7.2f us\n", t_step * 1e6 / steps);
+	printf("encode %7.2f us per snapshot\n", t_encode * 1e6 / pushed);
+	printf("decode %7.2f us per step rewound (rewinding restores the state once "
+		"per call)\n", t_decode * 1e6 / rewound);
+	printf("frame budget %d ms\n", SFG_MS_PER_FRAME);
+
+	return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * soundbanktest : host test of the KRAM allocator of the sound bank (src/soundbank.c).
+ *
+ * Makes a manifest of random sample sizes, some in RAM and some on the CD, and drives
+ * Soundbank_Load through random residency masks : new levels (any samples) and small
+ * changes of the current one, which leave holes between the samples that stay and so
+ * go through the packing again from the start. KRAM is a word array here, every upload
+ * fills the words of its sample with the sample number, and one CD read in 16 fails.
+ *
+ * After every load it checks that the resident samples are the asked for ones, that
+ * their [address, address + size) ranges are inside the bank and don't overlap, that
+ * their words in KRAM still hold their own data, and that a load only fails (-1) if the
+ * samples can't fit even packed. Prints the number of loads, of packings and of failed
+ * reads, or the first check that failed.
+ *
+ * Build and use :
+ *   cc -O2 -o soundbanktest tools/soundbanktest.c
+ *   ./soundbanktest [loads] [seed]
+ *
+ * Licensed under MIT license, see LICENSE file for more
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// stand-ins for what src/pcfx.h gives the sound bank
+#define PCFX_H
+typedef uint8_t u8;
+typedef uint32_t u32;
+
+#define KRAM_WORDS 0x40000
+#define KRAM_PAGE 0x80000000 // kept out of the addresses the bank works with
+#define BANK_START 0x2000
+#define BANK_END 0x12000
+#define SAMPLES 24
+
+static uint16_t kram[KRAM_WORDS];
+static u32 kram_write;
+static unsigned cd_reads = 0, cd_failures = 0;
+static unsigned char ram_samples[SAMPLES]; // only the addresses matter
+
+static void fill(u32 addr, int sample, u32 size)
+{
+	u32 i;
+
+	addr &= ~KRAM_PAGE;
+
+	for (i = 0; i < (size + 1) / 2; i++)
+		kram[addr + i] = sample + 1;
+}
+
+void Present_Lock() { }
+void Present_Unlock() { }
+void eris_king_set_kram_write(u32 addr, int incr) { kram_write = addr; }
+void king_kram_write_buffer(void* addr, int size) { fill(kram_write, (unsigned char*) addr - ram_samples, size); }
+
+int LoadADPCMCD(u32 lba, u32 addr, uint32_t size_sample)
+{
+	cd_reads++;
+
+	if (rand() % 16 == 0)
+	{
+		cd_failures++;
+		return -1;
+	}
+
+	fill(addr, lba, size_sample);
+
+	return 0;
+}
+
+#include "../src/soundbank.c"
+
+static soundbank_entry_t manifest[SAMPLES];
+
+static u32 words(int sample)
+{
+	return (((manifest[sample].size + 1) >> 1) + SOUNDBANK_ALIGN - 1) & ~(SOUNDBANK_ALIGN - 1);
+}
+
+/* Returns 0 if all is right, otherwise prints what isn't. */
+static int check(unsigned load, u32 mask, int result)
+{
+	u32 needed = 0;
+	int i, j;
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		u32 a = Soundbank_Address(i), k;
+
+		if (mask & (1 << i))
+			needed += words(i);
+
+		if (a == SOUNDBANK_NOT_RESIDENT)
+		{
+			// only a failed read or a failed load leaves an asked for sample out
+			if ((mask & (1 << i)) && result != -1 && manifest[i].data)
+			{
+				printf("load %u : sample %d is missing\n", load, i);
+				return 1;
+			}
+
+			continue;
+		}
+
+		if (!(mask & (1 << i)))
+		{
+			printf("load %u : sample %d wasn't asked for\n", load, i);
+			return 1;
+		}
+
+		if ((a & KRAM_PAGE) == 0)
+		{
+			printf("load %u : sample %d is missing the KRAM page\n", load, i);
+			return 1;
+		}
+
+		a &= ~KRAM_PAGE;
+
+		if (a < BANK_START || a + words(i) > BANK_END || a % SOUNDBANK_ALIGN)
+		{
+			printf("load %u : sample %d at %x-%x, outside the bank\n", load, i, a, a + words(i));
+			return 1;
+		}
+
+		for (j = 0; j < i; j++)
+		{
+			u32 b = Soundbank_Address(j) & ~KRAM_PAGE;
+
+			if (Soundbank_Address(j) != SOUNDBANK_NOT_RESIDENT && a < b + words(j) && b < a + words(i))
+			{
+				printf("load %u : samples %d and %d overlap\n", load, j, i);
+				return 1;
+			}
+		}
+
+		for (k = 0; k < (manifest[i].size + 1) / 2; k++)
+			if (kram[a + k] != i + 1)
+			{
+				printf("load %u : data of sample %d overwritten by %d\n", load, i, kram[a + k] - 1);
+				return 1;
+			}
+	}
+
+	if (result == -1 && needed <= BANK_END - BANK_START)
+	{
+		printf("load %u : %x words didn't fit in %x\n", load, needed, BANK_END - BANK_START);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	unsigned loads = argc > 1 ? atoi(argv[1]) : 100000, load, packed = 0, failed = 0;
+	u32 mask = 0;
+	int i;
+
+	srand(argc > 2 ? atoi(argv[2]) : 1);
+
+	for (i = 0; i < SAMPLES; i++)
+	{
+		manifest[i].size = 512 + rand() % 24000;
+		manifest[i].data = (i % 3) ? ram_samples + i : 0;
+		manifest[i].lba = i;
+	}
+
+	Soundbank_Init(manifest, SAMPLES, BANK_START, BANK_END, KRAM_PAGE);
+
+	for (load = 0; load < loads; load++)
+	{
+		u32 before = 0, added = 0;
+		int result;
+
+		if (rand() % 4 == 0) // a new level
+		{
+			mask = 0;
+
+			for (i = rand() % 10; i > 0; i--)
+				mask |= 1 << (rand() % SAMPLES);
+		}
+		else // some samples come, some go
+		{
+			for (i = rand() % 3 + 1; i > 0; i--)
+				mask ^= 1 << (rand() % SAMPLES);
+		}
+
+		for (i = 0; i < SAMPLES; i++)
+			if (Soundbank_Address(i) != SOUNDBANK_NOT_RESIDENT && (mask & (1 << i)))
+				before |= 1 << i;
+
+		for (i = 0; i < SAMPLES; i++)
+			if ((mask & ~before) & (1 << i))
+				added++;
+
+		result = Soundbank_Load(mask);
+
+		if (result == -1)
+			failed++;
+		else if ((u32) result > added)
+			packed++; // samples that were resident got uploaded again
+
+		if (check(load, mask, result))
+			return 1;
+	}
+
+	printf("%u loads, %u packed again, %u didn't fit, %u of %u CD reads failed : all right\n",
+		loads, packed, failed, cd_failures, cd_reads);
+
+	return 0;
+}